@@ -27,6 +27,7 @@
 
 #include <time.h>
 #include <stdint.h>
+#include <string.h>
 #include <apr.h>
 #include <apr_file_info.h>
 
@@ -35,23 +36,170 @@
  *
  * Memory mapped region contains the following:
  *   mmap_server_data:          Server informaion and number of server modules allocated.  This includes:
+ *     mmap_region_header:        Magic number, layout version, configuration generation and sequence lock
  *     mmap_server_modules:       Array (size based on Apache Config) for each module loaded in configuration
  *   mmap_vhost_data:           Size marker to indicate number of virtual tables allocated.  This includes:
  *     mmap_vhost_elements:       Array (size based on Apache Config) for each virtual host in configuraiton
+ *     mmap_vhost_statistics:     Array (same size) of statistics computed by the provider for each virtual host
  *   mmap_certificate_data:     Size marker to indicate number of certificate file information blocks allocated.  This includes:
  *     mmap_certificate_elements: Array (size based on Apache Config) for each certificate file
+ *   mmap_string_table:         String table referenced by offsets in the above structures.  Strings are
+ *                              interned: identical strings (log paths, document roots, ...) are stored once.
+ *   mmap_vhost_address:        Addresses and ports of all virtual hosts; see vhostAddressOffset
+ *   (apr_size_t):              String offsets of the aliases of all virtual hosts; see vhostAliasOffset
+ *   mmap_vhost_counters:       Counter slabs written by Apache on each request, one element per virtual host
+ *                              per slab.  Slabs are cache line aligned; see counterShard* in mmap_server_data.
+ *   mmap_vhost_counters:       Counters of evicted dynamic hosts (kept by the provider); see evictedCountersOffset
+ *   mmap_vhost_latency:        Latency histogram slabs, one per counter slab, one element per virtual host per
+ *                              slab.  Slabs are cache line aligned; see latencyShard* in mmap_server_data.
+ *   mmap_trace_ring:           Ring of binary per-request trace records (CimTraceRecords), written by Apache
+ *                              when logging is enabled and decoded by the provider; see traceRingOffset.
+ *   mmap_topurl_slot:          Heavy-hitter URL tables (CimTopUrlSlots), one table per virtual host
+ *   mmap_topurl_result:        Top URLs for the last interval (computed by provider), one array per virtual host
+ *   mmap_vhost_clients:        Unique client (HyperLogLog) registers (CimUniqueClients), one element per
+ *                              virtual host; see clientsCount
+ *   mmap_dynamic_host:         Dynamic host table (CimDynamicHosts), naming the virtual host elements that are
+ *                              claimed at run time by Host header; see dynamicHostOffset
+ *   (apr_uint32_t):            Process IDs of the child processes, by scoreboard slot; see childPidOffset
+ *
+ * Data is split by who writes it and how often: per-request counters (hot), provider statistics (once/minute),
+ * and configuration data (written once).  This keeps the provider from sharing cache lines with Apache counters.
  */
 
 // Length of the host name (Wikipedia claims max length=253 for any DNS name)
 #define MAX_HOST_NAME_LEN 256
 
+// Size of a processor cache line, used to keep counter slabs of different child processes apart
+#define MMAP_CACHE_LINE_SIZE 64
+#define MMAP_CACHE_LINE_ALIGN(size) (((size) + MMAP_CACHE_LINE_SIZE - 1) & ~((apr_size_t) MMAP_CACHE_LINE_SIZE - 1))
+
+// Maximum number of counter slabs (CimCounterShards)
+#define MMAP_MAX_COUNTER_SHARDS 1024
+
+// Maximum size of all counter and latency slabs (hosts times slabs); larger configurations are refused
+#define MMAP_MAX_SLAB_BYTES (256 * 1024 * 1024)
+
+// Default and maximum number of trace records (CimTraceRecords)
+#define MMAP_DEFAULT_TRACE_RECORDS 4096
+#define MMAP_MAX_TRACE_RECORDS (1024 * 1024)
+
+// Maximum heavy-hitter URL slots per virtual host (CimTopUrlSlots) and URLs reported (CimTopUrlCount)
+#define MMAP_MAX_TOPURL_SLOTS 4096
+#define MMAP_DEFAULT_TOPURL_COUNT 10
+
+// 64-bit atomic operations for counters in the region. APR only provides 32-bit
+// atomics, so use the compiler builtins (__atomic with GCC 4.7 and later, else
+// __sync). Counters are statistics only, so no ordering is required.
+#if defined(__ATOMIC_RELAXED)
+#define MMAP_ATOMIC_READ64(ptr)         __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define MMAP_ATOMIC_SET64(ptr, val)     __atomic_store_n((ptr), (apr_uint64_t) (val), __ATOMIC_RELAXED)
+#define MMAP_ATOMIC_ADD64(ptr, val)     __atomic_fetch_add((ptr), (apr_uint64_t) (val), __ATOMIC_RELAXED)
+#else
+#define MMAP_ATOMIC_READ64(ptr)         __sync_fetch_and_add((ptr), (apr_uint64_t) 0)
+#define MMAP_ATOMIC_SET64(ptr, val)     ((void) __sync_lock_test_and_set((ptr), (apr_uint64_t) (val)))
+#define MMAP_ATOMIC_ADD64(ptr, val)     __sync_fetch_and_add((ptr), (apr_uint64_t) (val))
+#endif
+#define MMAP_ATOMIC_INC64(ptr)          MMAP_ATOMIC_ADD64((ptr), 1)
+#define MMAP_ATOMIC_XCHG64(ptr, val)    __sync_lock_test_and_set((ptr), (apr_uint64_t) (val))
+#define MMAP_ATOMIC_CAS64(ptr, old, new) __sync_bool_compare_and_swap((ptr), (apr_uint64_t) (old), (apr_uint64_t) (new))
+#define MMAP_MEMORY_BARRIER()           __sync_synchronize()
+
+// Counters must be naturally aligned for 64-bit atomics, even on 32-bit platforms
+typedef volatile apr_uint64_t mmap_counter64 __attribute__ ((aligned (8)));
+
 typedef struct
 {
     apr_size_t moduleNameOffset;
 } mmap_server_modules;
 
+// Control block: a small region at PROVIDER_MMAP_NAME that Apache creates once
+// and keeps across restarts.  Apache builds each data region under its own
+// name (MMAP_REGION_NAME_FORMAT, by generation) and only then publishes it by
+// setting the generation here, so readers never see a region being built.
+// Readers of a retired region notice its sequence lock and re-attach; Apache
+// unlinks the retired region once MMAP_REGION_GRACE_SECONDS have passed.  If
+// Apache dies without cleaning up, the next Apache to start removes the data
+// regions the old control block names.
+#define MMAP_CONTROL_MAGIC 0x4c544e43   // "CNTL"
+#define MMAP_REGION_NAME_FORMAT PROVIDER_MMAP_NAME ".%u"
+#define MMAP_REGION_GRACE_SECONDS 120
+
+typedef struct
+{
+    volatile apr_uint32_t magic;        // MMAP_CONTROL_MAGIC once the control block is initialized
+    apr_uint32_t version;               // Layout version of data regions (MMAP_REGION_VERSION)
+    volatile apr_uint32_t generation;   // Generation of the current data region (zero if none yet)
+    apr_uint32_t retiredGeneration;     // Generation of the retired data region (zero if none); Apache only
+    apr_uint32_t builtGeneration;       // Generation of the data region built last (published or not); Apache only
+} mmap_control_block;
+
+// Region header, at the very start of the region.  The magic number is written
+// last when Apache builds the region, so a reader never mistakes a region that
+// is still being built for a valid one.  Bump MMAP_REGION_VERSION whenever the
+// layout changes incompatibly, so that a mismatched provider refuses to attach.
+#define MMAP_REGION_MAGIC 0x504d4943    // "CIMP"
+#define MMAP_REGION_VERSION 7
+
+typedef struct
+{
+    volatile apr_uint32_t magic;        // MMAP_REGION_MAGIC once the region is built
+    apr_uint32_t version;               // Layout version (MMAP_REGION_VERSION)
+    apr_size_t regionSize;              // Size of the region as built by Apache
+    apr_uint32_t generation;            // Configuration generation (changes each time Apache builds the region)
+    volatile apr_uint32_t sequence;     // Sequence lock: odd while configuration data is rewritten (or region retired)
+} mmap_region_header;
+
+// Sequence lock over the configuration data of the region.  Counters are
+// updated with atomics and aren't covered; readers take lock-free snapshots
+// of everything else, retrying if Apache rewrites (or retires) the region
+// while they read.  The provider writes too (resetting an evicted dynamic
+// host), so writers step the sequence atomically.
+
+static inline apr_uint32_t mmap_region_read_begin(const mmap_region_header *header)
+{
+    apr_uint32_t sequence = header->sequence;
+
+    MMAP_MEMORY_BARRIER();
+    return sequence;
+}
+
+static inline int mmap_region_read_retry(const mmap_region_header *header, apr_uint32_t sequence)
+{
+    MMAP_MEMORY_BARRIER();
+    return (sequence & 1) || header->magic != MMAP_REGION_MAGIC || header->sequence != sequence;
+}
+
+static inline void mmap_region_write_begin(mmap_region_header *header)
+{
+    __sync_fetch_and_add(&header->sequence, 1);
+}
+
+static inline void mmap_region_write_end(mmap_region_header *header)
+{
+    __sync_fetch_and_add(&header->sequence, 1);
+}
+
+// Rate history, kept by provider from samples every 10 seconds: average and peak
+// of each rate over the last 1, 5, 15 and 60 minutes
+
+#define MMAP_RATE_REQUESTS      0       // Requests per second
+#define MMAP_RATE_KB            1       // KB per second
+#define MMAP_RATE_ERRORS_4XX    2       // 4xx responses per minute
+#define MMAP_RATE_ERRORS_5XX    3       // 5xx responses per minute
+#define MMAP_RATE_COUNT         4
+
+#define MMAP_RATE_WINDOWS       4
+
+typedef struct
+{
+    volatile apr_uint32_t average[MMAP_RATE_WINDOWS];
+    volatile apr_uint32_t peak[MMAP_RATE_WINDOWS];
+} mmap_rate_history;
+
 typedef struct
 {
+    mmap_region_header header;          // Must be first
+
     apr_size_t configFileOffset;        // Apache configuration file name
     apr_size_t serverVersionOffset;     // Version of Apache server
     apr_size_t serverRootOffset;        // Root directory of server install
@@ -62,17 +210,144 @@ typedef struct
     apr_uint32_t busyApacheWorkers;     // Number of workers that are currently busy (from Apache)
     volatile time_t busyRefreshTime;    // Time of last update for idle/busy workers
 
-    /* The following are from provider worker thread that are updated once/minute */
+    /* The following are from provider worker thread that are updated every 10 seconds */
     apr_uint32_t idleWorkers;           // Number of workers that are currently idle
     apr_uint32_t busyWorkers;           // Number of workers that are currently busy
-    apr_uint32_t currentCpuUtilization; // Current CPU utilization of Apache Server for delta computations
-    apr_uint32_t priorCpuUtilization;   // Prior copy of apacheCpuUtilization for delta computations
+    apr_uint64_t currentCpuUtilization; // Current CPU utilization of Apache Server for delta computations
+    apr_uint64_t priorCpuUtilization;   // Prior copy of apacheCpuUtilization for delta computations
     apr_uint32_t percentCPU;            // Percentage of CPU utilization
+    mmap_rate_history cpuHistory;       // History of percentCPU
+    mmap_rate_history busyWorkersHistory; // History of busyWorkers
+    mmap_counter64 residentBytes;       // Resident memory of the server and its child processes
+    mmap_counter64 childResidentBytes;  // Resident memory of the child processes
+    apr_uint32_t childProcesses;        // Number of live child processes
+    apr_uint32_t childPercentCPU;       // Average CPU utilization of a child process (percentage of one processor)
+
+    /* Counter slabs; with more than one slab (CimCounterShards), Apache doesn't count _Total directly */
+    apr_size_t counterShardCount;       // Number of counter slabs (always at least one)
+    apr_size_t counterShardOffset;      // Offset of first counter slab from start of region (cache line aligned)
+    apr_size_t counterShardSize;        // Size of each counter slab (multiple of cache line size)
+    volatile apr_uint32_t nextCounterShard; // Handed out (modulo counterShardCount) to each child process at startup
+    apr_size_t evictedCountersOffset;   // Offset of counters of evicted dynamic hosts from start of region (cache line aligned)
+    apr_size_t latencyShardOffset;      // Offset of first latency slab from start of region (cache line aligned)
+    apr_size_t latencyShardSize;        // Size of each latency slab (multiple of cache line size)
+    apr_size_t traceRingOffset;         // Offset of trace ring from start of region (cache line aligned)
+    apr_size_t topUrlSlots;             // Heavy-hitter URL slots per virtual host (zero if disabled)
+    apr_size_t topUrlCount;             // Number of top URLs reported (by requests and by bytes) per virtual host
+    apr_size_t topUrlOffset;            // Offset of heavy-hitter URL tables from start of region
+    apr_size_t topUrlResultOffset;      // Offset of top URL results from start of region
+    apr_size_t clientsCount;            // Number of unique client register elements (zero if disabled)
+    apr_size_t clientsOffset;           // Offset of unique client registers from start of region
+    apr_size_t vhostAddressOffset;      // Offset of virtual host addresses and ports from start of region
+    apr_size_t vhostAliasOffset;        // Offset of virtual host alias string offsets from start of region
+    apr_int32_t clientsDay;             // Day (year * 1000 + day of year) of the daily unique client registers
+    apr_size_t dynamicHostCount;        // Number of dynamic host slots (zero if disabled)
+    apr_size_t dynamicHostBase;         // Virtual host element of the first slot (the overflow element follows the last)
+    apr_size_t dynamicHostOffset;       // Offset of dynamic host table from start of region
+    apr_size_t childPidCount;           // Number of scoreboard process slots (Apache's process limit)
+    apr_size_t childPidOffset;          // Offset of child process IDs from start of region
 
     apr_size_t moduleCount;             // Number of elements of mmap_server_modules that follow
     mmap_server_modules modules[0];     // Array of Apache modules loaded into the configuraiton
 } mmap_server_data;
 
+// Counters are kept as 64-bit values (see MMAP_ATOMIC_*64) so they don't wrap
+// in practice, even for byte counts on very busy hosts.
+
+// Response outcomes counted for each virtual host: each status class, a few
+// individual status codes of operational interest, and client aborts. A
+// request is counted in its class and (if tracked) in its individual code.
+
+#define MMAP_RESPONSE_1XX       0
+#define MMAP_RESPONSE_2XX       1
+#define MMAP_RESPONSE_3XX       2
+#define MMAP_RESPONSE_4XX       3
+#define MMAP_RESPONSE_5XX       4
+#define MMAP_RESPONSE_404       5       // Not Found
+#define MMAP_RESPONSE_429       6       // Too Many Requests
+#define MMAP_RESPONSE_499       7       // Client Closed Request
+#define MMAP_RESPONSE_502       8       // Bad Gateway
+#define MMAP_RESPONSE_503       9       // Service Unavailable
+#define MMAP_RESPONSE_504       10      // Gateway Timeout
+#define MMAP_RESPONSE_ABORTED   11      // Client aborted the connection (any status)
+#define MMAP_RESPONSE_COUNT     12
+
+typedef struct
+{
+    mmap_counter64 requestsTotal;
+    mmap_counter64 requestsBytes;
+    mmap_counter64 responses[MMAP_RESPONSE_COUNT];
+} mmap_vhost_counters;
+
+// Count a request (code_index is its individual response counter, or -1 if none)
+static inline void mmap_count_request(mmap_vhost_counters *counters, apr_off_t bytes_sent, int http_status, int code_index, int aborted)
+{
+    MMAP_ATOMIC_INC64(&counters->requestsTotal);
+    MMAP_ATOMIC_ADD64(&counters->requestsBytes, bytes_sent);
+    if (http_status >= 100 && http_status <= 599)
+    {
+        MMAP_ATOMIC_INC64(&counters->responses[MMAP_RESPONSE_1XX + (http_status / 100) - 1]);
+    }
+    if (code_index >= 0)
+    {
+        MMAP_ATOMIC_INC64(&counters->responses[code_index]);
+    }
+    if (aborted)
+    {
+        MMAP_ATOMIC_INC64(&counters->responses[MMAP_RESPONSE_ABORTED]);
+    }
+}
+
+// Request latency (in microseconds) is kept in a log-linear histogram: each
+// power of two is split into MMAP_LATENCY_SUB_BUCKETS linear buckets, so the
+// error of a reported percentile is at most 1/MMAP_LATENCY_SUB_BUCKETS. Buckets
+// cover the full 32-bit range (about 71 minutes).
+//
+// Apache only ever increments buckets (and raises maxLatency); the provider
+// reads and clears them each sample, so the counts are per-interval and 32
+// bits is plenty. _Total is summed by the provider, never written by Apache.
+
+#define MMAP_LATENCY_SUB_BUCKET_BITS 2
+#define MMAP_LATENCY_SUB_BUCKETS (1 << MMAP_LATENCY_SUB_BUCKET_BITS)
+#define MMAP_LATENCY_BUCKETS ((32 - MMAP_LATENCY_SUB_BUCKET_BITS + 1) * MMAP_LATENCY_SUB_BUCKETS)
+
+typedef struct
+{
+    volatile apr_uint32_t maxLatency;   // Longest request (microseconds) since the provider last sampled
+    volatile apr_uint32_t buckets[MMAP_LATENCY_BUCKETS];
+} mmap_vhost_latency;
+
+// Histogram bucket for a latency (in microseconds)
+static inline apr_size_t mmap_latency_bucket(apr_uint32_t usec)
+{
+    int msb;
+
+    if (usec < MMAP_LATENCY_SUB_BUCKETS)
+    {
+        return usec;
+    }
+
+    msb = 31 - __builtin_clz(usec);
+    return ((apr_size_t) (msb - MMAP_LATENCY_SUB_BUCKET_BITS + 1) << MMAP_LATENCY_SUB_BUCKET_BITS)
+        + ((usec >> (msb - MMAP_LATENCY_SUB_BUCKET_BITS)) & (MMAP_LATENCY_SUB_BUCKETS - 1));
+}
+
+// Largest latency (in microseconds) that falls into a histogram bucket
+static inline apr_uint32_t mmap_latency_bucket_limit(apr_size_t bucket)
+{
+    int msb;
+    apr_uint64_t low;
+
+    if (bucket < MMAP_LATENCY_SUB_BUCKETS)
+    {
+        return (apr_uint32_t) bucket;
+    }
+
+    msb = (int) (bucket >> MMAP_LATENCY_SUB_BUCKET_BITS) + MMAP_LATENCY_SUB_BUCKET_BITS - 1;
+    low = ((apr_uint64_t) 1 << msb) + ((apr_uint64_t) (bucket & (MMAP_LATENCY_SUB_BUCKETS - 1)) << (msb - MMAP_LATENCY_SUB_BUCKET_BITS));
+    return (apr_uint32_t) (low + ((apr_uint64_t) 1 << (msb - MMAP_LATENCY_SUB_BUCKET_BITS)) - 1);
+}
+
 typedef struct
 {
     apr_size_t hostNameOffset;
@@ -83,46 +358,400 @@ typedef struct
     apr_size_t logCustomOffset;
     apr_size_t logAccessOffset;
 
-    apr_size_t addressesAndPortsOffset;
-    apr_size_t serverAliasesOffset;
-
-    // Counters are kept as 32-bit values, for APR compatibility. Overflow to be
-    // recognized by and compensated by the provider. This works because we are
-    // primarily interested in rate of change vs. overall totals anyway.
+    // Addresses and aliases are slices of the region-wide arrays (MMAP_VHOST_ADDRESSES and
+    // MMAP_VHOST_ALIASES), with their formatted forms ("a, b, c") ready for the provider
+    apr_size_t addressIndex;            // Index of first address of this host
+    apr_size_t addressCount;            // Number of addresses (and ports) of this host
+    apr_size_t aliasIndex;              // Index of first alias of this host
+    apr_size_t aliasCount;              // Number of aliases of this host
+    apr_size_t ipAddressesFormattedOffset;
+    apr_size_t portsFormattedOffset;
+    apr_size_t aliasesFormattedOffset;
+} mmap_vhost_elements;
 
-    volatile apr_uint32_t requestsTotal;
-    volatile apr_uint32_t requestsBytes;
-    volatile apr_uint32_t errorCount400;
-    volatile apr_uint32_t errorCount500;
+typedef struct
+{
+    apr_size_t hostOffset;              // Address (or "_default_") as a string table offset
+    apr_uint16_t port;
+} mmap_vhost_address;
 
-    // Following information kept by provider, not by Apache module. It's here
-    // for convenience only. This data must be per-host, and since the above
-    // data is per-VHost structure, here is a good a place as any.
+// Region-wide arrays of virtual host addresses, and of virtual host aliases (as string table offsets)
+#define MMAP_VHOST_ADDRESSES(server_data) ((mmap_vhost_address *) ((char *) (server_data) + (server_data)->vhostAddressOffset))
+#define MMAP_VHOST_ALIASES(server_data) ((apr_size_t *) ((char *) (server_data) + (server_data)->vhostAliasOffset))
 
-    apr_uint32_t requestsTotalPrior;
-    apr_uint32_t requestsTotalBytesPrior;
-    apr_uint32_t errorCount400TotalPrior;
-    apr_uint32_t errorCount500TotalPrior;
+// Following information kept by provider, not by Apache module. The counters
+// themselves are in the counter slabs.
 
-    apr_uint64_t requestTotal64;
-    apr_uint64_t requestsBytesTotal64;
-    apr_uint64_t errorCount400Total64;
-    apr_uint64_t errorCount500Total64;
+typedef struct
+{
+    mmap_vhost_counters priorCounters;  // Counters as of the prior computation, for deltas
 
     volatile apr_uint32_t requestsPerSecond;
     volatile apr_uint32_t kbPerRequest;
     volatile apr_uint32_t kbPerSecond;
 
-    volatile apr_uint32_t errorsPerMinute400;
-    volatile apr_uint32_t errorsPerMinute500;
-} mmap_vhost_elements;
+    volatile apr_uint32_t responsesPerMinute[MMAP_RESPONSE_COUNT];
+
+    volatile apr_uint32_t latencyP50;   // Request latency percentiles over the last interval (microseconds)
+    volatile apr_uint32_t latencyP95;
+    volatile apr_uint32_t latencyP99;
+    volatile apr_uint32_t latencyMax;
+
+    volatile apr_uint32_t uniqueClients;        // Estimated unique clients over the last interval
+    volatile apr_uint32_t uniqueClientsToday;   // Estimated unique clients since midnight (local time)
+
+    mmap_rate_history rateHistory[MMAP_RATE_COUNT];
+} mmap_vhost_statistics;
 
 typedef struct
 {
-    apr_size_t count;                   // Number of elements of mmap_vhost_elements that follow
+    apr_size_t count;                   // Number of elements of mmap_vhost_elements (and mmap_vhost_statistics) that follow
     mmap_vhost_elements vhosts[0];      // Array of mmap_vhost_elements (host information)
 } mmap_vhost_data;
 
+// Statistics for virtual hosts immediately follow the array of mmap_vhost_elements
+#define MMAP_VHOST_STATISTICS(vhost_data) ((mmap_vhost_statistics *) ((vhost_data)->vhosts + (vhost_data)->count))
+
+// Counter slab for a given shard (slab) number
+#define MMAP_COUNTER_SLAB(server_data, shard) \
+    ((mmap_vhost_counters *) ((char *) (server_data) + (server_data)->counterShardOffset + ((shard) * (server_data)->counterShardSize)))
+
+// Counters taken from dynamic hosts as the provider evicts them.  Apache never
+// writes them; with more than one counter slab, they are added into the derived
+// _Total so that it doesn't go backwards when a host is evicted.
+#define MMAP_EVICTED_COUNTERS(server_data) \
+    ((mmap_vhost_counters *) ((char *) (server_data) + (server_data)->evictedCountersOffset))
+
+// Latency slab for a given shard (slab) number
+#define MMAP_LATENCY_SLAB(server_data, shard) \
+    ((mmap_vhost_latency *) ((char *) (server_data) + (server_data)->latencyShardOffset + ((shard) * (server_data)->latencyShardSize)))
+
+// Per-request trace records. Any Apache thread may write (claiming a slot by
+// incrementing head); the provider reads. A record is valid when its sequence
+// is the slot's sequence number + 1; writers clear it while filling the slot,
+// so readers re-check it after copying to detect records overwritten under them.
+// Sequence numbers are 64 bits, so sequence + 1 never wraps to zero (which
+// would look like a record being written).
+
+#define MMAP_TRACE_ABORTED      0x0001  // Client aborted the connection
+
+typedef struct
+{
+    mmap_counter64 sequence;            // Sequence number + 1 when complete; 0 while being written
+    apr_time_t timestamp;               // Time the request was logged
+    apr_uint64_t bytes;                 // Bytes sent
+    apr_uint32_t vhost;                 // Index of the virtual host (in mmap_vhost_data)
+    apr_uint32_t duration;              // Request latency (microseconds)
+    apr_uint32_t pid;                   // Apache child process
+    apr_uint16_t status;                // HTTP status
+    apr_uint16_t flags;                 // MMAP_TRACE_* flags
+} mmap_trace_record;
+
+typedef struct
+{
+    apr_uint32_t capacity;              // Number of records (a power of two; zero if tracing is disabled)
+    mmap_counter64 head __attribute__ ((aligned (MMAP_CACHE_LINE_SIZE)));  // Next sequence number to claim
+    mmap_trace_record records[0] __attribute__ ((aligned (MMAP_CACHE_LINE_SIZE)));
+} mmap_trace_ring;
+
+#define MMAP_TRACE_RING(server_data) ((mmap_trace_ring *) ((char *) (server_data) + (server_data)->traceRingOffset))
+
+// Claim the next trace record; fill it in, then call mmap_trace_commit
+static inline mmap_trace_record *mmap_trace_claim(mmap_trace_ring *ring, apr_uint64_t *sequence)
+{
+    mmap_trace_record *record;
+
+    *sequence = __sync_fetch_and_add(&ring->head, (apr_uint64_t) 1);
+    record = &ring->records[*sequence & (ring->capacity - 1)];
+    MMAP_ATOMIC_SET64(&record->sequence, 0);
+    MMAP_MEMORY_BARRIER();
+    return record;
+}
+
+static inline void mmap_trace_commit(mmap_trace_record *record, apr_uint64_t sequence)
+{
+    MMAP_MEMORY_BARRIER();
+    MMAP_ATOMIC_SET64(&record->sequence, sequence + 1);
+}
+
+// Heavy-hitter URLs. Each virtual host has a table of slots; a URL hashes to
+// one slot, which keeps a per-slot majority count (Misra-Gries): a matching
+// URL increments it, another URL decrements it, and a URL may take the slot
+// over once the count reaches zero. Busy URLs thus hold their slots, and
+// their counts are lower bounds. Fingerprint and count are packed into one
+// 64-bit word so each request changes them with a single compare-and-swap
+// (counting, wearing down or taking over), and the count saturates rather
+// than carry into the fingerprint. Bytes sent are tagged with the low bits
+// of the fingerprint they were counted for, so the bytes of a URL that lost
+// its slot are started over, never charged to the URL that took it over.
+//
+// The provider halves the counts each sample rather than clearing them, so a
+// busy URL keeps its slot against URLs that collide with it, and reports the
+// increase over the count it left (see carried), so results are per-interval.
+
+#define MMAP_TOPURL_LENGTH 128          // Longest URL kept (including terminator); longer URLs are truncated
+
+typedef struct
+{
+    volatile apr_uint64_t key __attribute__ ((aligned (8)));  // URL fingerprint (high 32 bits) and count (low 32 bits)
+    mmap_counter64 bytes;               // Bytes sent for the URL in this slot (low 48 bits), tagged (high 16 bits)
+    apr_uint64_t carried;               // Key as the provider left it at the last sample (written by provider)
+    char url[MMAP_TOPURL_LENGTH];       // URL (written by the process that took the slot over)
+} mmap_topurl_slot;
+
+typedef struct
+{
+    apr_uint64_t requests;              // Requests for URL during the last interval (lower bound)
+    apr_uint64_t bytes;                 // Bytes sent for URL during the last interval
+    apr_uint32_t rankByRequests;        // Rank (1 = busiest) by requests, or 0 if not in the top topUrlCount
+    apr_uint32_t rankByBytes;           // Rank (1 = busiest) by bytes, or 0 if not in the top topUrlCount
+    char url[MMAP_TOPURL_LENGTH];       // URL (empty if this result is unused)
+} mmap_topurl_result;
+
+// Fingerprint of a URL as kept in a slot (never zero), also returning the length kept
+static inline apr_uint32_t mmap_topurl_hash(const char *url, apr_size_t *length)
+{
+    apr_uint32_t hash = 2166136261U;    // FNV-1a
+    apr_size_t i;
+
+    for (i = 0; url[i] != '\0' && i < MMAP_TOPURL_LENGTH - 1; i++)
+    {
+        hash = (hash ^ (unsigned char) url[i]) * 16777619U;
+    }
+
+    *length = i;
+    return hash ? hash : 1;
+}
+
+#define MMAP_TOPURL_MAX_COUNT 0xFFFFFFFF
+#define MMAP_TOPURL_BYTES_MASK (((apr_uint64_t) 1 << 48) - 1)
+#define MMAP_TOPURL_BYTES_TAG(fingerprint) ((apr_uint64_t) ((fingerprint) & 0xFFFF) << 48)
+
+// Count a request for a URL in a virtual host's table of slots
+static inline void mmap_topurl_count(mmap_topurl_slot *slots, apr_size_t slot_count, const char *url, apr_off_t bytes_sent)
+{
+    apr_size_t length;
+    apr_uint32_t fingerprint = mmap_topurl_hash(url, &length);
+    apr_uint64_t ours = (apr_uint64_t) fingerprint << 32;
+    apr_uint64_t tag = MMAP_TOPURL_BYTES_TAG(fingerprint);
+    mmap_topurl_slot *slot = slots + (fingerprint % slot_count);
+    apr_uint64_t key, seen, bytes;
+
+    for (;;)
+    {
+        key = MMAP_ATOMIC_READ64(&slot->key);
+
+        if ((key >> 32) == fingerprint)
+        {
+            /* Our URL holds the slot: count it */
+            if ((key & MMAP_TOPURL_MAX_COUNT) == MMAP_TOPURL_MAX_COUNT || MMAP_ATOMIC_CAS64(&slot->key, key, key + 1))
+            {
+                break;
+            }
+        }
+        else if ((key & MMAP_TOPURL_MAX_COUNT) == 0)
+        {
+            /* Slot is free (or its URL was worn down): take it over */
+            if (MMAP_ATOMIC_CAS64(&slot->key, key, ours | 1))
+            {
+                memcpy(slot->url, url, length);
+                slot->url[length] = '\0';
+                break;
+            }
+        }
+        else if (MMAP_ATOMIC_CAS64(&slot->key, key, key - 1))
+        {
+            /* Another URL holds the slot: wear its count down */
+            return;
+        }
+    }
+
+    /* Add the bytes, starting them over if they were counted for another URL */
+    for (;;)
+    {
+        seen = MMAP_ATOMIC_READ64(&slot->bytes);
+        bytes = seen & MMAP_TOPURL_BYTES_MASK;
+
+        if ((seen & ~MMAP_TOPURL_BYTES_MASK) != tag)
+        {
+            if ((MMAP_ATOMIC_READ64(&slot->key) >> 32) != fingerprint)
+            {
+                /* Our URL lost the slot meanwhile: its bytes go with its worn down count */
+                return;
+            }
+            bytes = 0;
+        }
+
+        /* (Saturates, like the count; the provider takes the bytes every sample) */
+        bytes += (apr_uint64_t) bytes_sent & MMAP_TOPURL_BYTES_MASK;
+        if (bytes > MMAP_TOPURL_BYTES_MASK)
+        {
+            bytes = MMAP_TOPURL_BYTES_MASK;
+        }
+        if (MMAP_ATOMIC_CAS64(&slot->bytes, seen, tag | bytes))
+        {
+            return;
+        }
+    }
+}
+
+// Table of slots for a virtual host, and its results (2 * topUrlCount: top URLs by requests, plus by bytes)
+#define MMAP_TOPURL_SLOTS(server_data, vhost) \
+    ((mmap_topurl_slot *) ((char *) (server_data) + (server_data)->topUrlOffset) + ((vhost) * (server_data)->topUrlSlots))
+#define MMAP_TOPURL_RESULTS(server_data, vhost) \
+    ((mmap_topurl_result *) ((char *) (server_data) + (server_data)->topUrlResultOffset) + ((vhost) * 2 * (server_data)->topUrlCount))
+
+// Unique clients are estimated with HyperLogLog: a client address hashes to
+// one of MMAP_HLL_REGISTERS registers, which keeps the longest run of leading
+// zero bits seen in the rest of the hash (plus one). Apache only ever raises
+// interval registers; the provider takes and clears them each sample, folding
+// them into the daily registers (which only the provider writes). Standard
+// error is 1.04 / sqrt(MMAP_HLL_REGISTERS), about 3%. Registers take 2KB per
+// virtual host, so they are only allocated when CimUniqueClients is On.
+
+#define MMAP_HLL_BITS 10
+#define MMAP_HLL_REGISTERS (1 << MMAP_HLL_BITS)
+
+typedef struct
+{
+    volatile unsigned char interval[MMAP_HLL_REGISTERS];    // Registers for the current interval (written by Apache)
+    unsigned char day[MMAP_HLL_REGISTERS];                  // Registers for the current day (written by provider)
+} mmap_vhost_clients;
+
+// 64-bit hash of a client address (FNV-1a, finished with the MurmurHash3 mixer to spread the bits)
+static inline apr_uint64_t mmap_hll_hash(const char *client)
+{
+    apr_uint64_t hash = 14695981039346656037ULL;
+
+    for (; *client != '\0'; client++)
+    {
+        hash = (hash ^ (unsigned char) *client) * 1099511628211ULL;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+// Raise the register for a client address (lock-free; registers only ever increase)
+static inline void mmap_hll_add(volatile unsigned char *registers, const char *client)
+{
+    apr_uint64_t hash = mmap_hll_hash(client);
+    volatile unsigned char *reg = &registers[hash >> (64 - MMAP_HLL_BITS)];
+    apr_uint64_t rest = hash << MMAP_HLL_BITS;
+    unsigned char rank = (unsigned char) (rest ? __builtin_clzll(rest) + 1 : 64 - MMAP_HLL_BITS + 1);
+    unsigned char current;
+
+    while ((current = *reg) < rank)
+    {
+        if (__sync_bool_compare_and_swap(reg, current, rank))
+        {
+            break;
+        }
+    }
+}
+
+#define MMAP_VHOST_CLIENTS(server_data) ((mmap_vhost_clients *) ((char *) (server_data) + (server_data)->clientsOffset))
+
+// Dynamic hosts (CimDynamicHosts): requests for a host with CimDynamicHostAccounting
+// On (typically one serving many sites through mod_vhost_alias) are counted by
+// Host header instead.  Each name claims a virtual host element of its own from
+// a bounded open addressing table, lock-free: Apache probes a few slots for the
+// name, and claims the first free one if it isn't there.  Requests for names
+// that find no slot are counted in the overflow element (_Overflow).  The
+// provider evicts names that have been idle for MMAP_DYNAMIC_HOST_IDLE_SECONDS,
+// resetting the element for the next name to claim it.
+#define MMAP_MAX_DYNAMIC_HOSTS 65536
+#define MMAP_DYNAMIC_HOST_PROBES 8      // Slots probed for each name
+#define MMAP_DYNAMIC_HOST_LENGTH 64     // Longest name kept (including terminator); longer names are truncated
+#define MMAP_DYNAMIC_HOST_IDLE_SECONDS 900
+#define MMAP_DYNAMIC_HOST_EVICTING (~(apr_uint64_t) 0)  // Key of a slot the provider is evicting
+
+typedef struct
+{
+    volatile apr_uint32_t ready;        // Nonzero once the name is written (cleared on eviction)
+    volatile apr_uint32_t lastSeen;     // Time (seconds) of the most recent request
+    char name[MMAP_DYNAMIC_HOST_LENGTH];
+} mmap_dynamic_host;
+
+// The keys (name hashes, zero if the slot is free) are kept apart from the names, so probing touches one cache line
+#define MMAP_DYNAMIC_HOST_KEYS(server_data) \
+    ((volatile apr_uint64_t *) ((char *) (server_data) + (server_data)->dynamicHostOffset))
+#define MMAP_DYNAMIC_HOSTS(server_data) \
+    ((mmap_dynamic_host *) (MMAP_DYNAMIC_HOST_KEYS(server_data) + (server_data)->dynamicHostCount))
+
+static inline apr_uint64_t mmap_dynamic_host_key(const char *name)
+{
+    apr_uint64_t key = mmap_hll_hash(name);
+
+    return (key == 0 || key == MMAP_DYNAMIC_HOST_EVICTING) ? 1 : key;
+}
+
+// Find (or claim) the slot for a name; returns count if there's no room for it
+static inline apr_size_t mmap_dynamic_host_find(volatile apr_uint64_t *keys, mmap_dynamic_host *hosts, apr_size_t count,
+                                                const char *name, apr_uint32_t now)
+{
+    apr_uint64_t key = mmap_dynamic_host_key(name);
+    apr_size_t probes = count < MMAP_DYNAMIC_HOST_PROBES ? count : MMAP_DYNAMIC_HOST_PROBES;
+    apr_size_t i, slot, free_slot;
+
+    for (;;)
+    {
+        // Look for the name in every probed slot before claiming one (an earlier slot may have been evicted)
+        free_slot = count;
+        for (i = 0; i < probes; i++)
+        {
+            apr_uint64_t current;
+
+            slot = (apr_size_t) ((key + i) % count);
+            current = MMAP_ATOMIC_READ64(&keys[slot]);
+            if (current == key)
+            {
+                if (hosts[slot].lastSeen != now)
+                {
+                    hosts[slot].lastSeen = now;
+                }
+                return slot;
+            }
+            if (current == 0 && free_slot == count)
+            {
+                free_slot = slot;
+            }
+        }
+
+        if (free_slot == count)
+        {
+            return count;
+        }
+
+        // Claim the free slot; if another process claimed it first (maybe for this name), look again
+        if (MMAP_ATOMIC_CAS64(&keys[free_slot], 0, key))
+        {
+            mmap_dynamic_host *host = &hosts[free_slot];
+            apr_size_t length = strlen(name);
+
+            if (length > MMAP_DYNAMIC_HOST_LENGTH - 1)
+            {
+                length = MMAP_DYNAMIC_HOST_LENGTH - 1;
+            }
+            memcpy(host->name, name, length);
+            host->name[length] = '\0';
+            host->lastSeen = now;
+            MMAP_MEMORY_BARRIER();
+            host->ready = 1;
+            return free_slot;
+        }
+    }
+}
+
+// Process IDs of the child processes, one per scoreboard slot (zero if the slot is unused), kept
+// current by the Apache parent so the provider can account for the resources the children use
+#define MMAP_CHILD_PIDS(server_data) \
+    ((volatile apr_uint32_t *) ((char *) (server_data) + (server_data)->childPidOffset))
+
 typedef struct
 {
     /* SSL certificate information */
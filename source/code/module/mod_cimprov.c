@@ -42,6 +42,7 @@
 #include <apr_atomic.h>
 #include <apr_hash.h>
 #include <apr_strings.h>
+#include <apr_tables.h>
 
 #define CORE_PRIVATE
 
@@ -69,16 +70,6 @@ typedef enum
 
 module AP_MODULE_DECLARE_DATA cimprov_module;
 
-/*
- * Representation of an ordered array of strings
- */
-
-typedef struct string_array string_array;
-struct string_array {
-    string_array* next;                 /* Pointer to next string */
-    char string[PATH_MAX];              /* This string, either the source or destination of the the path portion of a URL */
-};
-
 /*
  * The module-wide list of hosts and some of their per-host configuration information
  */
@@ -87,11 +78,11 @@ typedef struct config_hostInfo config_hostInfo;
 struct config_hostInfo {
     config_hostInfo* next;              /* Pointer to next host information structure */
     server_rec* srec;                   /* The record of the host to which this applies */
-    char transferLogFileName[PATH_MAX]; /* Name of the transfer log file */
-    char customLogFileName[PATH_MAX];   /* Name of the custom log file */
-    char documentRoot[PATH_MAX];        /* Name of the host's document root directory */
-    string_array* aliases;              /* List of aliases for this server */
-    string_array* lastAlias;            /* Last item in *aliases, used to avoid walking to the end when adding */
+    const char* transferLogFileName;    /* Name of the transfer log file */
+    const char* customLogFileName;      /* Name of the custom log file */
+    const char* documentRoot;           /* Name of the host's document root directory */
+    apr_array_header_t* aliases;        /* Array of aliases (const char*) for this server (NULL if none) */
+    int dynamicHosts;                   /* Count requests by Host header instead (CimDynamicHostAccounting) */
 };
 
 typedef enum
@@ -109,8 +100,8 @@ typedef struct config_sslCertFile config_sslCertFile;
 struct config_sslCertFile {
     config_sslCertFile* next;           /* Pointer to next certificate structure */
     server_rec* srec;                   /* The record of the host to which this applies */
-    char certificateFileName[PATH_MAX]; /* Name of the the certificate file */
-    char hostName[MAX_HOST_NAME_LEN];   /* Name of host for this certficate (or _Default) */
+    const char* certificateFileName;    /* Name of the the certificate file */
+    const char* hostName;               /* Name of host for this certficate (or _Default) */
     apr_uint16_t port;                  /* Port of host that uses this certificate */
 };
 
@@ -122,6 +113,8 @@ typedef struct {
     /* The following items are used during configuration, and are deleted when configuration is complete */
     config_hostInfo* hostInfoList;
     config_sslCertFile* certificateFileList;
+    apr_hash_t* hostInfoHash;           /* Index of hostInfoList by server record address */
+    apr_hash_t* certificateFileHash;    /* Index of certificateFileList by certificate file name */
 } config_data;
 
 typedef struct {
@@ -129,6 +122,12 @@ typedef struct {
     int enablelogging;                  /* Should we log to the Apache error logfile? */
     int enablehystericallogging;        /* Should we log hysterically? */
     int busyrefreshfrequency;           /* How often (at minimum) do we update busy/refresh properties? */
+    int countershards;                  /* Number of per-child counter slabs (0 or 1 = one slab for all children) */
+    int tracerecords;                   /* Number of per-request trace records (0 = trace to error log instead) */
+    int topurlslots;                    /* Heavy-hitter URL slots per virtual host (0 = disabled) */
+    int topurlcount;                    /* Number of top URLs to report per virtual host */
+    int dynamichosts;                   /* Number of dynamic host slots (0 = disabled) */
+    int uniqueclients;                  /* Should we estimate unique clients of each host? */
 
     apr_shm_t *mmap_region;             /* APR's memory mapped region handle */
     mmap_server_data *server_data;      /* Pointer to server data within memory mapped region */
@@ -137,6 +136,13 @@ typedef struct {
     mmap_string_table *string_data;     /* Pointer to string table within memory mapped region */
     char *stable;                       /* Convenience pointer to the strings themselves within region */
     apr_hash_t *vhost_hash;             /* APR hash to hosts in memory mapped region */
+    mmap_vhost_counters *counter_slab;  /* Counter slab for this child process */
+    mmap_vhost_latency *latency_slab;   /* Latency histogram slab for this child process */
+    mmap_trace_ring *trace_ring;        /* Pointer to per-request trace ring within memory mapped region */
+    char *dynamic_accounting;           /* For each host element, nonzero to count its requests by Host header */
+    pid_t child_pid;                    /* PID of this child process (for trace records) */
+    apr_pool_t *process_pool;           /* Apache process pool (survives restarts; holds carried-over counters) */
+    struct region_state *regions;       /* Data regions and control block (kept in process pool) */
 
     apr_global_mutex_t *mutexMapInit;   /* APR handle to Initialization Mutex */
     apr_global_mutex_t *mutexMapRW;     /* APR handle to Read/Write Mutex */
@@ -215,6 +221,19 @@ static const char *set_hystericallogging_state(cmd_parms *cmd, void *dummy, int
     return NULL;
 }
 
+/* Set whether unique clients are estimated (HyperLogLog registers for each host) */
+static const char *set_unique_clients(cmd_parms *cmd, void *dummy, int arg)
+{
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    if (err != NULL) {
+        return err;
+    }
+
+    cfg->uniqueclients = arg;
+    return NULL;
+}
+
 static const char *set_busyrefresh_frequency(cmd_parms *cmd, void *dummy, const char *arg)
 {
     persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
@@ -227,35 +246,137 @@ static const char *set_busyrefresh_frequency(cmd_parms *cmd, void *dummy, const
     return NULL;
 }
 
-/* Find an entry for host information that matches the address of a given server record */
-static config_hostInfo* find_host_info(persist_cfg* cfg, const server_rec* srec)
+static const char *set_counter_shards(cmd_parms *cmd, void *dummy, const char *arg)
 {
-    config_hostInfo* s;
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    int shards;
+    if (err != NULL) {
+        return err;
+    }
 
-    for (s = cfg->configData->hostInfoList; s != NULL; s = s->next)
+    shards = atoi(arg);
+    if (shards < 0 || shards > MMAP_MAX_COUNTER_SHARDS)
     {
-        if (s->srec == srec)
-        {
-            return s;
-        }
+        return apr_psprintf(cmd->pool, "CimCounterShards must be between 0 and %d", MMAP_MAX_COUNTER_SHARDS);
     }
 
+    cfg->countershards = shards;
     return NULL;
 }
 
-/* Find an entry for a host and port in the list of server certificate files */
-static config_sslCertFile* find_certificate_file(persist_cfg* cfg, const char* certificateFile)
+static const char *set_trace_records(cmd_parms *cmd, void *dummy, const char *arg)
+{
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    int records;
+    if (err != NULL) {
+        return err;
+    }
+
+    records = atoi(arg);
+    if (records < 0 || records > MMAP_MAX_TRACE_RECORDS)
+    {
+        return apr_psprintf(cmd->pool, "CimTraceRecords must be between 0 and %d", MMAP_MAX_TRACE_RECORDS);
+    }
+
+    cfg->tracerecords = records;
+    return NULL;
+}
+
+static const char *set_topurl_slots(cmd_parms *cmd, void *dummy, const char *arg)
+{
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    int slots;
+    if (err != NULL) {
+        return err;
+    }
+
+    slots = atoi(arg);
+    if (slots < 0 || slots > MMAP_MAX_TOPURL_SLOTS)
+    {
+        return apr_psprintf(cmd->pool, "CimTopUrlSlots must be between 0 and %d", MMAP_MAX_TOPURL_SLOTS);
+    }
+
+    cfg->topurlslots = slots;
+    return NULL;
+}
+
+static const char *set_topurl_count(cmd_parms *cmd, void *dummy, const char *arg)
+{
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    int count;
+    if (err != NULL) {
+        return err;
+    }
+
+    count = atoi(arg);
+    if (count < 1 || count > MMAP_MAX_TOPURL_SLOTS)
+    {
+        return apr_psprintf(cmd->pool, "CimTopUrlCount must be between 1 and %d", MMAP_MAX_TOPURL_SLOTS);
+    }
+
+    cfg->topurlcount = count;
+    return NULL;
+}
+
+static const char *set_dynamic_hosts(cmd_parms *cmd, void *dummy, const char *arg)
+{
+    persist_cfg *cfg = (persist_cfg *) ap_get_module_config(cmd->server->module_config, &cimprov_module);
+    const char *err = ap_check_cmd_context(cmd, GLOBAL_ONLY);
+    int slots;
+    if (err != NULL) {
+        return err;
+    }
+
+    slots = atoi(arg);
+    if (slots < 0 || slots > MMAP_MAX_DYNAMIC_HOSTS)
+    {
+        return apr_psprintf(cmd->pool, "CimDynamicHosts must be between 0 and %d", MMAP_MAX_DYNAMIC_HOSTS);
+    }
+
+    cfg->dynamichosts = slots;
+    return NULL;
+}
+
+/* Find an entry for host information that matches the address of a given server record */
+static config_hostInfo* find_host_info(persist_cfg* cfg, const server_rec* srec)
 {
-    config_sslCertFile* certInfo;
+    return (config_hostInfo*)apr_hash_get(cfg->configData->hostInfoHash, &srec, sizeof(srec));
+}
+
+/* Find the entry for host information for a given server record, creating it if there is none */
+static config_hostInfo* find_or_add_host_info(persist_cfg* cfg, server_rec* srec)
+{
+    config_hostInfo* hostInfo = find_host_info(cfg, srec);
 
-    for (certInfo = cfg->configData->certificateFileList; certInfo != NULL; certInfo = certInfo->next)
+    if (hostInfo == NULL)
     {
-        if (apr_strnatcmp(certInfo->certificateFileName, certificateFile) == 0)
+        /* if this host has no entry, create one in the configuration pool */
+        hostInfo = (config_hostInfo*)apr_pcalloc(cfg->configPool, sizeof (config_hostInfo));
+        if (hostInfo == NULL)
         {
-            return certInfo;
+            return NULL;
         }
+
+        hostInfo->next = cfg->configData->hostInfoList;
+        hostInfo->srec = srec;
+        cfg->configData->hostInfoList = hostInfo;
+
+        /* Note: The key is the server_rec pointer value, kept in the item so it lives as long as the hash */
+        apr_hash_set(cfg->configData->hostInfoHash, &hostInfo->srec, sizeof(hostInfo->srec), hostInfo);
     }
-    return NULL;
+
+    return hostInfo;
+}
+
+/* Find an entry for a host and port in the list of server certificate files */
+/* (Names match exactly: apr_strnatcmp, used before, ignores white space, which made distinct files one) */
+static config_sslCertFile* find_certificate_file(persist_cfg* cfg, const char* certificateFile)
+{
+    return (config_sslCertFile*)apr_hash_get(cfg->configData->certificateFileHash, certificateFile, APR_HASH_KEY_STRING);
 }
 
 /* Add data to the host information item for a given server record */
@@ -270,34 +391,25 @@ static const char *set_host_info(cmd_parms *cmd, void *dummy, host_info_type typ
         return err;
     }
 
-    hostInfo = find_host_info(g_persistConfig, s);
+    hostInfo = find_or_add_host_info(g_persistConfig, s);
     if (hostInfo == NULL)
     {
-        /* if this host has no entry, create one by creating a pool and an item in the pool */
-        hostInfo = (config_hostInfo*)apr_pcalloc(g_persistConfig->configPool, sizeof (config_hostInfo));
-        if (hostInfo == NULL)
-        {
-            display_error(g_persistConfig, "cimprov: unable to allocate memory for file name items", APR_ENOMEM, 1);
-            return "cimprov: unable to allocate memory for file name items";
-        }
-
-        hostInfo->next = g_persistConfig->configData->hostInfoList;
-        hostInfo->srec = s;
-        g_persistConfig->configData->hostInfoList = hostInfo;
+        display_error(g_persistConfig, "cimprov: unable to allocate memory for file name items", APR_ENOMEM, 1);
+        return "cimprov: unable to allocate memory for file name items";
     }
 
-    /* Set the appropriate data element in the list item */
+    /* Set the appropriate data element in the list item (strings are kept at their exact length) */
     if (type == DOCUMENT_ROOT)
     {
-        apr_cpystrn(hostInfo->documentRoot, value1, sizeof hostInfo->documentRoot);
+        hostInfo->documentRoot = apr_pstrdup(g_persistConfig->configPool, value1);
     }
     else if (type == TRANSFER_LOG_FILE_NAME)
     {
-        apr_cpystrn(hostInfo->transferLogFileName, value1, sizeof hostInfo->transferLogFileName);
+        hostInfo->transferLogFileName = apr_pstrdup(g_persistConfig->configPool, value1);
     }
     else if (type == CUSTOM_LOG_FILE_NAME)
     {
-        apr_cpystrn(hostInfo->customLogFileName, value1, sizeof hostInfo->customLogFileName);
+        hostInfo->customLogFileName = apr_pstrdup(g_persistConfig->configPool, value1);
     }
     else
     {
@@ -326,6 +438,28 @@ static const char *set_custom_log_file(cmd_parms *cmd, void *dummy, const char *
     return set_host_info(cmd, dummy, CUSTOM_LOG_FILE_NAME, arg1, NULL);
 }
 
+/* Count requests for the host by their Host header (for mass virtual hosting) */
+static const char *set_dynamic_host_accounting(cmd_parms *cmd, void *dummy, int arg)
+{
+    config_hostInfo* hostInfo;
+    const char *err = ap_check_cmd_context(cmd, NOT_IN_DIR_LOC_FILE);
+
+    if (err != NULL)
+    {
+        return err;
+    }
+
+    hostInfo = find_or_add_host_info(g_persistConfig, cmd->server);
+    if (hostInfo == NULL)
+    {
+        display_error(g_persistConfig, "cimprov: unable to allocate memory for file name items", APR_ENOMEM, 1);
+        return "cimprov: unable to allocate memory for file name items";
+    }
+
+    hostInfo->dynamicHosts = arg;
+    return NULL;
+}
+
 /* Take a list of server alias names for the virtual host */
 static const char *set_server_alias(cmd_parms *cmd, void *dummy, const char *arg)
 {
@@ -336,45 +470,21 @@ static const char *set_server_alias(cmd_parms *cmd, void *dummy, const char *arg
         return "ServerAlias only used in <VirtualHost>";
     }
 
-    hostInfo = find_host_info(g_persistConfig, s);
+    hostInfo = find_or_add_host_info(g_persistConfig, s);
     if (hostInfo == NULL)
     {
-        /* if this host has no entry, create one by creating a pool and an item in the pool */
-        hostInfo = (config_hostInfo*)apr_pcalloc(g_persistConfig->configPool, sizeof (config_hostInfo));
-        if (hostInfo == NULL)
-        {
-            display_error(g_persistConfig, "cimprov: unable to allocate memory for file name items", APR_ENOMEM, 1);
-            return "cimprov: unable to allocate memory for file name items";
-        }
+        display_error(g_persistConfig, "cimprov: unable to allocate memory for file name items", APR_ENOMEM, 1);
+        return "cimprov: unable to allocate memory for file name items";
+    }
 
-        hostInfo->next = g_persistConfig->configData->hostInfoList;
-        hostInfo->srec = s;
-        g_persistConfig->configData->hostInfoList = hostInfo;
+    if (hostInfo->aliases == NULL)
+    {
+        hostInfo->aliases = apr_array_make(g_persistConfig->configPool, 2, sizeof(const char*));
     }
 
     while (*arg) {
-        string_array* alias;
-        char *name = ap_getword_conf(g_persistConfig->configPool, &arg);
-
-        /* Allocate the string in temporary memory */
-        alias = (string_array*) apr_pcalloc(g_persistConfig->configPool, sizeof (string_array));
-        if (alias == NULL)
-        {
-            display_error(g_persistConfig, "cimprov: unable to allocate memory for server alias item", APR_ENOMEM, 1);
-            return "cimprov: unable to allocate memory for server alias item";
-        }
-
-        if (hostInfo->aliases == NULL)
-        {
-            hostInfo->aliases = alias;
-        }
-        else
-        {
-            hostInfo->lastAlias->next = alias;
-        }        
-        hostInfo->lastAlias = alias;
-
-        apr_cpystrn(alias->string, name, PATH_MAX);    /* populate the strings */
+        /* ap_getword_conf allocates the name (at its exact length) in temporary memory */
+        APR_ARRAY_PUSH(hostInfo->aliases, const char*) = ap_getword_conf(g_persistConfig->configPool, &arg);
     }
 
     return NULL;
@@ -412,13 +522,14 @@ static const char *set_server_certificate_file(cmd_parms *cmd, void *dummy, cons
         /* populate the item */
         certFileInfo->srec = s;
         certFileInfo->next = g_persistConfig->configData->certificateFileList;
-        apr_cpystrn(certFileInfo->certificateFileName, arg, sizeof certFileInfo->certificateFileName);
+        certFileInfo->certificateFileName = apr_pstrdup(g_persistConfig->configPool, arg);
 
         /* add the new entry to the linked list */
         g_persistConfig->configData->certificateFileList = certFileInfo;
+        apr_hash_set(g_persistConfig->configData->certificateFileHash, certFileInfo->certificateFileName, APR_HASH_KEY_STRING, certFileInfo);
 
         /* if this is the first use of this certificate file, add the host and port to the list within the item */
-        apr_cpystrn(certFileInfo->hostName, hostName, sizeof certFileInfo->hostName);
+        certFileInfo->hostName = apr_pstrdup(g_persistConfig->configPool, hostName);
         certFileInfo->port = s->port;
     }
 
@@ -434,7 +545,29 @@ static const command_rec cimprov_module_cmds[] =
       "Note that CimSetLogging must be On for hysterical output to display properly."),
     AP_INIT_TAKE1("CimBusyRefreshFrequency", set_busyrefresh_frequency, NULL, RSRC_CONF,
       "Set the default busy refresh frequency for busy/idle thread counts and CPU load. "
-      "Default = 60 seconds, -1 = Disabled, 0 = Update on each request (very high overhead)."),
+      "Default = 60 seconds, -1 = Disabled, 0 = Update as often as possible (about once a second)."),
+    AP_INIT_TAKE1("CimCounterShards", set_counter_shards, NULL, RSRC_CONF,
+      "Set the number of counter slabs shared out among child processes to reduce contention. "
+      "Default = 0 (all children share one slab of counters). "
+      "Limited to the number of child processes, and to 256 MB of counter and latency slabs."),
+    AP_INIT_TAKE1("CimTraceRecords", set_trace_records, NULL, RSRC_CONF,
+      "Set the number of per-request trace records kept in shared memory when CimSetLogging is On "
+      "(rounded up to a power of two). Default = 4096, 0 = Log each request to the error log instead."),
+    AP_INIT_TAKE1("CimTopUrlSlots", set_topurl_slots, NULL, RSRC_CONF,
+      "Set the number of heavy-hitter URL slots kept per virtual host (each uses about 150 bytes). "
+      "Default = 0 (top URLs are not tracked)."),
+    AP_INIT_TAKE1("CimTopUrlCount", set_topurl_count, NULL, RSRC_CONF,
+      "Set the number of top URLs (by requests and by bytes) reported per virtual host. "
+      "Default = 10 (limited to CimTopUrlSlots)."),
+    AP_INIT_FLAG("CimUniqueClients", set_unique_clients, NULL, RSRC_CONF,
+      "\"On\" to estimate the unique clients of each host (uses 2KB of shared memory per host), "
+      "\"Off\" to disable. Default = Off."),
+    AP_INIT_TAKE1("CimDynamicHosts", set_dynamic_hosts, NULL, RSRC_CONF,
+      "Set the number of dynamic host slots, for hosts with CimDynamicHostAccounting On (each uses about as "
+      "much shared memory as a virtual host). Default = 0 (requests are counted by virtual host only)."),
+    AP_INIT_FLAG("CimDynamicHostAccounting", set_dynamic_host_accounting, NULL, RSRC_CONF,
+      "\"On\" to count requests for this host by their Host header (in CimDynamicHosts slots), "
+      "\"Off\" to count them for the host itself. Default = Off."),
     AP_INIT_TAKE1("DocumentRoot", set_document_root, NULL, RSRC_CONF,
       "Set the name of the document root directory for the host."),
     AP_INIT_TAKE1("TransferLog", set_transfer_log_file, NULL, RSRC_CONF,
@@ -573,81 +706,335 @@ static apr_status_t module_mutex_initialize(persist_cfg *cfg, apr_pool_t *pool)
     return APR_SUCCESS;
 }
 
+/*
+ * Counters carried forward across restarts.  Apache destroys the region when
+ * it clears the configuration pool on restart (graceful or not), so the totals,
+ * the provider's prior values and the daily unique client registers are saved
+ * in the process pool first, then restored into the new region, matching
+ * virtual hosts by instance ID.
+ *
+ * The totals are those as of the save.  On a graceful restart, old generation
+ * children carry on counting in the old region until they finish the requests
+ * they are serving; those requests are counted in the old region only, so
+ * they are missing from the carried totals.
+ */
+
+#define CARRYOVER_KEY "MSFT_cimprov_carryover"
+
+typedef struct
+{
+    mmap_vhost_counters counters;       /* Totals, summed across counter slabs */
+    mmap_vhost_statistics statistics;   /* Prior totals and rates computed by the provider */
+    unsigned char *clientsDay;          /* Daily unique client registers (NULL if not kept) */
+} carryover_vhost;
+
+typedef struct
+{
+    apr_pool_t *pool;                   /* Subpool of the process pool holding this state */
+    apr_hash_t *vhosts;                 /* Instance ID -> carryover_vhost */
+    apr_uint64_t priorCpuUtilization;
+    apr_uint32_t percentCPU;
+    apr_uint32_t idleWorkers;
+    apr_uint32_t busyWorkers;
+    apr_int32_t clientsDay;             /* Day of the daily unique client registers */
+} carryover_state;
+
+static void carryover_discard(apr_pool_t *process_pool)
+{
+    carryover_state *state = NULL;
+
+    apr_pool_userdata_get((void **) &state, CARRYOVER_KEY, process_pool);
+    if (NULL != state)
+    {
+        apr_pool_userdata_set(NULL, CARRYOVER_KEY, apr_pool_cleanup_null, process_pool);
+        apr_pool_destroy(state->pool);
+    }
+}
+
+static void add_vhost_counters(mmap_vhost_counters *sum, mmap_vhost_counters *counters)
+{
+    apr_size_t i;
+
+    sum->requestsTotal += MMAP_ATOMIC_READ64(&counters->requestsTotal);
+    sum->requestsBytes += MMAP_ATOMIC_READ64(&counters->requestsBytes);
+    for (i = 0; i < MMAP_RESPONSE_COUNT; i++)
+    {
+        sum->responses[i] += MMAP_ATOMIC_READ64(&counters->responses[i]);
+    }
+}
+
+static apr_uint64_t subtract_counter(apr_uint64_t total, apr_uint64_t part)
+{
+    return total > part ? total - part : 0;
+}
+
+static void sum_vhost_counters(mmap_server_data *server_data, apr_size_t element, mmap_vhost_counters *counters)
+{
+    apr_size_t shard;
+
+    memset(counters, 0, sizeof(*counters));
+    for (shard = 0; shard < server_data->counterShardCount; shard++)
+    {
+        add_vhost_counters(counters, &MMAP_COUNTER_SLAB(server_data, shard)[element]);
+    }
+}
+
+static void carryover_save(persist_cfg *cfg)
+{
+    mmap_vhost_statistics *stats = MMAP_VHOST_STATISTICS(cfg->vhost_data);
+    int derived_total = cfg->server_data->counterShardCount > 1;
+    carryover_vhost *total = NULL;
+    carryover_state *state;
+    apr_pool_t *pool;
+    apr_size_t i;
+
+    if (NULL == cfg->process_pool || APR_SUCCESS != apr_pool_create(&pool, cfg->process_pool))
+    {
+        return;
+    }
+
+    state = (carryover_state *) apr_pcalloc(pool, sizeof(carryover_state));
+    state->pool = pool;
+    state->vhosts = apr_hash_make(pool);
+    state->priorCpuUtilization = cfg->server_data->priorCpuUtilization;
+    state->percentCPU = cfg->server_data->percentCPU;
+    state->idleWorkers = cfg->server_data->idleWorkers;
+    state->busyWorkers = cfg->server_data->busyWorkers;
+    state->clientsDay = cfg->server_data->clientsDay;
+
+    for (i = 0; i < cfg->vhost_data->count; i++)
+    {
+        carryover_vhost *vhost;
+
+        /* Dynamic hosts have no instance ID of their own, and aren't carried forward */
+        if (0 == cfg->vhost_data->vhosts[i].instanceIDOffset)
+        {
+            continue;
+        }
+
+        vhost = (carryover_vhost *) apr_palloc(pool, sizeof(carryover_vhost));
+
+        /* With several counter slabs, _Total is the sum of the other hosts and the evicted dynamic hosts */
+        if (derived_total && 0 == i)
+        {
+            memset(&vhost->counters, 0, sizeof(mmap_vhost_counters));
+            add_vhost_counters(&vhost->counters, MMAP_EVICTED_COUNTERS(cfg->server_data));
+            total = vhost;
+        }
+        else
+        {
+            sum_vhost_counters(cfg->server_data, i, &vhost->counters);
+        }
+        memcpy(&vhost->statistics, &stats[i], sizeof(mmap_vhost_statistics));
+        vhost->clientsDay = NULL;
+        if (cfg->server_data->clientsCount)
+        {
+            vhost->clientsDay = apr_pmemdup(pool, MMAP_VHOST_CLIENTS(cfg->server_data)[i].day, MMAP_HLL_REGISTERS);
+        }
+        apr_hash_set(state->vhosts, apr_pstrdup(pool, cfg->stable + cfg->vhost_data->vhosts[i].instanceIDOffset),
+                     APR_HASH_KEY_STRING, vhost);
+    }
+    if (NULL != total)
+    {
+        for (i = 1; i < cfg->vhost_data->count; i++)
+        {
+            mmap_vhost_counters counters;
+
+            sum_vhost_counters(cfg->server_data, i, &counters);
+            add_vhost_counters(&total->counters, &counters);
+        }
+    }
+
+    /* Discard anything saved earlier and never restored */
+    carryover_discard(cfg->process_pool);
+    apr_pool_userdata_set(state, CARRYOVER_KEY, apr_pool_cleanup_null, cfg->process_pool);
+}
+
+static void carryover_restore(persist_cfg *cfg, apr_pool_t *ptemp)
+{
+    mmap_vhost_statistics *stats = MMAP_VHOST_STATISTICS(cfg->vhost_data);
+    mmap_vhost_counters *slab = MMAP_COUNTER_SLAB(cfg->server_data, 0);
+    int derived_total = cfg->server_data->counterShardCount > 1;
+    carryover_vhost *total = NULL;
+    carryover_state *state = NULL;
+    apr_size_t i, restored = 0;
+    char *text;
+
+    apr_pool_userdata_get((void **) &state, CARRYOVER_KEY, cfg->process_pool);
+    if (NULL == state)
+    {
+        return;
+    }
+
+    cfg->server_data->priorCpuUtilization = state->priorCpuUtilization;
+    cfg->server_data->percentCPU = state->percentCPU;
+    cfg->server_data->idleWorkers = state->idleWorkers;
+    cfg->server_data->busyWorkers = state->busyWorkers;
+    cfg->server_data->clientsDay = state->clientsDay;
+
+    /* Totals go into the first counter slab; other slabs start at zero */
+    for (i = 0; i < cfg->vhost_data->count; i++)
+    {
+        const char *instanceID = cfg->stable + cfg->vhost_data->vhosts[i].instanceIDOffset;
+        carryover_vhost *vhost = (carryover_vhost *) apr_hash_get(state->vhosts, instanceID, APR_HASH_KEY_STRING);
+
+        if (NULL == vhost || 0 == cfg->vhost_data->vhosts[i].instanceIDOffset)
+        {
+            continue;
+        }
+
+        if (derived_total && 0 == i)
+        {
+            total = vhost;
+        }
+        else
+        {
+            memcpy(&slab[i], &vhost->counters, sizeof(mmap_vhost_counters));
+        }
+        memcpy(&stats[i], &vhost->statistics, sizeof(mmap_vhost_statistics));
+        if (NULL != vhost->clientsDay && cfg->server_data->clientsCount)
+        {
+            memcpy(MMAP_VHOST_CLIENTS(cfg->server_data)[i].day, vhost->clientsDay, MMAP_HLL_REGISTERS);
+        }
+        apr_hash_set(state->vhosts, instanceID, APR_HASH_KEY_STRING, NULL);   /* Match each entry only once */
+        restored++;
+    }
+
+    /* With several counter slabs, _Total is derived from the virtual hosts, so the counts of hosts that */
+    /* weren't carried forward (removed from the configuration, or dynamic) are kept with those of evicted */
+    /* dynamic hosts.  _Total then carries on from its totals (and prior values) as of the save. */
+    if (NULL != total)
+    {
+        mmap_vhost_counters *evicted = MMAP_EVICTED_COUNTERS(cfg->server_data);
+        mmap_vhost_counters hosts;
+        apr_size_t r;
+
+        memset(&hosts, 0, sizeof(hosts));
+        for (i = 1; i < cfg->vhost_data->count; i++)
+        {
+            add_vhost_counters(&hosts, &slab[i]);
+        }
+
+        evicted->requestsTotal = subtract_counter(total->counters.requestsTotal, hosts.requestsTotal);
+        evicted->requestsBytes = subtract_counter(total->counters.requestsBytes, hosts.requestsBytes);
+        for (r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            evicted->responses[r] = subtract_counter(total->counters.responses[r], hosts.responses[r]);
+        }
+    }
+
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: carried counters forward for %pS of %pS virtual hosts",
+                        &restored, &cfg->vhost_data->count);
+    display_error(cfg, text, 0, 0);
+
+    carryover_discard(cfg->process_pool);
+}
+
 static apr_status_t mmap_region_cleanup(void *configuration)
 {
     persist_cfg *cfg = (persist_cfg *) configuration;
-    apr_status_t status;
 
     display_error(cfg, "cimprov: mmap_region_cleanup invoked", 0, 0);
 
-    if (APR_SUCCESS != (status = apr_shm_destroy(cfg->mmap_region)))
+    /* Save counters to carry forward into the next region.  The region itself lives on (in the */
+    /* process pool) until the next one is published, and is then retired after a grace period. */
+    /* (Only the process that built the region does so; child processes may run this cleanup at exit) */
+    if (NULL != cfg->server_data && cfg->server_data->serverPid == getpid())
     {
-        display_error(cfg, "cimprov: mmap_region_cleanup failed to destroy shared region", status, 1);
-        return status;
+        carryover_save(cfg);
+        cfg->server_data = NULL;
     }
 
     return APR_SUCCESS;
 }
 
-/* A simple base-64 encoding of a 2-byte integer into 3 printable characters.
- * This is not the base-64 encoding used in MIME, because MIME uses a table of
- * legal output characters to avoid most punctuation; that is not needed here.
+/*
+ * Builder for the shared memory string table.  The string table is built in
+ * temporary (arena) memory in a single pass over the configuration, and copied
+ * into the region once its size is known.  Capacity doubles as needed, so the
+ * cost is linear in the size of the table.  Strings are interned, so that the
+ * log paths, document roots and so on shared by many hosts are stored once.
  */
 
-static char s_encode_buf[4];
-
-static char* encode64(apr_uint16_t value)
+typedef struct
+{
+    apr_pool_t* pool;                   /* Pool the table is allocated from */
+    char* data;                         /* The strings */
+    apr_size_t length;                  /* Length of the table so far */
+    apr_size_t capacity;                /* Space allocated for the table */
+    apr_hash_t* interned;               /* Offset (plus one) of each string in the table, by value */
+} string_builder;
+
+static void string_builder_init(string_builder* sb, apr_pool_t* pool, apr_size_t capacity)
 {
-    s_encode_buf[0] = (char)(((value >> 12) & 0x000F) + 0x0030);
-    s_encode_buf[1] = (char)(((value >>  6) & 0x003F) + 0x0030);
-    s_encode_buf[2] = (char)(( value        & 0x003F) + 0x0030);
-    s_encode_buf[3] = '\0';
-    return s_encode_buf;
+    sb->pool = pool;
+    sb->data = apr_palloc(pool, capacity);
+    sb->length = 0;
+    sb->capacity = capacity;
+    sb->interned = NULL;
 }
 
-/* Terminate a data string array in the shared memory string table */
+static void string_table_init(string_builder* sb, apr_pool_t* pool, apr_size_t capacity)
+{
+    string_builder_init(sb, pool, capacity);
+    sb->interned = apr_hash_make(pool);
+
+    /* Reserve a single empty string at the beginning of the table, so that zero offsets result in empty strings */
+    *sb->data = '\0';
+    sb->length = 1;
+}
 
-static void terminate_data_string_array(
-    char* const string_table,
-    apr_size_t* pos)
+static void string_builder_append(string_builder* sb, const char* string, apr_size_t len)
 {
-    if (string_table != NULL)
+    if (sb->length + len > sb->capacity)
     {
-        *(string_table + *pos) = '\0';
-    }
+        char* data;
 
-    *pos += 1;
+        while (sb->length + len > sb->capacity)
+        {
+            sb->capacity *= 2;
+        }
+        data = apr_palloc(sb->pool, sb->capacity);
+        memcpy(data, sb->data, sb->length);
+        sb->data = data;
+    }
 
-    return;
+    memcpy(sb->data + sb->length, string, len);
+    sb->length += len;
 }
 
-/* Add a string to the shared memory string table */
+/* Add a string to the shared memory string table (or find the copy already there) */
 
 static void add_data_string(
-    char* const string_table,
-    apr_size_t* pos,
+    string_builder* sb,
     const char* string,
     apr_size_t* offset)
 {
     if (string != NULL && *string != '\0')
     {
-        size_t len = strlen(string) + 1;
+        size_t len = strlen(string);
 
-        if (len > PATH_MAX)
+        apr_size_t found;
+
+        if (len > PATH_MAX - 1)
         {
-            len = PATH_MAX;
+            len = PATH_MAX - 1;
         }
-        if (string_table != NULL)
+
+        /* Note: The table moves as it grows, so interned strings are keyed on a copy */
+        found = (apr_size_t)apr_hash_get(sb->interned, string, len);
+        if (found == 0)
         {
-            apr_cpystrn(string_table + *pos, string, len);
+            found = sb->length + 1;
+            apr_hash_set(sb->interned, apr_pstrmemdup(sb->pool, string, len), len, (void*)found);
+            string_builder_append(sb, string, len);
+            string_builder_append(sb, "", 1);
         }
 
         if (offset != NULL)
         {
-            *offset = (apr_size_t)*pos;
+            *offset = found - 1;
         }
-
-        *pos += len;
     }
     else
     {
@@ -659,11 +1046,51 @@ static void add_data_string(
     return;
 }
 
+/* Append to a string being built, truncating it at limit characters (limit is reduced by the length appended) */
+
+static void string_builder_append_limited(string_builder* sb, const char* string, apr_size_t len, apr_size_t* limit)
+{
+    if (len > *limit)
+    {
+        len = *limit;
+    }
+
+    string_builder_append(sb, string, len);
+    *limit -= len;
+}
+
+/* Add the InstanceID that uniquely identifies a host ("name,address:port,...") to the string table */
+/* (truncated, like other strings in the table, to PATH_MAX - 1 characters) */
+
+static apr_size_t add_instance_id(
+    string_builder* sb,
+    const server_rec* srec)
+{
+    apr_size_t offset = sb->length;
+    apr_size_t limit = PATH_MAX - 1;
+    const char* name = srec->server_hostname != NULL ? srec->server_hostname : "_default_";
+    server_addr_rec* addrs;
+
+    string_builder_append_limited(sb, name, strlen(name), &limit);
+    for (addrs = srec->addrs; addrs != NULL; addrs = addrs->next)
+    {
+        const char* host = addrs->host_addr->hostname != NULL ? addrs->host_addr->hostname : "_default_";
+        char port[16];
+        int len = apr_snprintf(port, sizeof(port), ":%d", (unsigned int)addrs->host_addr->port);
+
+        string_builder_append_limited(sb, ",", 1, &limit);
+        string_builder_append_limited(sb, host, strlen(host), &limit);
+        string_builder_append_limited(sb, port, len, &limit);
+    }
+    string_builder_append(sb, "", 1);
+
+    return offset;
+}
+
 /* Get the data for the server */
 static apr_status_t collect_server_data(
     mmap_server_data* server_data,
-    char* const string_table,
-    apr_size_t* string_table_len,
+    string_builder* sb,
     module* top_module,
     apr_size_t module_count,
     const char* config_file,
@@ -682,34 +1109,19 @@ static apr_status_t collect_server_data(
     const char* server_root = ap_server_root;
 
     /* Add the name of the configuration file */
-    add_data_string(string_table,
-               string_table_len,
-               config_file,
-               server_data != NULL ? &server_data->configFileOffset : NULL);
+    add_data_string(sb, config_file, &server_data->configFileOffset);
 
     /* Add the server root directory */
-    add_data_string(string_table,
-               string_table_len,
-               server_root,
-               server_data != NULL ? &server_data->serverRootOffset : NULL);
+    add_data_string(sb, server_root, &server_data->serverRootOffset);
 
     /* Add the Apache server version */
-    add_data_string(string_table,
-                    string_table_len,
-                    version,
-                    server_data != NULL ? &server_data->serverVersionOffset : NULL);
+    add_data_string(sb, version, &server_data->serverVersionOffset);
 
     /* Add the host computer's ID */
-    add_data_string(string_table,
-                    string_table_len,
-                    server_hostname,
-                    server_data != NULL ? &server_data->serverIDOffset : NULL);
+    add_data_string(sb, server_hostname, &server_data->serverIDOffset);
 
-    if (server_data != NULL)
-    {
-        server_data->moduleCount = module_count;
-        server_data->serverPid = getpid();
-    }
+    server_data->moduleCount = module_count;
+    server_data->serverPid = getpid();
 
     /* Add each of the loaded modules */
     index = 0;
@@ -719,10 +1131,7 @@ static apr_status_t collect_server_data(
         {
             return APR_EMISMATCH;
         }
-        add_data_string(string_table,
-                   string_table_len,
-                   modp->name,
-                   server_data != NULL ? &server_data->modules[index].moduleNameOffset : NULL);
+        add_data_string(sb, modp->name, &server_data->modules[index].moduleNameOffset);
         index++;
     }
 
@@ -739,13 +1148,30 @@ static void merge_data_strings(apr_size_t* toOffset, apr_size_t fromOffset)
     return;
 }
 
-/* Get the data for the hosts */
-static apr_status_t collect_vhost_data(
-    mmap_vhost_data* vhost_data,
-    char* const string_table,
-    apr_size_t* string_table_len,
+/* Add a list formatted for display ("a, b, c") to the string table, built in a reusable scratch buffer */
+static void add_formatted_item(string_builder* scratch, const char* item)
+{
+    if (scratch->length != 0)
+    {
+        string_builder_append(scratch, ", ", 2);
+    }
+    string_builder_append(scratch, item, strlen(item));
+}
+
+static void add_formatted_list(string_builder* sb, string_builder* scratch, apr_size_t* offset)
+{
+    string_builder_append(scratch, "", 1);
+    add_data_string(sb, scratch->data, offset);
+    scratch->length = 0;
+}
+
+/* Get the data for the hosts */
+static apr_status_t collect_vhost_data(
+    mmap_vhost_data* vhost_data,
+    string_builder* sb,
+    apr_array_header_t* addresses,      /* Addresses (mmap_vhost_address) of all hosts */
+    apr_array_header_t* aliases,        /* Aliases (string table offsets) of all hosts */
     persist_cfg* cfg,
-    apr_pool_t* ptemp,
     apr_hash_t* vhost_hash,             /* APR hash to hosts in memory mapped region */
     const server_rec* head,
     apr_size_t vhost_count)
@@ -753,147 +1179,110 @@ static apr_status_t collect_vhost_data(
     const server_rec* srec;
     apr_size_t vhost_element;
     apr_size_t physical_host_element;
-    int first;
+    string_builder scratch;             /* Formatted lists, as they're built */
+    string_builder ports;
 
-    if (vhost_data != NULL)
-    {
-        vhost_data->count = vhost_count;
-    }
+    string_builder_init(&scratch, sb->pool, 256);
+    string_builder_init(&ports, sb->pool, 64);
+
+    vhost_data->count = vhost_count;
 
     /*
      * VHost [0] reserved for _Total
      * VHost [1] reserved for _Unknown
      */
 
-    add_data_string(string_table,
-                    string_table_len,
-                    "_Total",
-                    vhost_data != NULL ? &vhost_data->vhosts[0].hostNameOffset : NULL);
+    add_data_string(sb, "_Total", &vhost_data->vhosts[0].hostNameOffset);
+    add_data_string(sb, "_Unknown", &vhost_data->vhosts[1].hostNameOffset);
 
-    add_data_string(string_table,
-                    string_table_len,
-                    "_Unknown",
-                    vhost_data != NULL ? &vhost_data->vhosts[1].hostNameOffset : NULL);
-
-    if (vhost_data != NULL)
-    {
-        /* Match instanceID with hostName for _Total and _Unknown */
-        vhost_data->vhosts[0].instanceIDOffset = vhost_data->vhosts[0].hostNameOffset;
-        vhost_data->vhosts[1].instanceIDOffset = vhost_data->vhosts[1].hostNameOffset;
-    }
+    /* Match instanceID with hostName for _Total and _Unknown */
+    vhost_data->vhosts[0].instanceIDOffset = vhost_data->vhosts[0].hostNameOffset;
+    vhost_data->vhosts[1].instanceIDOffset = vhost_data->vhosts[1].hostNameOffset;
 
     vhost_element = 2;
     physical_host_element = vhost_count;    /* initialize to an invalid value */
     for (srec = head; srec != NULL; srec = srec->next)
     {
-        char* instanceHost;
+        mmap_vhost_elements* vhost = &vhost_data->vhosts[vhost_element];
         server_addr_rec* addrs;
         config_hostInfo* hostInfo;
+        const server_rec** key;
 
         /* Create the InstanceID for uniquely tracking this host */
-        instanceHost = apr_pstrdup(ptemp, srec->server_hostname != NULL ? srec->server_hostname : "_default_");
-        for (addrs = srec->addrs; addrs != NULL; addrs = addrs->next)
-        {
-            char *nextEntry = apr_psprintf(ptemp,
-                                           ",%s:%d",
-                                           addrs->host_addr->hostname != NULL ? addrs->host_addr->hostname : "_default_",
-                                           (unsigned int)addrs->host_addr->port);
-            instanceHost = apr_pstrcat(ptemp, instanceHost, nextEntry, NULL);
-        }
-        add_data_string(string_table,
-                        string_table_len,
-                        instanceHost,
-                        vhost_data != NULL ? &vhost_data->vhosts[vhost_element].instanceIDOffset : NULL);
+        vhost->instanceIDOffset = add_instance_id(sb, srec);
 
         /* Create the hash table based on the server record address */
-        /* Note: It would be nice to use server_rec pointer, but that didn't work properly */
-        if (vhost_data != NULL)
-        {
-            apr_hash_set(vhost_hash, apr_psprintf(ptemp, "%pp", srec), APR_HASH_KEY_STRING, (void*)vhost_element);
-        }
+        /* Note: The key is the binary value of the server_rec pointer (not the pointer's
+         * address), so it must be saved in the same pool as the hash table itself */
+        key = apr_palloc(apr_hash_pool_get(vhost_hash), sizeof(*key));
+        *key = srec;
+        apr_hash_set(vhost_hash, key, sizeof(*key), (void*)vhost_element);
 
         /* Populate the remainder of the host */
 
-        add_data_string(string_table,
-                        string_table_len,
-                        srec->server_hostname,
-                        vhost_data != NULL ? &vhost_data->vhosts[vhost_element].hostNameOffset : NULL);
+        add_data_string(sb, srec->server_hostname, &vhost->hostNameOffset);
 
         if (srec->server_admin != NULL)
         {
-            add_data_string(string_table,
-                            string_table_len,
-                            srec->server_admin,
-                            vhost_data != NULL ? &vhost_data->vhosts[vhost_element].serverAdminOffset : NULL);
+            add_data_string(sb, srec->server_admin, &vhost->serverAdminOffset);
         }
 
         if (srec->error_fname != NULL)
         {
-            add_data_string(string_table,
-                            string_table_len,
-                            srec->error_fname,
-                            vhost_data != NULL ? &vhost_data->vhosts[vhost_element].logErrorOffset : NULL);
+            add_data_string(sb, srec->error_fname, &vhost->logErrorOffset);
         }
 
         hostInfo = find_host_info(cfg, srec);
         if (hostInfo != NULL)
         {
-            string_array* alias;        /* List of aliases for this server */
-
-            add_data_string(string_table,
-                            string_table_len,
-                            hostInfo->transferLogFileName,
-                            vhost_data != NULL ? &vhost_data->vhosts[vhost_element].logAccessOffset : NULL);
-            add_data_string(string_table,
-                            string_table_len,
-                            hostInfo->customLogFileName,
-                            vhost_data != NULL ? &vhost_data->vhosts[vhost_element].logCustomOffset : NULL);
-            add_data_string(string_table,
-                            string_table_len,
-                            hostInfo->documentRoot,
-                            vhost_data != NULL ? &vhost_data->vhosts[vhost_element].documentRootOffset : NULL);
-            first = 1;
-            for (alias = hostInfo->aliases; alias != NULL; alias = alias->next)
+            int alias;                  /* Index into the aliases for this server */
+
+            add_data_string(sb, hostInfo->transferLogFileName, &vhost->logAccessOffset);
+            add_data_string(sb, hostInfo->customLogFileName, &vhost->logCustomOffset);
+            add_data_string(sb, hostInfo->documentRoot, &vhost->documentRootOffset);
+
+            vhost->aliasIndex = aliases->nelts;
+            for (alias = 0; hostInfo->aliases != NULL && alias < hostInfo->aliases->nelts; alias++)
             {
-                add_data_string(string_table,
-                                string_table_len,
-                                alias->string,
-                                first && vhost_data != NULL ? &vhost_data->vhosts[vhost_element].serverAliasesOffset : NULL);
-                first = 0;
+                const char* name = APR_ARRAY_IDX(hostInfo->aliases, alias, const char*);
+
+                add_data_string(sb, name, &APR_ARRAY_PUSH(aliases, apr_size_t));
+                add_formatted_item(&scratch, name);
             }
-            /* Terminate the array of IP addresses and ports */
-            terminate_data_string_array(string_table, string_table_len);
+            vhost->aliasCount = aliases->nelts - vhost->aliasIndex;
+            add_formatted_list(sb, &scratch, &vhost->aliasesFormattedOffset);
         }
 
         /* Populate the array of (IP address, port) */
-        first = 1;
+        vhost->addressIndex = addresses->nelts;
         for (addrs = srec->addrs; addrs != NULL; addrs = addrs->next)
         {
-            add_data_string(string_table,
-                            string_table_len,
-                            addrs->host_addr->hostname != NULL ? addrs->host_addr->hostname : "_default_",
-                            first && vhost_data != NULL ? &vhost_data->vhosts[vhost_element].addressesAndPortsOffset : NULL);
-            add_data_string(string_table,
-                            string_table_len,
-                            encode64(addrs->host_addr->port),
-                            NULL);
-            first = 0;
+            mmap_vhost_address* address = &APR_ARRAY_PUSH(addresses, mmap_vhost_address);
+            const char* host = addrs->host_addr->hostname != NULL ? addrs->host_addr->hostname : "_default_";
+            char port[8];
+
+            add_data_string(sb, host, &address->hostOffset);
+            address->port = addrs->host_addr->port;
+
+            add_formatted_item(&scratch, host);
+            apr_snprintf(port, sizeof(port), "%u", (unsigned int)address->port);
+            add_formatted_item(&ports, port);
         }
+        vhost->addressCount = addresses->nelts - vhost->addressIndex;
+        add_formatted_list(sb, &scratch, &vhost->ipAddressesFormattedOffset);
+        add_formatted_list(sb, &ports, &vhost->portsFormattedOffset);
 
         if (!srec->is_virtual)
         {
             physical_host_element = vhost_element;
         }
 
-        /* Terminate the array of IP addresses and ports */
-        terminate_data_string_array(string_table, string_table_len);
-
         vhost_element++;
     }
 
     /* if there is a physical host, merge empty mergable properties of virtual hosts
      * with physical host properties */
-    if (vhost_data != NULL && physical_host_element < vhost_count)
+    if (physical_host_element < vhost_count)
     {
         for (vhost_element = 2; vhost_element < vhost_count; vhost_element++)
         {
@@ -917,72 +1306,239 @@ static apr_status_t collect_vhost_data(
 /* Get the data for the SSL certificates */
 static apr_status_t collect_certificate_data(
     mmap_certificate_data* certificate_data,
-    char* const string_table,
-    apr_size_t* string_table_len,
-    apr_pool_t* ptemp,
+    string_builder* sb,
+    const mmap_vhost_data* vhost_data,
+    apr_hash_t* vhost_hash,             /* APR hash to hosts in memory mapped region */
     config_sslCertFile* head,
     apr_size_t certificate_count)
 {
     apr_size_t certificate_element;
     config_sslCertFile* cert_file_info;
 
-    if (certificate_data != NULL)
-    {
-        certificate_data->count = certificate_count;
-    }
+    certificate_data->count = certificate_count;
 
     certificate_element = certificate_count - 1;
     for (cert_file_info = head; cert_file_info != NULL; cert_file_info = cert_file_info->next)
     {
-        char* instanceHost;
-        server_rec* s;
-        server_addr_rec* addrs;
+        mmap_certificate_elements* cert = &certificate_data->certificates[certificate_element];
+        apr_size_t vhost_element;
 
         /* save first host and port that use this certificate file */
-        add_data_string(string_table,
-                   string_table_len,
-                   cert_file_info->certificateFileName,
-                   certificate_data != NULL ? &certificate_data->certificates[certificate_element].certificateFileNameOffset : NULL);
-        add_data_string(string_table,
-                   string_table_len,
-                   cert_file_info->hostName,
-                   certificate_data != NULL ? &certificate_data->certificates[certificate_element].hostNameOffset : NULL);
-        /* populate the virtual host identifier for this certificate as well */
+        add_data_string(sb, cert_file_info->certificateFileName, &cert->certificateFileNameOffset);
+        add_data_string(sb, cert_file_info->hostName, &cert->hostNameOffset);
+
+        /* populate the virtual host identifier for this certificate as well (shared with the host itself) */
         /* Note: This can't be done when reading configuration - server_hostname isn't initialized yet */
-        s = cert_file_info->srec;
-        instanceHost = apr_pstrdup(ptemp, s->server_hostname != NULL ? s->server_hostname : "_default_");
-        for (addrs = s->addrs; addrs != NULL; addrs = addrs->next)
+        vhost_element = (apr_size_t)apr_hash_get(vhost_hash, &cert_file_info->srec, sizeof(cert_file_info->srec));
+        if (vhost_element != 0)
         {
-            char *nextEntry = apr_psprintf(ptemp,
-                                           ",%s:%d",
-                                           addrs->host_addr->hostname != NULL ? addrs->host_addr->hostname : "_default_",
-                                           (unsigned int)addrs->host_addr->port);
-            instanceHost = apr_pstrcat(ptemp, instanceHost, nextEntry, NULL);
+            cert->virtualHostOffset = vhost_data->vhosts[vhost_element].instanceIDOffset;
         }
-
-        add_data_string(string_table,
-                   string_table_len,
-                   instanceHost,
-                   certificate_data != NULL ? &certificate_data->certificates[certificate_element].virtualHostOffset : NULL);
-        if (certificate_data != NULL)
+        else
         {
-            certificate_data->certificates[certificate_element].port = cert_file_info->port;
+            cert->virtualHostOffset = add_instance_id(sb, cert_file_info->srec);
         }
+
+        cert->port = cert_file_info->port;
         certificate_element--;
     }
     return APR_SUCCESS;
 }
 
+/*
+ * Data regions are double-buffered: each one is built under its own name, in
+ * a subpool of the process pool (so that it outlives a restart), and published
+ * through the control block once complete.  The region it replaces is retired
+ * and destroyed (unlinked) after a grace period, from the monitor hook.
+ */
+
+typedef struct region_state
+{
+    apr_pool_t *pool;                   /* Process pool (survives restarts) */
+    apr_shm_t *control_region;          /* APR handle to control block */
+    mmap_control_block *control;        /* Control block naming the current data region */
+    apr_uint32_t generation;            /* Generation of the most recent data region */
+    apr_pool_t *current_pool;           /* Subpool holding the current data region */
+    mmap_server_data *current;          /* Current data region */
+    apr_pool_t *retired_pool;           /* Subpool holding the retired data region (if any) */
+    apr_time_t retired_time;            /* When the retired data region was replaced */
+} region_state;
+
+/* Remove the data regions named by a control block left behind by an Apache that didn't shut down properly */
+
+static void remove_stale_regions(persist_cfg *cfg, apr_pool_t *process_pool)
+{
+    apr_pool_t *pool;
+    apr_shm_t *control_region;
+    mmap_control_block *control;
+    apr_uint32_t generations[3] = { 0, 0, 0 };
+    const char *region_name;
+    char *text;
+    int i;
+
+    if (APR_SUCCESS != apr_pool_create(&pool, process_pool))
+    {
+        return;
+    }
+
+    if (APR_SUCCESS == apr_shm_attach(&control_region, PROVIDER_MMAP_NAME, pool))
+    {
+        control = (mmap_control_block *) apr_shm_baseaddr_get(control_region);
+        if (apr_shm_size_get(control_region) >= sizeof(mmap_control_block) && MMAP_CONTROL_MAGIC == control->magic)
+        {
+            generations[0] = apr_atomic_read32(&control->generation);
+            generations[1] = control->retiredGeneration;
+            generations[2] = control->builtGeneration;
+        }
+        apr_shm_detach(control_region);
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        /* (The region built last is usually the current one) */
+        if (0 == generations[i] || (2 == i && (generations[2] == generations[0] || generations[2] == generations[1])))
+        {
+            continue;
+        }
+
+        region_name = apr_psprintf(pool, MMAP_REGION_NAME_FORMAT, generations[i]);
+        if (APR_SUCCESS == apr_shm_remove(region_name, pool))
+        {
+            text = apr_psprintf(pool, "cimprov: get_region_state: deleted stale region %s", region_name);
+            display_error(cfg, text, 0, 0);
+        }
+    }
+
+    apr_pool_destroy(pool);
+}
+
+static region_state *get_region_state(persist_cfg *cfg, apr_pool_t *process_pool)
+{
+    const char *key = "MSFT_cimprov_regions";
+    region_state *state = NULL;
+    apr_status_t status;
+
+    apr_pool_userdata_get((void **) &state, key, process_pool);
+    if (NULL != state)
+    {
+        return state;
+    }
+
+    /* Control block may already exist (due to a crash or something); try removing it just in case, */
+    /* along with the data regions it names (generations are seeded from the clock, so they'd never be reused) */
+    /* (If successful, indicates improper shutdown, so log informationally; otherwise ignore error) */
+    remove_stale_regions(cfg, process_pool);
+    if (APR_SUCCESS == (status = apr_shm_remove(PROVIDER_MMAP_NAME, process_pool)))
+    {
+        display_error(cfg, "cimprov: get_region_state: delete success", status, 0);
+    }
+
+    state = (region_state *) apr_pcalloc(process_pool, sizeof(region_state));
+    state->pool = process_pool;
+
+    status = apr_shm_create(&state->control_region, sizeof(mmap_control_block), PROVIDER_MMAP_NAME, process_pool);
+    if (APR_SUCCESS != status)
+    {
+        display_error(cfg, "cimprov: get_region_state failed to create control block", status, 1);
+        return NULL;
+    }
+
+    state->control = (mmap_control_block *) apr_shm_baseaddr_get(state->control_region);
+    memset(state->control, 0, sizeof(mmap_control_block));
+    state->control->version = MMAP_REGION_VERSION;
+    MMAP_MEMORY_BARRIER();
+    state->control->magic = MMAP_CONTROL_MAGIC;
+
+    /* Seed generations from the clock so that they differ across full restarts, too */
+    state->generation = (apr_uint32_t) apr_time_sec(apr_time_now());
+
+    apr_pool_userdata_set(state, key, apr_pool_cleanup_null, process_pool);
+    return state;
+}
+
+/* Publish a newly built data region, retiring the one it replaces */
+
+static void publish_region(persist_cfg *cfg, region_state *state, apr_pool_t *region_pool)
+{
+    /* Only one region is kept in its grace period; an older one goes right away */
+    if (NULL != state->retired_pool)
+    {
+        apr_pool_destroy(state->retired_pool);
+        state->retired_pool = NULL;
+        state->control->retiredGeneration = 0;
+    }
+
+    apr_atomic_set32(&state->control->generation, cfg->server_data->header.generation);
+
+    if (NULL != state->current)
+    {
+        mmap_region_write_begin(&state->current->header);
+        state->control->retiredGeneration = state->current->header.generation;
+        state->retired_pool = state->current_pool;
+        state->retired_time = apr_time_now();
+    }
+
+    state->current_pool = region_pool;
+    state->current = cfg->server_data;
+}
+
+/* Destroy (unlink) the retired data region once its grace period is over */
+
+static void reap_retired_region(persist_cfg *cfg, region_state *state)
+{
+    if (NULL != state && NULL != state->retired_pool
+        && apr_time_now() - state->retired_time >= apr_time_from_sec(MMAP_REGION_GRACE_SECONDS))
+    {
+        display_error(cfg, "cimprov: reap_retired_region: destroying retired shared region", 0, 0);
+        apr_pool_destroy(state->retired_pool);
+        state->retired_pool = NULL;
+        state->control->retiredGeneration = 0;
+    }
+}
+
 /* Create and populate the shared memory region */
 
 static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_pool_t *ptemp, server_rec *head)
 {
     apr_size_t module_count;            /* Number of modules loaded into server */
     apr_size_t vhost_count;             /* Save space for _Total and _Unknown */
+    apr_size_t host_count;              /* Configured hosts (plus _Total and _Unknown); dynamic hosts follow */
+    apr_size_t dynamic_count;           /* Number of dynamic host slots (an overflow host follows them) */
+    apr_size_t dynamic_size;            /* Size of dynamic host table */
+    apr_size_t child_count;             /* Number of scoreboard process slots (process IDs kept for the provider) */
+    char *dynamic_accounting;           /* For each host, nonzero to count its requests by Host header */
     apr_size_t certificate_count;       /* Number of certificate information blocks */
     apr_status_t status;
     config_sslCertFile* cert_file_info; /* Ptr. to information about a certificate file */
-    size_t stable_length;               /* Enough space for two null bytes as terminator */
+    string_builder stable;              /* String table, built in temporary memory */
+    apr_size_t front_size;              /* Size of the structures that precede the strings */
+    mmap_server_data *front;            /* Those structures, built in temporary memory */
+    mmap_vhost_data *front_vhosts;      /* Vhost data within them */
+    mmap_certificate_data *front_certificates; /* Certificate data within them */
+    apr_hash_t *vhost_hash;             /* APR hash to hosts in the region being built */
+    apr_array_header_t *addresses;      /* Addresses and ports of all hosts (mmap_vhost_address) */
+    apr_array_header_t *aliases;        /* Aliases of all hosts (string table offsets) */
+    apr_size_t address_offset;          /* Offset of addresses within region */
+    apr_size_t alias_offset;            /* Offset of aliases within region */
+    apr_size_t shard_count;             /* Number of counter slabs */
+    apr_size_t shard_size;              /* Size of each counter slab */
+    apr_size_t shard_offset;            /* Offset of first counter slab within region */
+    apr_size_t evicted_size;            /* Size of the counters of evicted dynamic hosts */
+    apr_size_t latency_size;            /* Size of each latency slab */
+    apr_size_t slab_bytes;              /* Size of all counter and latency slabs */
+    apr_size_t trace_records;           /* Number of trace records asked for (zero unless logging) */
+    apr_size_t trace_capacity;          /* Number of trace records (power of two, or zero) */
+    apr_size_t trace_size;              /* Size of trace ring */
+    apr_size_t topurl_slots;            /* Heavy-hitter URL slots per virtual host */
+    apr_size_t topurl_count;            /* Top URLs reported per virtual host */
+    apr_size_t topurl_size;             /* Size of heavy-hitter URL tables */
+    apr_size_t topurl_result_size;      /* Size of top URL results */
+    apr_size_t clients_count;           /* Number of unique client register sets (zero if disabled) */
+    apr_size_t slab_address;            /* Address of first counter slab (before alignment) */
+    region_state *regions;              /* Control block and data regions */
+    apr_uint32_t generation;            /* Generation of the region being built */
+    const char *region_name;            /* Name of the region being built */
+    apr_pool_t *region_pool;            /* Pool holding the region being built */
     char* text;
     const char* server_hostname = NULL;
     server_rec* srec;
@@ -1015,6 +1571,14 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
         server_hostname = "_Unknown";
     }
 
+    /* Dynamic hosts (and the overflow host) follow the configured hosts */
+    host_count = vhost_count;
+    dynamic_count = cfg->dynamichosts;
+    if (dynamic_count)
+    {
+        vhost_count += dynamic_count + 1;
+    }
+
     /* Walk the list of certificate files to determine the count */
 
     certificate_count = 0;
@@ -1028,12 +1592,29 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
     display_error(cfg, text, 0, 0);
     text = apr_psprintf(ptemp, "cimprov: Count of certificates: %pS", &certificate_count);
     display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: Count of dynamic host slots: %pS", &dynamic_count);
+    display_error(cfg, text, 0, 0);
 
-    stable_length = 1;                  /* reserve space for a single empty string at the beginning of the string table */
+    /*
+     * Collect the configuration in a single pass, into temporary memory laid out exactly like the
+     * front of the region; it is copied into the region once the size of the string table is known.
+     */
 
-    status = collect_server_data(NULL,
-                                 NULL,
-                                 &stable_length,
+    front_size = sizeof(mmap_server_data) + (sizeof(mmap_server_modules) * module_count)
+               + sizeof(mmap_vhost_data) + ((sizeof(mmap_vhost_elements) + sizeof(mmap_vhost_statistics)) * vhost_count)
+               + sizeof(mmap_certificate_data) + (sizeof(mmap_certificate_elements) * certificate_count)
+               + sizeof(mmap_string_table);
+    front = (mmap_server_data*)apr_pcalloc(ptemp, front_size);
+    front_vhosts = (mmap_vhost_data*)(front->modules + module_count);
+    front_certificates = (mmap_certificate_data*)((mmap_vhost_statistics*)(front_vhosts->vhosts + vhost_count) + vhost_count);
+
+    string_table_init(&stable, ptemp, (module_count + (vhost_count + certificate_count) * 8) * 32 + 1024);
+    vhost_hash = apr_hash_make(pool);
+    addresses = apr_array_make(ptemp, (int)vhost_count, sizeof(mmap_vhost_address));
+    aliases = apr_array_make(ptemp, (int)vhost_count, sizeof(apr_size_t));
+
+    status = collect_server_data(front,
+                                 &stable,
                                  ap_top_module,
                                  module_count,
                                  ap_conftree->filename,
@@ -1044,24 +1625,47 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
         return status;
     }
 
-    status = collect_vhost_data(NULL,
-                                NULL,
-                                &stable_length,
+    status = collect_vhost_data(front_vhosts,
+                                &stable,
+                                addresses,
+                                aliases,
                                 cfg,
-                                ptemp,
-                                NULL,
+                                vhost_hash,
                                 head,
-                                vhost_count);
+                                host_count);
     if (status != APR_SUCCESS)
     {
         display_error(cfg, "cimprov: collection of vhost data failed", status, 0);
         return status;
     }
 
-    status = collect_certificate_data(NULL,
-                                      NULL,
-                                      &stable_length,
-                                      ptemp,
+    /* Dynamic hosts are named at run time (in the dynamic host table); only the overflow host has a name now */
+    front_vhosts->count = vhost_count;
+    dynamic_accounting = NULL;
+    if (dynamic_count)
+    {
+        mmap_vhost_elements* overflow = &front_vhosts->vhosts[host_count + dynamic_count];
+        config_hostInfo* hostInfo;
+
+        add_data_string(&stable, "_Overflow", &overflow->hostNameOffset);
+        overflow->instanceIDOffset = overflow->hostNameOffset;
+
+        dynamic_accounting = apr_pcalloc(pool, vhost_count);
+        for (hostInfo = cfg->configData->hostInfoList; hostInfo != NULL; hostInfo = hostInfo->next)
+        {
+            apr_size_t element = (apr_size_t)apr_hash_get(vhost_hash, &hostInfo->srec, sizeof(hostInfo->srec));
+
+            if (element != 0)
+            {
+                dynamic_accounting[element] = (char)hostInfo->dynamicHosts;
+            }
+        }
+    }
+
+    status = collect_certificate_data(front_certificates,
+                                      &stable,
+                                      front_vhosts,
+                                      vhost_hash,
                                       cfg->configData->certificateFileList,
                                       certificate_count);
     if (status != APR_SUCCESS)
@@ -1074,27 +1678,113 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
      * Create the memory mapped region
      */
 
-    apr_size_t mapSize = sizeof(mmap_server_data) + (sizeof(mmap_server_modules) * module_count)
-                       + sizeof(mmap_vhost_data) + (sizeof(mmap_vhost_elements) * vhost_count)
-                       + sizeof(mmap_certificate_data) + (sizeof(mmap_certificate_elements) * certificate_count)
-                       + sizeof(mmap_string_table) + stable_length;
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: string table of %pS bytes (%u distinct strings)",
+                        &stable.length, apr_hash_count(stable.interned));
+    display_error(cfg, text, 0, 0);
+
+    /* Addresses and aliases of the hosts follow the string table */
+    address_offset = (front_size + stable.length + sizeof(apr_size_t) - 1) & ~(sizeof(apr_size_t) - 1);
+    alias_offset = address_offset + (sizeof(mmap_vhost_address) * addresses->nelts);
+
+    apr_size_t mapSize = alias_offset + (sizeof(apr_size_t) * aliases->nelts);
+
+    /* Counter slabs follow the aliases (with room to align them to a cache line) */
+    /* (Each child process counts into one slab, so more slabs than child processes are never used) */
+    shard_count = cfg->countershards > 1 ? cfg->countershards : 1;
+    if (cfg->process_limit > 0 && shard_count > (apr_size_t) cfg->process_limit)
+    {
+        text = apr_psprintf(ptemp, "cimprov: mmap_region_create: CimCounterShards %pS exceeds the process limit %d; using %d slabs",
+                            &shard_count, cfg->process_limit, cfg->process_limit);
+        display_error(cfg, text, 0, 0);
+        shard_count = (apr_size_t) cfg->process_limit;
+    }
+    shard_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_counters) * vhost_count);
+    mapSize += MMAP_CACHE_LINE_SIZE + (shard_size * shard_count);
+
+    /* Counters of evicted dynamic hosts follow the counter slabs (on a cache line of their own) */
+    evicted_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_counters));
+    mapSize += evicted_size;
+
+    /* Latency slabs (one per counter slab) follow the counters of evicted dynamic hosts */
+    latency_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_latency) * vhost_count);
+    mapSize += latency_size * shard_count;
+
+    /* Counter and latency slabs grow with hosts times slabs; refuse a configuration that would map too much */
+    slab_bytes = (shard_size + latency_size) * shard_count;
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS counter slabs of %pS bytes, %pS bytes in all (with latency)",
+                        &shard_count, &shard_size, &slab_bytes);
+    display_error(cfg, text, 0, 0);
+    if (slab_bytes > MMAP_MAX_SLAB_BYTES)
+    {
+        text = apr_psprintf(ptemp, "cimprov: mmap_region_create: counter slabs need %pS bytes, over the limit of %d; reduce CimCounterShards",
+                            &slab_bytes, MMAP_MAX_SLAB_BYTES);
+        display_error(cfg, text, APR_EINVAL, 1);
+        return APR_EINVAL;
+    }
+
+    /* Trace ring follows the latency slabs (records are only written when CimSetLogging is On) */
+    trace_records = cfg->enablelogging ? cfg->tracerecords : 0;
+    for (trace_capacity = trace_records ? 1 : 0; trace_capacity < trace_records; trace_capacity <<= 1)
+        ;
+    trace_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_trace_ring) + (sizeof(mmap_trace_record) * trace_capacity));
+    mapSize += trace_size;
+
+    /* Heavy-hitter URL tables (and their results) follow the trace ring */
+    topurl_slots = cfg->topurlslots;
+    topurl_count = topurl_slots ? (apr_size_t)cfg->topurlcount : 0;
+    if (topurl_count > topurl_slots)
+    {
+        topurl_count = topurl_slots;
+    }
+    topurl_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_topurl_slot) * topurl_slots * vhost_count);
+    topurl_result_size = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_topurl_result) * 2 * topurl_count * vhost_count);
+    mapSize += topurl_size + topurl_result_size;
+
+    /* Unique client registers (if enabled) follow the top URL results */
+    clients_count = cfg->uniqueclients ? vhost_count : 0;
+    mapSize += sizeof(mmap_vhost_clients) * clients_count;
+
+    /* Dynamic host table (keys, then names) follows the unique client registers */
+    dynamic_size = (sizeof(apr_uint64_t) + sizeof(mmap_dynamic_host)) * dynamic_count;
+    mapSize += dynamic_size;
+
+    /* Child process IDs (one per scoreboard process slot) follow the dynamic host table */
+    child_count = cfg->process_limit > 0 ? (apr_size_t) cfg->process_limit : 0;
+    mapSize += sizeof(apr_uint32_t) * child_count;
+
+    /* Build the region under a name of its own; readers keep using the current one until it's published */
+    if (NULL == (regions = get_region_state(cfg, head->process->pool)))
+    {
+        return APR_EGENERAL;
+    }
+    cfg->regions = regions;
+    generation = ++regions->generation;
+    regions->control->builtGeneration = generation;
+    region_name = apr_psprintf(ptemp, MMAP_REGION_NAME_FORMAT, generation);
+
+    if (APR_SUCCESS != (status = apr_pool_create(&region_pool, regions->pool)))
+    {
+        display_error(cfg, "cimprov: mmap_region_create failed to create region pool", status, 1);
+        return status;
+    }
 
     /* Region may already be mapped (due to a crash or something); try removing it just in case */
     /* (If successful, indicates improper shutdown, so log informationally; otherwise ignore error) */
-    status = apr_shm_remove(PROVIDER_MMAP_NAME, pool);
+    status = apr_shm_remove(region_name, region_pool);
     if (APR_SUCCESS == status)
     {
         display_error(cfg, "cimprov: mmap_region_create: delete success", status, 0);
     }
 
     text = apr_psprintf(ptemp, "cimprov: mmap_region_create: creating memory map %s with size %pS",
-                        PROVIDER_MMAP_NAME, &mapSize);
+                        region_name, &mapSize);
     display_error(cfg, text, 0, 0);
 
-    status = apr_shm_create(&cfg->mmap_region, mapSize, PROVIDER_MMAP_NAME, pool);
+    status = apr_shm_create(&cfg->mmap_region, mapSize, region_name, region_pool);
     if (APR_SUCCESS != status)
     {
         display_error(cfg, "cimprov: mmap_region_create failed to create shared region", status, 1);
+        apr_pool_destroy(region_pool);
         return status;
     }
 
@@ -1105,63 +1795,88 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
     /* Assign global pointers */
     cfg->server_data = (mmap_server_data*)apr_shm_baseaddr_get(cfg->mmap_region);
     cfg->vhost_data = (mmap_vhost_data*)(cfg->server_data->modules + module_count);
-    cfg->certificate_data = (mmap_certificate_data*)(cfg->vhost_data->vhosts + vhost_count);
+    cfg->certificate_data = (mmap_certificate_data*)((mmap_vhost_statistics*)(cfg->vhost_data->vhosts + vhost_count) + vhost_count);
     cfg->string_data = (mmap_string_table*)(cfg->certificate_data->certificates + certificate_count);
     memset(cfg->server_data, 0, mapSize);
 
+    /* Copy in the configuration and the string table */
+    memcpy(cfg->server_data, front, front_size);
+    memcpy(cfg->string_data->data, stable.data, stable.length);
+    cfg->string_data->total_length = stable.length;
+    cfg->server_data->vhostAddressOffset = address_offset;
+    cfg->server_data->vhostAliasOffset = alias_offset;
+    memcpy(MMAP_VHOST_ADDRESSES(cfg->server_data), addresses->elts, sizeof(mmap_vhost_address) * addresses->nelts);
+    memcpy(MMAP_VHOST_ALIASES(cfg->server_data), aliases->elts, sizeof(apr_size_t) * aliases->nelts);
+
+    /* Region isn't valid (magic number is zero) until it is completely populated */
+    mmap_region_write_begin(&cfg->server_data->header);
+    cfg->server_data->header.version = MMAP_REGION_VERSION;
+    cfg->server_data->header.regionSize = mapSize;
+    cfg->server_data->header.generation = generation;
+
+    /* Align the counter slabs by address (the region itself need not be cache line aligned) */
+    slab_address = (apr_size_t)(MMAP_VHOST_ALIASES(cfg->server_data) + aliases->nelts);
+    shard_offset = MMAP_CACHE_LINE_ALIGN(slab_address) - (apr_size_t)cfg->server_data;
+    cfg->server_data->counterShardCount = shard_count;
+    cfg->server_data->counterShardOffset = shard_offset;
+    cfg->server_data->counterShardSize = shard_size;
+    cfg->server_data->evictedCountersOffset = shard_offset + (shard_size * shard_count);
+    cfg->server_data->latencyShardOffset = cfg->server_data->evictedCountersOffset + evicted_size;
+    cfg->server_data->latencyShardSize = latency_size;
+    cfg->server_data->traceRingOffset = cfg->server_data->latencyShardOffset + (latency_size * shard_count);
+    cfg->trace_ring = MMAP_TRACE_RING(cfg->server_data);
+    cfg->trace_ring->capacity = trace_capacity;
+    cfg->server_data->topUrlSlots = topurl_slots;
+    cfg->server_data->topUrlCount = topurl_count;
+    cfg->server_data->topUrlOffset = cfg->server_data->traceRingOffset + trace_size;
+    cfg->server_data->topUrlResultOffset = cfg->server_data->topUrlOffset + topurl_size;
+    cfg->server_data->clientsCount = clients_count;
+    cfg->server_data->clientsOffset = cfg->server_data->topUrlResultOffset + topurl_result_size;
+    cfg->server_data->dynamicHostCount = dynamic_count;
+    cfg->server_data->dynamicHostBase = host_count;
+    cfg->server_data->dynamicHostOffset = cfg->server_data->clientsOffset + (sizeof(mmap_vhost_clients) * clients_count);
+    cfg->server_data->childPidCount = child_count;
+    cfg->server_data->childPidOffset = cfg->server_data->dynamicHostOffset + dynamic_size;
+
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS counter slabs of size %pS at offset %pS",
+                        &shard_count, &shard_size, &shard_offset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS latency slabs of size %pS at offset %pS",
+                        &shard_count, &latency_size, &cfg->server_data->latencyShardOffset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS trace records at offset %pS",
+                        &trace_capacity, &cfg->server_data->traceRingOffset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS top URL slots per host at offset %pS",
+                        &topurl_slots, &cfg->server_data->topUrlOffset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS unique client register sets at offset %pS",
+                        &clients_count, &cfg->server_data->clientsOffset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS dynamic host slots (from host %pS) at offset %pS",
+                        &dynamic_count, &host_count, &cfg->server_data->dynamicHostOffset);
+    display_error(cfg, text, 0, 0);
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: %pS child process slots at offset %pS",
+                        &child_count, &cfg->server_data->childPidOffset);
+    display_error(cfg, text, 0, 0);
+
     /* Assign some other values */
-    cfg->vhost_hash = apr_hash_make(pool);
+    cfg->vhost_hash = vhost_hash;
+    cfg->dynamic_accounting = dynamic_accounting;
+    cfg->process_pool = head->process->pool;
     cfg->stable = cfg->string_data->data;
-    *cfg->stable = '\0';                /* reserve a single empty string at the beginning of the string table */
-    stable_length = 1;                  /* so that zero offsets result in empty strings */
 
-    /* Initialize the memory mapped region for server data */
-    status = collect_server_data(cfg->server_data,
-                                 cfg->stable,
-                                 &stable_length,
-                                 ap_top_module,
-                                 module_count,
-                                 ap_conftree->filename,
-                                 server_hostname);
-    if (status != APR_SUCCESS)
-    {
-        display_error(cfg, "cimprov: collection of server data failed", status, 0);
-        return status;
-    }
+    /* Carry counters forward from the region we had before a restart (if any) */
+    carryover_restore(cfg, ptemp);
 
-    /* Initialize the memory mapped region for vhost data */
+    /* Publish the region */
+    mmap_region_write_end(&cfg->server_data->header);
+    cfg->server_data->header.magic = MMAP_REGION_MAGIC;
+    publish_region(cfg, regions, region_pool);
 
-    status = collect_vhost_data(cfg->vhost_data,
-                                cfg->stable,
-                                &stable_length,
-                                cfg,
-                                ptemp,
-                                cfg->vhost_hash,
-                                head,
-                                vhost_count);
-    if (status != APR_SUCCESS)
-    {
-        display_error(cfg, "cimprov: collection of vhost data failed", status, 0);
-        return status;
-    }
-
-    /* Initialize the memory mapped region for certificate file data */
-
-    status = collect_certificate_data(cfg->certificate_data,
-                                      cfg->stable,
-                                      &stable_length,
-                                      ptemp,
-                                      cfg->configData->certificateFileList,
-                                      certificate_count);
-    if (status != APR_SUCCESS)
-    {
-        display_error(cfg, "cimprov: collection of certificate data failed", status, 0);
-        return status;
-    }
-
-    /* Final initialization for string table */
-
-    cfg->string_data->total_length = stable_length;
+    text = apr_psprintf(ptemp, "cimprov: mmap_region_create: published generation %u (layout version %u)",
+                        cfg->server_data->header.generation, cfg->server_data->header.version);
+    display_error(cfg, text, 0, 0);
 
     display_error(cfg, "cimprov: mmap_region_create says buh bye", 0, 0);
 
@@ -1171,6 +1886,39 @@ static apr_status_t mmap_region_create(persist_cfg *cfg, apr_pool_t *pool, apr_p
     return APR_SUCCESS;
 }
 
+/* Size of the temporary configuration data (it only grows, so this is its peak), for debug logging */
+static apr_size_t config_data_size(persist_cfg *cfg)
+{
+    apr_size_t size = sizeof(config_data);
+    config_hostInfo* hostInfo;
+    config_sslCertFile* certFileInfo;
+
+    for (hostInfo = cfg->configData->hostInfoList; hostInfo != NULL; hostInfo = hostInfo->next)
+    {
+        size += sizeof(config_hostInfo);
+        size += hostInfo->transferLogFileName != NULL ? strlen(hostInfo->transferLogFileName) + 1 : 0;
+        size += hostInfo->customLogFileName != NULL ? strlen(hostInfo->customLogFileName) + 1 : 0;
+        size += hostInfo->documentRoot != NULL ? strlen(hostInfo->documentRoot) + 1 : 0;
+        if (hostInfo->aliases != NULL)
+        {
+            int alias;
+
+            size += sizeof(apr_array_header_t) + (hostInfo->aliases->nalloc * hostInfo->aliases->elt_size);
+            for (alias = 0; alias < hostInfo->aliases->nelts; alias++)
+            {
+                size += strlen(APR_ARRAY_IDX(hostInfo->aliases, alias, const char*)) + 1;
+            }
+        }
+    }
+
+    for (certFileInfo = cfg->configData->certificateFileList; certFileInfo != NULL; certFileInfo = certFileInfo->next)
+    {
+        size += sizeof(config_sslCertFile) + strlen(certFileInfo->certificateFileName) + 1 + strlen(certFileInfo->hostName) + 1;
+    }
+
+    return size;
+}
+
 /*
  * Handlers
  */
@@ -1194,6 +1942,8 @@ static void *create_config(apr_pool_t *pool, server_rec *s)
 
         cfg->pool = pool;
         cfg->busyrefreshfrequency = 60; /* Update busy/refresh statistics every 60 seconds */
+        cfg->tracerecords = MMAP_DEFAULT_TRACE_RECORDS;
+        cfg->topurlcount = MMAP_DEFAULT_TOPURL_COUNT;
 
         /* Create sub-pool for configuration purposes and initialize configuration structure */
         status = apr_pool_create(&cfg->configPool, pool);
@@ -1202,6 +1952,8 @@ static void *create_config(apr_pool_t *pool, server_rec *s)
             return NULL;
         }
         cfg->configData = apr_pcalloc(cfg->configPool, sizeof(config_data));
+        cfg->configData->hostInfoHash = apr_hash_make(cfg->configPool);
+        cfg->configData->certificateFileHash = apr_hash_make(cfg->configPool);
         g_persistConfig = cfg;
     }
 
@@ -1253,6 +2005,10 @@ static apr_status_t post_config_handler(apr_pool_t *pconf, apr_pool_t *plog, apr
         return display_error(cfg, errorText, status, 1);
     }
 
+    // Get the thread and process limits (the region keeps a process ID for each process slot)
+    ap_mpm_query(AP_MPMQ_HARD_LIMIT_THREADS, &cfg->thread_limit);
+    ap_mpm_query(AP_MPMQ_HARD_LIMIT_DAEMONS, &cfg->process_limit);
+
     display_error(cfg, "cimprov: post_config_handler creating memory mapped region", 0, 0);
     if (APR_SUCCESS != (status = mmap_region_create(cfg, pconf, ptemp, head)))
     {
@@ -1265,11 +2021,14 @@ static apr_status_t post_config_handler(apr_pool_t *pconf, apr_pool_t *plog, apr
         return display_error(cfg, errorText, status, 1);
     }
 
-    // Get the thread and process limits
-    ap_mpm_query(AP_MPMQ_HARD_LIMIT_THREADS, &cfg->thread_limit);
-    ap_mpm_query(AP_MPMQ_HARD_LIMIT_DAEMONS, &cfg->process_limit);
-
     /* We're completely initialized, so we don't need temporary configuration data anymore */
+    if (cfg->enablelogging)
+    {
+        apr_size_t config_size = config_data_size(cfg);
+        const char *text = apr_psprintf(ptemp, "cimprov: post_config_handler: peak configuration data was %pS bytes",
+                                        &config_size);
+        display_error(cfg, text, 0, 0);
+    }
     apr_pool_destroy(cfg->configPool);
     cfg->configPool = NULL;
     cfg->configData = NULL;
@@ -1277,6 +2036,66 @@ static apr_status_t post_config_handler(apr_pool_t *pconf, apr_pool_t *plog, apr
     return OK;
 }
 
+/* Index of the individual response counter for a status code (-1 if not counted individually) */
+static int response_code_index(int http_status)
+{
+    switch (http_status)
+    {
+        case 404: return MMAP_RESPONSE_404;
+        case 429: return MMAP_RESPONSE_429;
+        case 499: return MMAP_RESPONSE_499;
+        case 502: return MMAP_RESPONSE_502;
+        case 503: return MMAP_RESPONSE_503;
+        case 504: return MMAP_RESPONSE_504;
+        default:  return -1;
+    }
+}
+
+/* Request latency in microseconds (clamped to 32 bits, about 71 minutes) */
+static apr_uint32_t request_latency(const request_rec *r)
+{
+    apr_time_t duration = apr_time_now() - r->request_time;
+
+    if (duration < 0)
+    {
+        return 0;
+    }
+    return duration > (apr_time_t) APR_UINT32_MAX ? APR_UINT32_MAX : (apr_uint32_t) duration;
+}
+
+static void record_latency(mmap_vhost_latency *latency, apr_uint32_t usec)
+{
+    apr_uint32_t max;
+
+    apr_atomic_inc32(&latency->buckets[mmap_latency_bucket(usec)]);
+
+    /* Raise the maximum; only loops if another thread raised it at the same time */
+    while ((max = apr_atomic_read32(&latency->maxLatency)) < usec)
+    {
+        if (apr_atomic_cas32(&latency->maxLatency, usec, max) == max)
+        {
+            break;
+        }
+    }
+}
+
+/* Write a binary trace record for the request (decoded by the provider) */
+static void trace_request(persist_cfg *cfg, const request_rec *r, apr_size_t element, apr_uint32_t usec, int aborted)
+{
+    apr_uint64_t sequence;
+    mmap_trace_record *record = mmap_trace_claim(cfg->trace_ring, &sequence);
+
+    record->vhost = (apr_uint32_t) element;
+    record->timestamp = apr_time_now();
+    record->bytes = r->bytes_sent;
+    record->duration = usec;
+    record->pid = (apr_uint32_t) cfg->child_pid;
+    record->status = (apr_uint16_t) r->status;
+    record->flags = aborted ? MMAP_TRACE_ABORTED : 0;
+
+    mmap_trace_commit(record, sequence);
+}
+
 static apr_status_t handle_VHostStatistics(const request_rec *r)
 {
     persist_cfg *cfg = ap_get_module_config(r->server->module_config, &cimprov_module);
@@ -1285,19 +2104,36 @@ static apr_status_t handle_VHostStatistics(const request_rec *r)
         serverName = r->server->server_hostname;
 
     int http_status = r->status;
+    int code_index = response_code_index(http_status);
+    int aborted = r->connection->aborted;
+    apr_uint32_t usec = request_latency(r);
+    const char *client_ip = NULL;
 
-    /* Find the hash value of the server record address */
-    apr_size_t element = (apr_size_t)apr_hash_get(cfg->vhost_hash, apr_psprintf(r->pool, "%pp", r->server), APR_HASH_KEY_STRING);
+    /* Find the element for the server record address (no allocation on the request path) */
+    apr_size_t element = (apr_size_t)apr_hash_get(cfg->vhost_hash, &r->server, sizeof(r->server));
 
     if ( element < 2 || element >= cfg->vhost_data->count )
     {
         /* Umm, somehow we got a host that wasn't in the hash; use _Unknown */
         element = 1;
     }
+    else if (cfg->dynamic_accounting != NULL && cfg->dynamic_accounting[element] && r->hostname != NULL)
+    {
+        /* Count the request by its Host header (in the overflow host, if the name finds no slot) */
+        mmap_server_data *sd = cfg->server_data;
 
-    /* Log our access for debugging purposes, if logging is enabled */
+        element = sd->dynamicHostBase + mmap_dynamic_host_find(MMAP_DYNAMIC_HOST_KEYS(sd), MMAP_DYNAMIC_HOSTS(sd),
+                                                               sd->dynamicHostCount, r->hostname,
+                                                               (apr_uint32_t) apr_time_sec(r->request_time));
+    }
 
-    if (cfg->enablelogging)
+    /* Log our access for debugging purposes, if logging is enabled (to the trace ring, if we have one) */
+
+    if (cfg->enablelogging && cfg->trace_ring->capacity)
+    {
+        trace_request(cfg, r, element, usec, aborted);
+    }
+    else if (cfg->enablelogging)
     {
         char *text = apr_psprintf(r->pool,
                                   "cimprov: Access result: Name=%s, status=%d, index=%pS",
@@ -1306,103 +2142,52 @@ static apr_status_t handle_VHostStatistics(const request_rec *r)
         display_error(cfg, text, 0, 0);
     }
 
-    /* Count the statistics - and include in _Total */
-    apr_atomic_inc32(&cfg->vhost_data->vhosts[element].requestsTotal);
-    apr_atomic_add32(&cfg->vhost_data->vhosts[element].requestsBytes, r->bytes_sent);
-    if (http_status >= 400 && http_status <= 499)
-    {
-        apr_atomic_inc32(&cfg->vhost_data->vhosts[element].errorCount400);
-    }
-    if (http_status >= 500 && http_status <= 599)
+    /* Count the statistics in this child's slab */
+    mmap_count_request(&cfg->counter_slab[element], r->bytes_sent, http_status, code_index, aborted);
+
+    /* Include in _Total, unless there are multiple slabs (then the provider derives _Total) */
+    if (cfg->server_data->counterShardCount == 1)
     {
-        apr_atomic_inc32(&cfg->vhost_data->vhosts[element].errorCount500);
+        mmap_count_request(&cfg->counter_slab[0], r->bytes_sent, http_status, code_index, aborted);
     }
 
-    apr_atomic_inc32(&cfg->vhost_data->vhosts[0].requestsTotal);
-    apr_atomic_add32(&cfg->vhost_data->vhosts[0].requestsBytes, r->bytes_sent);
-    if (http_status >= 400 && http_status <= 499)
+    /* Request latency (the provider sums _Total from the virtual hosts) */
+    record_latency(&cfg->latency_slab[element], usec);
+
+    if (cfg->server_data->topUrlSlots && r->uri != NULL)
     {
-        apr_atomic_inc32(&cfg->vhost_data->vhosts[0].errorCount400);
+        mmap_topurl_count(MMAP_TOPURL_SLOTS(cfg->server_data, element), cfg->server_data->topUrlSlots, r->uri, r->bytes_sent);
     }
-    if (http_status >= 500 && http_status <= 599)
+
+    /* Unique clients (the provider combines the virtual hosts for _Total) */
+#if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER == 2
+    client_ip = r->connection->remote_ip;
+#elif AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
+    client_ip = r->useragent_ip;
+#endif
+    if (cfg->server_data->clientsCount && client_ip != NULL)
     {
-        apr_atomic_inc32(&cfg->vhost_data->vhosts[0].errorCount500);
+        mmap_hll_add(MMAP_VHOST_CLIENTS(cfg->server_data)[element].interval, client_ip);
     }
 
     return APR_SUCCESS;
 }
 
-static apr_status_t handle_WorkerStatistics(const request_rec *r)
+/* Count the idle and busy workers in the scoreboard (process/thread limits must be set) */
+static void update_worker_statistics(persist_cfg *cfg)
 {
-    persist_cfg *cfg = ap_get_module_config(r->server->module_config, &cimprov_module);
-    apr_status_t status;
-
-    /* If idle/busy lookup is diabled, return */
-    if (-1 == cfg->busyrefreshfrequency)
-    {
-        return APR_SUCCESS;
-    }
-
-    /* See if it's time to determine idle/busy lookup */
-    if (0 != cfg->busyrefreshfrequency)
-    {
-        apr_time_t currentTime = apr_time_now();
-        apr_time_t lastUpdateTime;
-
-        apr_uint32_t ansiUpdateTime = apr_atomic_read32((apr_uint32_t *) &cfg->server_data->busyRefreshTime);
-        if (APR_SUCCESS != (status = apr_time_ansi_put(&lastUpdateTime, ansiUpdateTime)))
-        {
-            display_error(cfg, "cimprov: Error converting from time_t, forcing update", status, 0);
-            lastUpdateTime = 0;
-        }
-
-        if (cfg->enablehystericallogging)
-        {
-            char *text = apr_psprintf(r->pool, "DEBUG: lastUpdateTime=%lu, currentTime=%lu, freq=%d",
-                                      (unsigned long)lastUpdateTime, (unsigned long)currentTime, cfg->busyrefreshfrequency);
-            display_error(cfg, text, 0, 0);
-        }
-
-        // Just bag if it's not time to do the refresh
-        if (0 != lastUpdateTime && (lastUpdateTime + apr_time_from_sec(cfg->busyrefreshfrequency)) > currentTime)
-        {
-            return APR_SUCCESS;
-        }
-
-        // It's time to refresh - fall through, but take care to only run once in case of thread collision
-        apr_uint32_t newUpdateTime = apr_time_sec(currentTime);
-        apr_uint32_t originalTime = apr_atomic_cas32((apr_uint32_t *) &cfg->server_data->busyRefreshTime, newUpdateTime, ansiUpdateTime);
-
-        if (cfg->enablehystericallogging)
-        {
-            char *text = apr_psprintf(r->pool, "DEBUG: originalTime=%d, ansiUpdateTime=%d, freq=%d",
-                                      originalTime, ansiUpdateTime, cfg->busyrefreshfrequency);
-            display_error(cfg, text, 0, 0);
-        }
-
-        if (originalTime != ansiUpdateTime)
-        {
-            // Some other thread is handling this, so we don't need to
-            return APR_SUCCESS;
-        }
-    }
-
-#if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
+#if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER == 2
+    ap_generation_t mpm_generation = ap_my_generation;
+#elif AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
     ap_generation_t mpm_generation;
 #endif
     apr_uint32_t ready = 0, busy = 0;
-    clock_t tu, ts, tcu, tcs;
     int i, j;
 
-    tu = ts = tcu = tcs = 0;
-
-#if defined(linux)
-    char *text = apr_psprintf(r->pool, "cimprov: Computing Apache idle/busy thread/process counts in PID %d",
-                              getpid());
-    display_error(cfg, text, 0, 0);
-#else
-    display_error(cfg, "cimprov: Computing Apache idle/busy thread/process counts", 0, 0);
-#endif // defined(linux)
+    if (cfg->enablehystericallogging)
+    {
+        display_error(cfg, "cimprov: Computing Apache idle/busy thread/process counts", 0, 0);
+    }
 
 #if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
     ap_mpm_query(AP_MPMQ_GENERATION, &mpm_generation);
@@ -1411,9 +2196,16 @@ static apr_status_t handle_WorkerStatistics(const request_rec *r)
     for (i = 0; i < cfg->process_limit; ++i) {
         process_score *score_process;
         worker_score *score_worker;
+        int current_generation;
         int state;
 
+        /* Skip unused and exiting process slots without walking their workers */
         score_process = ap_get_scoreboard_process(i);
+        if (score_process->quiescing || !score_process->pid) {
+            continue;
+        }
+        current_generation = (score_process->generation == mpm_generation);
+
         for (j = 0; j < cfg->thread_limit; ++j) {
 #if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER == 2
             score_worker = ap_get_scoreboard_worker(i, j);
@@ -1424,34 +2216,96 @@ static apr_status_t handle_WorkerStatistics(const request_rec *r)
 #endif
             state = score_worker->status;
 
-            if (!score_process->quiescing && score_process->pid) {
-#if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER == 2
-                if (state == SERVER_READY && score_process->generation == ap_my_generation)
-#elif AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
-                if (state == SERVER_READY && score_process->generation == mpm_generation)
-#endif
-                {
-                    ready++;
-                }
-                else if (state != SERVER_DEAD && state != SERVER_STARTING && state != SERVER_IDLE_KILL)
-                {
-                    busy++;
-                }
+            if (state == SERVER_READY && current_generation)
+            {
+                ready++;
+            }
+            else if (state != SERVER_DEAD && state != SERVER_STARTING && state != SERVER_IDLE_KILL)
+            {
+                busy++;
             }
         }
     }
 
     apr_atomic_set32(&cfg->server_data->idleApacheWorkers, ready);
     apr_atomic_set32(&cfg->server_data->busyApacheWorkers, busy);
+}
 
-    return APR_SUCCESS;
+/* Record the process ID of each live child process (by scoreboard slot), so the provider can account for them */
+static void update_child_pids(persist_cfg *cfg)
+{
+    volatile apr_uint32_t *pids = MMAP_CHILD_PIDS(cfg->server_data);
+    apr_size_t i;
+
+    for (i = 0; i < cfg->server_data->childPidCount; ++i)
+    {
+        process_score *score_process = ap_get_scoreboard_process((int) i);
+        apr_uint32_t pid = score_process->pid > 0 ? (apr_uint32_t) score_process->pid : 0;
+
+        /* Exiting (quiescing) children are still using resources, so they're kept until they're gone */
+        if (apr_atomic_read32(&pids[i]) != pid)
+        {
+            apr_atomic_set32(&pids[i], pid);
+        }
+    }
+}
+
+/* Periodically (about once a second) called in the parent process; update child processes, and idle/busy workers when due */
+#if AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER == 2
+static int monitor_handler(apr_pool_t *pool)
+{
+    persist_cfg *cfg = g_persistConfig;
+#elif AP_SERVER_MAJORVERSION_NUMBER == 2 && AP_SERVER_MINORVERSION_NUMBER >= 4
+static int monitor_handler(apr_pool_t *pool, server_rec *server)
+{
+    persist_cfg *cfg = ap_get_module_config(server->module_config, &cimprov_module);
+#endif
+    apr_uint32_t currentTime;
+
+    /* Unlink a retired region once readers have had time to move on */
+    if (cfg != NULL)
+    {
+        reap_retired_region(cfg, cfg->regions);
+    }
+
+    /* If we failed to initialize, return */
+    if (cfg == NULL || cfg->server_data == NULL)
+    {
+        return DECLINED;
+    }
+
+    /* Child process IDs are cheap to copy, so they're always kept current */
+    update_child_pids(cfg);
+
+    /* If idle/busy lookup is diabled, return */
+    if (-1 == cfg->busyrefreshfrequency)
+    {
+        return DECLINED;
+    }
+
+    /* See if it's time to determine idle/busy lookup */
+    currentTime = apr_time_sec(apr_time_now());
+    if (0 != cfg->busyrefreshfrequency)
+    {
+        apr_uint32_t lastUpdateTime = apr_atomic_read32((apr_uint32_t *) &cfg->server_data->busyRefreshTime);
+
+        // Just bag if it's not time to do the refresh
+        if (0 != lastUpdateTime && lastUpdateTime + cfg->busyrefreshfrequency > currentTime)
+        {
+            return DECLINED;
+        }
+    }
+
+    update_worker_statistics(cfg);
+    apr_atomic_set32((apr_uint32_t *) &cfg->server_data->busyRefreshTime, currentTime);
+
+    return DECLINED;
 }
 
 static int log_request_handler(request_rec *r)
 {
-    /* Handle the request here */
+    /* Handle the request here (idle/busy workers are computed by monitor_handler) */
     handle_VHostStatistics(r);
-    handle_WorkerStatistics(r);
 
     return DECLINED;
 }
@@ -1465,6 +2319,16 @@ static void child_init_handler(apr_pool_t *pool, server_rec *server)
     {
         display_error(cfg, "child_init_handler: failed to initialize child mutex", status, 1);
     }
+
+    /* Pick the counter slab for this child (children share slabs if there are more children than slabs) */
+    if (cfg->server_data != NULL)
+    {
+        apr_size_t shard = apr_atomic_inc32(&cfg->server_data->nextCounterShard) % cfg->server_data->counterShardCount;
+
+        cfg->counter_slab = MMAP_COUNTER_SLAB(cfg->server_data, shard);
+        cfg->latency_slab = MMAP_LATENCY_SLAB(cfg->server_data, shard);
+        cfg->child_pid = getpid();
+    }
 }
 
 /*
@@ -1475,6 +2339,7 @@ static void register_hooks(apr_pool_t *pool)
     ap_hook_log_transaction(log_request_handler, NULL, NULL, APR_HOOK_MIDDLE);
     ap_hook_post_config(post_config_handler, NULL, NULL, APR_HOOK_MIDDLE);
     ap_hook_child_init(child_init_handler, NULL, NULL, APR_HOOK_MIDDLE);
+    ap_hook_monitor(monitor_handler, NULL, NULL, APR_HOOK_MIDDLE);
 }
 
 module AP_MODULE_DECLARE_DATA cimprov_module =
@@ -41,6 +41,26 @@ typedef struct _Apache_HTTPDServerStatistics /* extends CIM_StatisticalData */
     MI_ConstUint32Field BusyWorkers;
     MI_ConstUint32Field PctBusyWorkers;
     MI_ConstStringField ConfigurationFile;
+    MI_ConstUint32Field TotalPctCPUAverage1Min;
+    MI_ConstUint32Field TotalPctCPUPeak1Min;
+    MI_ConstUint32Field TotalPctCPUAverage5Min;
+    MI_ConstUint32Field TotalPctCPUPeak5Min;
+    MI_ConstUint32Field TotalPctCPUAverage15Min;
+    MI_ConstUint32Field TotalPctCPUPeak15Min;
+    MI_ConstUint32Field TotalPctCPUAverage60Min;
+    MI_ConstUint32Field TotalPctCPUPeak60Min;
+    MI_ConstUint32Field BusyWorkersAverage1Min;
+    MI_ConstUint32Field BusyWorkersPeak1Min;
+    MI_ConstUint32Field BusyWorkersAverage5Min;
+    MI_ConstUint32Field BusyWorkersPeak5Min;
+    MI_ConstUint32Field BusyWorkersAverage15Min;
+    MI_ConstUint32Field BusyWorkersPeak15Min;
+    MI_ConstUint32Field BusyWorkersAverage60Min;
+    MI_ConstUint32Field BusyWorkersPeak60Min;
+    MI_ConstUint64Field ResidentMemoryKB;
+    MI_ConstUint32Field ChildProcesses;
+    MI_ConstUint64Field AverageChildResidentMemoryKB;
+    MI_ConstUint32Field AverageChildPctCPU;
 }
 Apache_HTTPDServerStatistics;
 
@@ -404,6 +424,326 @@ MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_ConfigurationFile
         11);
 }
 
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUAverage1Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage1Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUAverage1Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUAverage1Min, 0, sizeof(self->TotalPctCPUAverage1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUPeak1Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak1Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUPeak1Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUPeak1Min, 0, sizeof(self->TotalPctCPUPeak1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUAverage5Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage5Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUAverage5Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUAverage5Min, 0, sizeof(self->TotalPctCPUAverage5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUPeak5Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak5Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUPeak5Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUPeak5Min, 0, sizeof(self->TotalPctCPUPeak5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUAverage15Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage15Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUAverage15Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUAverage15Min, 0, sizeof(self->TotalPctCPUAverage15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUPeak15Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak15Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUPeak15Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUPeak15Min, 0, sizeof(self->TotalPctCPUPeak15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUAverage60Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage60Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUAverage60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUAverage60Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUAverage60Min, 0, sizeof(self->TotalPctCPUAverage60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_TotalPctCPUPeak60Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak60Min)->value = x;
+    ((MI_Uint32Field*)&self->TotalPctCPUPeak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_TotalPctCPUPeak60Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->TotalPctCPUPeak60Min, 0, sizeof(self->TotalPctCPUPeak60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersAverage1Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersAverage1Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersAverage1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersAverage1Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersAverage1Min, 0, sizeof(self->BusyWorkersAverage1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersPeak1Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersPeak1Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersPeak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersPeak1Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersPeak1Min, 0, sizeof(self->BusyWorkersPeak1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersAverage5Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersAverage5Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersAverage5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersAverage5Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersAverage5Min, 0, sizeof(self->BusyWorkersAverage5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersPeak5Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersPeak5Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersPeak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersPeak5Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersPeak5Min, 0, sizeof(self->BusyWorkersPeak5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersAverage15Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersAverage15Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersAverage15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersAverage15Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersAverage15Min, 0, sizeof(self->BusyWorkersAverage15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersPeak15Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersPeak15Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersPeak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersPeak15Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersPeak15Min, 0, sizeof(self->BusyWorkersPeak15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersAverage60Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersAverage60Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersAverage60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersAverage60Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersAverage60Min, 0, sizeof(self->BusyWorkersAverage60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_BusyWorkersPeak60Min(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->BusyWorkersPeak60Min)->value = x;
+    ((MI_Uint32Field*)&self->BusyWorkersPeak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_BusyWorkersPeak60Min(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->BusyWorkersPeak60Min, 0, sizeof(self->BusyWorkersPeak60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_ResidentMemoryKB(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResidentMemoryKB)->value = x;
+    ((MI_Uint64Field*)&self->ResidentMemoryKB)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_ResidentMemoryKB(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->ResidentMemoryKB, 0, sizeof(self->ResidentMemoryKB));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_ChildProcesses(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ChildProcesses)->value = x;
+    ((MI_Uint32Field*)&self->ChildProcesses)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_ChildProcesses(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->ChildProcesses, 0, sizeof(self->ChildProcesses));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_AverageChildResidentMemoryKB(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->AverageChildResidentMemoryKB)->value = x;
+    ((MI_Uint64Field*)&self->AverageChildResidentMemoryKB)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_AverageChildResidentMemoryKB(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->AverageChildResidentMemoryKB, 0, sizeof(self->AverageChildResidentMemoryKB));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Set_AverageChildPctCPU(
+    Apache_HTTPDServerStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->AverageChildPctCPU)->value = x;
+    ((MI_Uint32Field*)&self->AverageChildPctCPU)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDServerStatistics_Clear_AverageChildPctCPU(
+    Apache_HTTPDServerStatistics* self)
+{
+    memset((void*)&self->AverageChildPctCPU, 0, sizeof(self->AverageChildPctCPU));
+    return MI_RESULT_OK;
+}
+
 /*
 **==============================================================================
 **
@@ -847,6 +1187,806 @@ public:
         const size_t n = offsetof(Self, ConfigurationFile);
         GetField<String>(n).Clear();
     }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUAverage1Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUAverage1Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUAverage1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUAverage1Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUAverage1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUAverage1Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUAverage1Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUPeak1Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUPeak1Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUPeak1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUPeak1Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUPeak1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUPeak1Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUPeak1Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUAverage5Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUAverage5Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUAverage5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUAverage5Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUAverage5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUAverage5Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUAverage5Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUPeak5Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUPeak5Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUPeak5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUPeak5Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUPeak5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUPeak5Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUPeak5Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUAverage15Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUAverage15Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUAverage15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUAverage15Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUAverage15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUAverage15Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUAverage15Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUPeak15Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUPeak15Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUPeak15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUPeak15Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUPeak15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUPeak15Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUPeak15Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUAverage60Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUAverage60Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUAverage60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUAverage60Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUAverage60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUAverage60Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUAverage60Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUAverage60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.TotalPctCPUPeak60Min
+    //
+    
+    const Field<Uint32>& TotalPctCPUPeak60Min() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void TotalPctCPUPeak60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& TotalPctCPUPeak60Min_value() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void TotalPctCPUPeak60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool TotalPctCPUPeak60Min_exists() const
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void TotalPctCPUPeak60Min_clear()
+    {
+        const size_t n = offsetof(Self, TotalPctCPUPeak60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersAverage1Min
+    //
+    
+    const Field<Uint32>& BusyWorkersAverage1Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersAverage1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersAverage1Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersAverage1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersAverage1Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersAverage1Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersPeak1Min
+    //
+    
+    const Field<Uint32>& BusyWorkersPeak1Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersPeak1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersPeak1Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersPeak1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersPeak1Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersPeak1Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersAverage5Min
+    //
+    
+    const Field<Uint32>& BusyWorkersAverage5Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersAverage5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersAverage5Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersAverage5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersAverage5Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersAverage5Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersPeak5Min
+    //
+    
+    const Field<Uint32>& BusyWorkersPeak5Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersPeak5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersPeak5Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersPeak5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersPeak5Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersPeak5Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersAverage15Min
+    //
+    
+    const Field<Uint32>& BusyWorkersAverage15Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersAverage15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersAverage15Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersAverage15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersAverage15Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersAverage15Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersPeak15Min
+    //
+    
+    const Field<Uint32>& BusyWorkersPeak15Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersPeak15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersPeak15Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersPeak15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersPeak15Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersPeak15Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersAverage60Min
+    //
+    
+    const Field<Uint32>& BusyWorkersAverage60Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersAverage60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersAverage60Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersAverage60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersAverage60Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersAverage60Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersAverage60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.BusyWorkersPeak60Min
+    //
+    
+    const Field<Uint32>& BusyWorkersPeak60Min() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void BusyWorkersPeak60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& BusyWorkersPeak60Min_value() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void BusyWorkersPeak60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool BusyWorkersPeak60Min_exists() const
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void BusyWorkersPeak60Min_clear()
+    {
+        const size_t n = offsetof(Self, BusyWorkersPeak60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.ResidentMemoryKB
+    //
+    
+    const Field<Uint64>& ResidentMemoryKB() const
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResidentMemoryKB(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResidentMemoryKB_value() const
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResidentMemoryKB_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResidentMemoryKB_exists() const
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResidentMemoryKB_clear()
+    {
+        const size_t n = offsetof(Self, ResidentMemoryKB);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.ChildProcesses
+    //
+    
+    const Field<Uint32>& ChildProcesses() const
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        return GetField<Uint32>(n);
+    }
+    
+    void ChildProcesses(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ChildProcesses_value() const
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ChildProcesses_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ChildProcesses_exists() const
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ChildProcesses_clear()
+    {
+        const size_t n = offsetof(Self, ChildProcesses);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.AverageChildResidentMemoryKB
+    //
+    
+    const Field<Uint64>& AverageChildResidentMemoryKB() const
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        return GetField<Uint64>(n);
+    }
+    
+    void AverageChildResidentMemoryKB(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& AverageChildResidentMemoryKB_value() const
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void AverageChildResidentMemoryKB_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool AverageChildResidentMemoryKB_exists() const
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void AverageChildResidentMemoryKB_clear()
+    {
+        const size_t n = offsetof(Self, AverageChildResidentMemoryKB);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDServerStatistics_Class.AverageChildPctCPU
+    //
+    
+    const Field<Uint32>& AverageChildPctCPU() const
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        return GetField<Uint32>(n);
+    }
+    
+    void AverageChildPctCPU(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& AverageChildPctCPU_value() const
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void AverageChildPctCPU_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool AverageChildPctCPU_exists() const
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void AverageChildPctCPU_clear()
+    {
+        const size_t n = offsetof(Self, AverageChildPctCPU);
+        GetField<Uint32>(n).Clear();
+    }
 };
 
 typedef Array<Apache_HTTPDServerStatistics_Class> Apache_HTTPDServerStatistics_ClassA;
@@ -28,7 +28,6 @@
 #include "Apache_HTTPDServerStatistics_Class_Provider.h"
 
 // Provider include definitions
-#include <apr_atomic.h>
 #include "apachebinding.h"
 
 #include <unistd.h>
@@ -98,7 +97,7 @@ void Apache_HTTPDServerStatistics_Class_Provider::EnumerateInstances(
 {
     CIM_PEX_BEGIN
     {
-        ApacheDataCollector data = g_pFactory->DataCollectorFactory();
+        ApacheDataCollector data;
         Apache_HTTPDServerStatistics_Class inst;
 
         if (APR_SUCCESS != data.Attach("Apache_HTTPDServerStatistics_Class_Provider::EnumerateInstances"))
@@ -117,17 +116,39 @@ void Apache_HTTPDServerStatistics_Class_Provider::EnumerateInstances(
 
             inst.ConfigurationFile_value(data.GetServerConfigFile());
 
-            // Insert time-based values into the instance
-
-            inst.TotalPctCPU_value(data.GetCPUUtilization());
-
-            apr_uint32_t idleWorkers = data.GetWorkerCountIdle();
-            apr_uint32_t busyWorkers = data.GetWorkerCountBusy();
-            apr_uint32_t totalWorkers = idleWorkers + busyWorkers;
-
-            inst.IdleWorkers_value(idleWorkers);
-            inst.BusyWorkers_value(busyWorkers);
-            inst.PctBusyWorkers_value(totalWorkers ? (busyWorkers * 100) / totalWorkers : 0);
+            // Insert time-based values into the instance (from a copy taken in one pass)
+
+            const ApacheServerSnapshot& server = data.Snapshot().server;
+            apr_uint32_t totalWorkers = server.idleWorkers + server.busyWorkers;
+
+            inst.TotalPctCPU_value(server.percentCPU);
+            inst.IdleWorkers_value(server.idleWorkers);
+            inst.BusyWorkers_value(server.busyWorkers);
+            inst.PctBusyWorkers_value(totalWorkers ? (server.busyWorkers * 100) / totalWorkers : 0);
+
+            // Averages and peaks over the last 1, 5, 15 and 60 minutes
+            inst.TotalPctCPUAverage1Min_value(server.cpuAverage[0]);
+            inst.TotalPctCPUPeak1Min_value(server.cpuPeak[0]);
+            inst.TotalPctCPUAverage5Min_value(server.cpuAverage[1]);
+            inst.TotalPctCPUPeak5Min_value(server.cpuPeak[1]);
+            inst.TotalPctCPUAverage15Min_value(server.cpuAverage[2]);
+            inst.TotalPctCPUPeak15Min_value(server.cpuPeak[2]);
+            inst.TotalPctCPUAverage60Min_value(server.cpuAverage[3]);
+            inst.TotalPctCPUPeak60Min_value(server.cpuPeak[3]);
+            inst.BusyWorkersAverage1Min_value(server.busyWorkersAverage[0]);
+            inst.BusyWorkersPeak1Min_value(server.busyWorkersPeak[0]);
+            inst.BusyWorkersAverage5Min_value(server.busyWorkersAverage[1]);
+            inst.BusyWorkersPeak5Min_value(server.busyWorkersPeak[1]);
+            inst.BusyWorkersAverage15Min_value(server.busyWorkersAverage[2]);
+            inst.BusyWorkersPeak15Min_value(server.busyWorkersPeak[2]);
+            inst.BusyWorkersAverage60Min_value(server.busyWorkersAverage[3]);
+            inst.BusyWorkersPeak60Min_value(server.busyWorkersPeak[3]);
+
+            // Memory and CPU of the child processes (the server's memory is included in the total)
+            inst.ResidentMemoryKB_value(server.residentBytes / 1024);
+            inst.ChildProcesses_value(server.childProcesses);
+            inst.AverageChildResidentMemoryKB_value(server.childProcesses ? server.childResidentBytes / 1024 / server.childProcesses : 0);
+            inst.AverageChildPctCPU_value(server.childPercentCPU);
         }
 
         context.Post(inst);
@@ -40,6 +40,7 @@
 
 #include "apachebinding.h"
 #include "cimconstants.h"
+#include "instancecache.h"
 #include "utils.h"
 #include "buildversion.h"
 
@@ -56,6 +57,9 @@ const char *OperatingStatusValues[] =
 
 MI_BEGIN_NAMESPACE
 
+// The instance (while Apache is up) only changes when Apache reloads its configuration
+static InstanceCache<Apache_HTTPDServer_Class> s_instanceCache;
+
 /* Check if native systemd services are supported, and if service exists under systemd */
 static int CheckServiceSystemd(apr_pool_t* pool, const char* serviceName)
 {
@@ -170,6 +174,133 @@ static int CheckServiceSystemd(apr_pool_t* pool, const char* serviceName)
 #endif // defined(linux)
 }
 
+/* Build the instance, with normal results if attached to the Apache server's region */
+static void BuildInstance(Apache_HTTPDServer_Class& inst, bool keysOnly, ApacheDataCollector& data, bool fAttached)
+{
+    static char s_ServerConfigFile[PATH_MAX];
+    static char s_ServerVersion[96];
+
+    apr_pool_t* pool = data.GetPool();
+    std::stringstream ss;
+    const char* serviceName = "_Unknown";
+
+    // Common code (regardless of if we attach to shared memory segment or not)
+
+    if (! keysOnly)
+    {
+        // Build the version string
+        ss << CIMPROV_BUILDVERSION_MAJOR
+           << "." << CIMPROV_BUILDVERSION_MINOR
+           << "." << CIMPROV_BUILDVERSION_PATCH
+           << "-" << CIMPROV_BUILDVERSION_BUILDNR
+           << " (" << CIMPROV_BUILDVERSION_DATE << ")";
+
+#if defined(linux)
+        int status;
+        status = CheckServiceSystemd(pool, "httpd");
+        if ( status >= 0 )
+        {
+            if ( 0 == status )
+            {
+                serviceName = "httpd";
+            }
+            else
+            {
+                if ( 0 == CheckServiceSystemd(pool, "apache2") )
+                {
+                    serviceName = "apache2";
+                }
+            }
+        }
+        else
+        {
+            status = system("service httpd status > /dev/null 2>&1");
+            status = WEXITSTATUS( status );
+            if (status == 0 || status == 3)
+            {
+                serviceName = "httpd";
+            }
+            else
+            {
+                status = system("service apache2 status > /dev/null 2>&1");
+                status = WEXITSTATUS( status );
+                if (status == 0 || status == 3)
+                {
+                    serviceName = "apache2";
+                }
+            }
+        }
+#endif
+    }
+
+    if (fAttached)
+    {
+        const char* apacheServerVersion = GetApacheComponentVersion(data.GetServerVersion(), "Apache");
+
+        // Save values for reporting if unable to attach next time 'round
+        // (WI 693191: Make Apache_HTTPDSeerver properties sticky)
+
+        strncpy(s_ServerConfigFile, data.GetServerConfigFile(), sizeof(s_ServerConfigFile));
+        strncpy(s_ServerVersion, apacheServerVersion, sizeof(s_ServerVersion));
+
+        inst.ProductIdentifyingNumber_value("1");   /* serial number */
+        inst.ProductName_value(data.GetServerConfigFile());
+        inst.ProductVendor_value(APACHE_VENDOR_ID);
+        inst.ProductVersion_value(apacheServerVersion);
+        inst.SystemID_value(data.GetServerID());
+        inst.CollectionID_value(data.GetServerRoot());
+
+        if (! keysOnly)
+        {
+            std::string processName;
+            g_pFactory->GetInit()->GetApacheProcessName(processName);
+
+            // Insert the values into the instance
+
+            inst.ModuleVersion_value(ss.str().c_str());
+            inst.InstanceID_value(data.GetServerConfigFile());
+            inst.ConfigurationFile_value(data.GetServerConfigFile());
+            inst.ProcessName_value(processName.c_str());
+            inst.ServiceName_value(serviceName);
+            inst.OperatingStatus_value(OperatingStatusValues[2]); // Server us up
+
+            std::vector<mi::String> strArrary;
+            std::string modulesFormatted;
+            for (apr_size_t moduleNum = 0; moduleNum < data.GetModuleCount(); moduleNum++)
+            {
+                const char *moduleName = data.GetDataString(data.GetServerModules()[moduleNum].moduleNameOffset);
+                strArrary.push_back(moduleName);
+                if (modulesFormatted.size())
+                {
+                    modulesFormatted += ", ";
+                }
+                modulesFormatted += moduleName;
+            }
+            mi::StringA modules(&strArrary[0], data.GetModuleCount());
+            inst.InstalledModules_value(modules);
+            inst.InstalledModulesFormatted_value(modulesFormatted.c_str());
+        }
+    }
+    else
+    {
+        inst.ProductIdentifyingNumber_value("1");   /* serial number */
+        inst.ProductName_value(s_ServerConfigFile[0] ? s_ServerConfigFile : "Unknown");
+        inst.ProductVendor_value(APACHE_VENDOR_ID);
+        inst.ProductVersion_value(s_ServerVersion[0] ? s_ServerVersion : "Unknown");
+        inst.SystemID_value("Unknown");
+        inst.CollectionID_value("Unknown");
+
+        if (! keysOnly)
+        {
+            inst.ModuleVersion_value(ss.str().c_str());
+            inst.ServiceName_value(serviceName);
+            inst.OperatingStatus_value(OperatingStatusValues[6]); // Server state: Error
+
+            inst.InstanceID_value(s_ServerConfigFile[0] ? s_ServerConfigFile : "Unknown");
+        }
+    }
+}
+
 Apache_HTTPDServer_Class_Provider::Apache_HTTPDServer_Class_Provider(
     Module* module) :
     m_Module(module)
@@ -196,6 +327,13 @@ void Apache_HTTPDServer_Class_Provider::Load(
             return;
         }
 
+        // Not fatal; the instance is just built every time
+        apr_status_t status = s_instanceCache.Initialize(g_pFactory->GetInit()->GetPool());
+        if (APR_SUCCESS != status)
+        {
+            DisplayError(status, "Apache_HTTPDServer_Class_Provider::Load: failed to create instance cache");
+        }
+
         // Notify that we don't wish to unload
         MI_Result r = context.RefuseUnload();
         if ( MI_RESULT_OK != r )
@@ -213,6 +351,8 @@ void Apache_HTTPDServer_Class_Provider::Unload(
 {
     CIM_PEX_BEGIN
     {
+        s_instanceCache.Shutdown();
+
         if (APR_SUCCESS != g_pFactory->GetInit()->Unload("Server"))
         {
             context.Post(MI_RESULT_FAILED);
@@ -231,136 +371,26 @@ void Apache_HTTPDServer_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    static char s_ServerConfigFile[PATH_MAX];
-    static char s_ServerVersion[96];
-
     CIM_PEX_BEGIN
     {
-        ApacheDataCollector data = g_pFactory->DataCollectorFactory();
-        apr_pool_t* pool = data.GetPool();
+        ApacheDataCollector data;
         Apache_HTTPDServer_Class inst;
 
-        std::stringstream ss;
-        const char* serviceName = "_Unknown";
-
-        // Common code (regardless of if we attach to shared memory segment or not)
-
-        if (! keysOnly)
-        {
-            // Build the version string
-            ss << CIMPROV_BUILDVERSION_MAJOR
-               << "." << CIMPROV_BUILDVERSION_MINOR
-               << "." << CIMPROV_BUILDVERSION_PATCH
-               << "-" << CIMPROV_BUILDVERSION_BUILDNR
-               << " (" << CIMPROV_BUILDVERSION_DATE << ")";
-
-#if defined(linux)
-            int status;
-            status = CheckServiceSystemd(pool, "httpd");
-            if ( status >= 0 )
-            {
-                if ( 0 == status )
-                {
-                    serviceName = "httpd";
-                }
-                else
-                {
-                    if ( 0 == CheckServiceSystemd(pool, "apache2") )
-                    {
-                        serviceName = "apache2";
-                    }
-                }
-            }
-            else
-            {
-                status = system("service httpd status > /dev/null 2>&1");
-                status = WEXITSTATUS( status );
-                if (status == 0 || status == 3)
-                {
-                    serviceName = "httpd";
-                }
-                else
-                {
-                    status = system("service apache2 status > /dev/null 2>&1");
-                    status = WEXITSTATUS( status );
-                    if (status == 0 || status == 3)
-                    {
-                        serviceName = "apache2";
-                    }
-                }
-            }
-#endif
-        }
-
         if (APR_SUCCESS == data.Attach("Apache_HTTPDServer_Class_Provider::EnumerateInstances"))
         {
-            const char* apacheServerVersion = GetApacheComponentVersion(data.GetServerVersion(), "Apache");
-
-            // Save values for reporting if unable to attach next time 'round
-            // (WI 693191: Make Apache_HTTPDSeerver properties sticky)
+            // Successfully attached to memory segment; provide normal results (built once per configuration)
 
-            strncpy(s_ServerConfigFile, data.GetServerConfigFile(), sizeof(s_ServerConfigFile));
-            strncpy(s_ServerVersion, apacheServerVersion, sizeof(s_ServerVersion));
-
-            // Successfully attached to memory segment; provide normal results
-
-            inst.ProductIdentifyingNumber_value("1");   /* serial number */
-            inst.ProductName_value(data.GetServerConfigFile());
-            inst.ProductVendor_value(APACHE_VENDOR_ID);
-            inst.ProductVersion_value(apacheServerVersion);
-            inst.SystemID_value(data.GetServerID());
-            inst.CollectionID_value(data.GetServerRoot());
-
-            if (! keysOnly)
+            if (! s_instanceCache.Lookup(data.GetGeneration(), keysOnly, 0, inst))
             {
-                std::string processName;
-                g_pFactory->GetInit()->GetApacheProcessName(processName);
-
-                // Insert the values into the instance
-
-                inst.ModuleVersion_value(ss.str().c_str());
-                inst.InstanceID_value(data.GetServerConfigFile());
-                inst.ConfigurationFile_value(data.GetServerConfigFile());
-                inst.ProcessName_value(processName.c_str());
-                inst.ServiceName_value(serviceName);
-                inst.OperatingStatus_value(OperatingStatusValues[2]); // Server us up
-
-                std::vector<mi::String> strArrary;
-                std::string modulesFormatted;
-                for (apr_size_t moduleNum = 0; moduleNum < data.GetModuleCount(); moduleNum++)
-                {
-                    const char *moduleName = data.GetDataString(data.GetServerModules()[moduleNum].moduleNameOffset);
-                    strArrary.push_back(moduleName);
-                    if (modulesFormatted.size())
-                    {
-                        modulesFormatted += ", ";
-                    }
-                    modulesFormatted += moduleName;
-                }
-                mi::StringA modules(&strArrary[0], data.GetModuleCount());
-                inst.InstalledModules_value(modules);
-                inst.InstalledModulesFormatted_value(modulesFormatted.c_str());
+                BuildInstance(inst, keysOnly, data, true);
+                s_instanceCache.Store(data.GetGeneration(), keysOnly, 0, inst);
             }
         }
         else
         {
             // We can't attach, so provide a minimal response indicating the server is down
 
-            inst.ProductIdentifyingNumber_value("1");   /* serial number */
-            inst.ProductName_value(s_ServerConfigFile[0] ? s_ServerConfigFile : "Unknown");
-            inst.ProductVendor_value(APACHE_VENDOR_ID);
-            inst.ProductVersion_value(s_ServerVersion[0] ? s_ServerVersion : "Unknown");
-            inst.SystemID_value("Unknown");
-            inst.CollectionID_value("Unknown");
-
-            if (! keysOnly)
-            {
-                inst.ModuleVersion_value(ss.str().c_str());
-                inst.ServiceName_value(serviceName);
-                inst.OperatingStatus_value(OperatingStatusValues[6]); // Server state: Error
-
-                inst.InstanceID_value(s_ServerConfigFile[0] ? s_ServerConfigFile : "Unknown");
-            }
+            BuildInstance(inst, keysOnly, data, false);
         }
 
         context.Post(inst);
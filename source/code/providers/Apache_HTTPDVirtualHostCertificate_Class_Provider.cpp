@@ -43,143 +43,6 @@
 #include "utils.h"
 #include "Apache_HTTPDVirtualHostCertificate_Class_Provider.h"
 
-static char s_monNames[12][4] =
-{
-    "Jan",
-    "Feb",
-    "Mar",
-    "Apr",
-    "May",
-    "Jun",
-    "Jul",
-    "Aug",
-    "Sep",
-    "Oct",
-    "Nov",
-    "Dec"
-};
-
-// Get an SSL certificate expiration date and days until it expires
-static int GetCertificateExpirationDate(
-    const char* file,
-    apr_pool_t* pool,
-    char* date,
-    apr_time_t* expirationAprTime)
-{
-    char dateString[64];
-    char buf[128];
-    char monName[8];
-    int year, month, day, hour, min, sec;
-    struct tm tmBuf;
-    apr_status_t status;
-    apr_proc_t proc;
-    apr_procattr_t *pattr;
-    apr_exit_why_e why;
-    int exitCode;
-    const char* args[] =
-    {
-        "/usr/bin/openssl",
-        "x509",
-        "-in",
-        file,
-        "-enddate",
-        NULL
-    };
-    char* const* argptr =  const_cast<char* const*>(args);
-
-    // Initialize the process attribute
-    status = apr_procattr_create(&pattr, pool);
-    if (status != APR_SUCCESS)
-    {
-        DisplayError(status, "GetCertificateExpirationDate: error creating openssl child process attributes");
-        return -1;
-    }
-
-    // Set up the pipe of stdout from the child to this process' proc.out
-    status = apr_procattr_io_set(pattr, APR_NO_PIPE, APR_FULL_BLOCK, APR_NO_PIPE);
-    if (status != APR_SUCCESS)
-    {
-        DisplayError(status, "GetCertificateExpirationDate: error setting openssl child process i/o attributes");
-        return -1;
-    }
-
-    // Make the openssl program be run using the PATH variable
-    status = apr_procattr_cmdtype_set(pattr, APR_PROGRAM_PATH);
-    if (status != APR_SUCCESS)
-    {
-        DisplayError(status, "GetCertificateExpirationDate: error setting openssl child process command type");
-        return -1;
-    }
-
-    // Run the openssl binary
-    status = apr_proc_create(&proc, "openssl", argptr, NULL, (apr_procattr_t*)pattr, pool);
-    if (status != APR_SUCCESS)
-    {
-        DisplayError(status, "GetCertificateExpirationDate: error creating openssl child process");
-        return -1;
-    }
-
-    // Read the first line from the child process stdout
-    status = apr_file_gets(dateString, sizeof(dateString), proc.out);
-    if (status != APR_SUCCESS)
-    {
-        DisplayError(status, "GetCertificateExpirationDate: error reading openssl process output");
-        return -1;
-    }
-
-    // Drain the output from the child process
-    while (apr_file_gets(buf, 128, proc.out) == APR_SUCCESS)
-    {
-        ;
-    }
-
-    // Wait for the child process to finish
-    status = apr_proc_wait(&proc, &exitCode, &why, APR_WAIT);
-    if (!APR_STATUS_IS_CHILD_DONE(status))
-    {
-        DisplayError(status, "GetCertificateExpirationDate: openssl process did not finish successfully");
-        return -1;
-    }
-
-    // check for format: "notAfter=Mmm dd hh:mm:ss yyyy GMT", with Mmm
-    // being a three-letter Engish abbreviation for the month name
-    if (strncmp(dateString, "notAfter=", 9) != 0)
-    {
-        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter date");
-        return -1;
-    }
-    if (sscanf(&dateString[9], "%3s%d%d:%d:%d %d", monName, &day, &hour, &min, &sec, &year) < 6)
-    {
-        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter date");
-        return -1;
-    }
-    for (month = 0; month < 12; month++)
-    {
-        if (apr_strnatcasecmp(monName, s_monNames[month]) == 0)
-            break;
-    }
-    if (month == 12)
-    {
-        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter month");
-        return -1;
-    }
-
-    // Set the expiration date in CIM time
-    sprintf(date, "%04d%02d%02d%02d%02d%02d.000000+000", year, month+1, day, hour, min, sec);
-
-    // Compute APR time of expiration
-    memset(&tmBuf, 0, sizeof (struct tm));   // set DST and time zone to 0
-    tmBuf.tm_year = year - 1900;
-    tmBuf.tm_mon = month;
-    tmBuf.tm_mday = day;
-    tmBuf.tm_hour = hour;
-    tmBuf.tm_min = min;
-    tmBuf.tm_sec = sec;
-    *expirationAprTime = (apr_time_t)mktime(&tmBuf) * 1000000;
-
-    return 0;
-}
-
 #if !defined(_WIN32)
 
 static apr_uint32_t QuickHash(const char* str)
@@ -200,7 +63,7 @@ static apr_uint32_t QuickHash(const char* str)
 MI_BEGIN_NAMESPACE
 
 static void EnumerateOneInstance(
-    Context& context,
+    std::vector<Apache_HTTPDVirtualHostCertificate_Class>& instances,
     bool keysOnly,
     apr_size_t item,
     ApacheDataCollector& data)
@@ -242,9 +105,7 @@ static void EnumerateOneInstance(
 
     if (!keysOnly)
     {
-        apr_finfo_t fileInfo;
         apr_time_t timeNow;
-        apr_status_t status;
 
         // Insert the appropriate value to map the certficate to the virtual host
         inst.VirtualHost_value(data.GetDataString(certs[item].virtualHostOffset));
@@ -253,20 +114,10 @@ static void EnumerateOneInstance(
         // Insert the certificate file dates
         timeNow = apr_time_now();
 
-        // See if the file is newer that the stored dates
-        status = apr_stat(&fileInfo, certificateFileName, APR_FINFO_MTIME, data.GetPool());
-        if (status != APR_SUCCESS || fileInfo.mtime != certs[item].certificateFileMtime)
+        // The DataSampler refreshes certificate dates hourly; only look now if we have none
+        if (0 == certs[item].certificateFileMtime)
         {
-            // Get an updated copy of the certificate date information
-            certs[item].certificateFileMtime = fileInfo.mtime;
-            if (GetCertificateExpirationDate(certificateFileName,
-                                             data.GetPool(),
-                                             certs[item].certificateExpirationCimTime,
-                                             &certs[item].certificateExpirationAprTime) < 0)
-            {
-                // Problem getting certificate expiration information; try later
-                certs[item].certificateFileMtime = 0;
-            }
+            data.RefreshCertificate(item);
         }
 
         // Supply expiration information if we were able to compute it
@@ -286,7 +137,7 @@ static void EnumerateOneInstance(
         }
     }
 
-    context.Post(inst);
+    instances.push_back(inst);
 
     return;
 }
@@ -352,11 +203,13 @@ void Apache_HTTPDVirtualHostCertificate_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    ApacheDataCollector data = g_pFactory->DataCollectorFactory();
+    ApacheDataCollector data;
 
     CIM_PEX_BEGIN
     {
-        apr_status_t status;
+        std::vector<Apache_HTTPDVirtualHostCertificate_Class> instances;
+        apr_uint32_t sequence;
+        int attempt = 0;
 
         if (APR_SUCCESS != data.Attach("Apache_HTTPDVirtualHostCertificate_Class_Provider::EnumerateInstances"))
         {
@@ -364,25 +217,35 @@ void Apache_HTTPDVirtualHostCertificate_Class_Provider::EnumerateInstances(
             return;
         }
 
-        // Lock the mutex to walk the list
-        if (APR_SUCCESS != (status = data.LockMutex()))
+        // Build the instances from a consistent view of the region, without holding
+        // the global mutex (which would keep Apache waiting if it reloads meanwhile)
+        do
         {
-            DisplayError(status, "VirtualHostCertificate::EnumerateInstances: failed to lock mutex");
-            context.Post(MI_RESULT_FAILED);
-            return;
-        }
+            if (++attempt > ApacheDataCollector::ReadAttempts
+                || (attempt > 1 && APR_SUCCESS != data.Reattach("Apache_HTTPDVirtualHostCertificate_Class_Provider::EnumerateInstances")))
+            {
+                DisplayError(0, "VirtualHostCertificate::EnumerateInstances: shared memory region changed while reading");
+                context.Post(MI_RESULT_FAILED);
+                return;
+            }
+
+            sequence = data.ReadBegin();
+            instances.clear();
+
+            for (apr_size_t item = 0; item < data.GetCertificateCount(); item++)
+            {
+                EnumerateOneInstance(instances, keysOnly, item, data);
+            }
+        } while (data.ReadRetry(sequence));
 
-        for (apr_size_t item = 0; item < data.GetCertificateCount(); item++)
+        for (size_t i = 0; i < instances.size(); i++)
         {
-            EnumerateOneInstance(context, keysOnly, item, data);
+            context.Post(instances[i]);
         }
 
         context.Post(MI_RESULT_OK);
     }
     CIM_PEX_END( "Apache_HTTPDVirtualHostCertificate_Class_Provider::EnumerateInstances" );
-
-    // Be sure mutex gets unlocked, regardless if an exception occurs
-    data.UnlockMutex();
 }
 
 void Apache_HTTPDVirtualHostCertificate_Class_Provider::GetInstance(
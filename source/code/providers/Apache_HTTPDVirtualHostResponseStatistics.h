@@ -0,0 +1,2129 @@
+/* @migen@ */
+/*
+**==============================================================================
+**
+** WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. PLEASE DO NOT EDIT.
+**
+**==============================================================================
+*/
+#ifndef _Apache_HTTPDVirtualHostResponseStatistics_h
+#define _Apache_HTTPDVirtualHostResponseStatistics_h
+
+#include <MI.h>
+#include "CIM_StatisticalData.h"
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostResponseStatistics [Apache_HTTPDVirtualHostResponseStatistics]
+**
+** Keys:
+**    InstanceID
+**
+**==============================================================================
+*/
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics /* extends CIM_StatisticalData */
+{
+    MI_Instance __instance;
+    /* CIM_ManagedElement properties */
+    /*KEY*/ MI_ConstStringField InstanceID;
+    MI_ConstStringField Caption;
+    MI_ConstStringField Description;
+    MI_ConstStringField ElementName;
+    /* CIM_StatisticalData properties */
+    MI_ConstDatetimeField StartStatisticTime;
+    MI_ConstDatetimeField StatisticTime;
+    MI_ConstDatetimeField SampleInterval;
+    /* Apache_HTTPDVirtualHostResponseStatistics properties */
+    MI_ConstStringField ServerName;
+    MI_ConstUint64Field ResponseCount1xx;
+    MI_ConstUint64Field ResponseCount2xx;
+    MI_ConstUint64Field ResponseCount3xx;
+    MI_ConstUint64Field ResponseCount4xx;
+    MI_ConstUint64Field ResponseCount5xx;
+    MI_ConstUint64Field ResponseCount404;
+    MI_ConstUint64Field ResponseCount429;
+    MI_ConstUint64Field ResponseCount499;
+    MI_ConstUint64Field ResponseCount502;
+    MI_ConstUint64Field ResponseCount503;
+    MI_ConstUint64Field ResponseCount504;
+    MI_ConstUint64Field AbortedCount;
+    MI_ConstUint32Field ResponsesPerMinute1xx;
+    MI_ConstUint32Field ResponsesPerMinute2xx;
+    MI_ConstUint32Field ResponsesPerMinute3xx;
+    MI_ConstUint32Field ResponsesPerMinute4xx;
+    MI_ConstUint32Field ResponsesPerMinute5xx;
+    MI_ConstUint32Field ResponsesPerMinute404;
+    MI_ConstUint32Field ResponsesPerMinute429;
+    MI_ConstUint32Field ResponsesPerMinute499;
+    MI_ConstUint32Field ResponsesPerMinute502;
+    MI_ConstUint32Field ResponsesPerMinute503;
+    MI_ConstUint32Field ResponsesPerMinute504;
+    MI_ConstUint32Field AbortedPerMinute;
+}
+Apache_HTTPDVirtualHostResponseStatistics;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_Ref
+{
+    Apache_HTTPDVirtualHostResponseStatistics* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostResponseStatistics_Ref;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_ConstRef
+{
+    MI_CONST Apache_HTTPDVirtualHostResponseStatistics* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostResponseStatistics_ConstRef;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_Array
+{
+    struct _Apache_HTTPDVirtualHostResponseStatistics** data;
+    MI_Uint32 size;
+}
+Apache_HTTPDVirtualHostResponseStatistics_Array;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_ConstArray
+{
+    struct _Apache_HTTPDVirtualHostResponseStatistics MI_CONST* MI_CONST* data;
+    MI_Uint32 size;
+}
+Apache_HTTPDVirtualHostResponseStatistics_ConstArray;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_ArrayRef
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Array value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostResponseStatistics_ArrayRef;
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_ConstArrayRef
+{
+    Apache_HTTPDVirtualHostResponseStatistics_ConstArray value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostResponseStatistics_ConstArrayRef;
+
+MI_EXTERN_C MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostResponseStatistics_rtti;
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Construct(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Context* context)
+{
+    return MI_ConstructInstance(context, &Apache_HTTPDVirtualHostResponseStatistics_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clone(
+    const Apache_HTTPDVirtualHostResponseStatistics* self,
+    Apache_HTTPDVirtualHostResponseStatistics** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Boolean MI_CALL Apache_HTTPDVirtualHostResponseStatistics_IsA(
+    const MI_Instance* self)
+{
+    MI_Boolean res = MI_FALSE;
+    return MI_Instance_IsA(self, &Apache_HTTPDVirtualHostResponseStatistics_rtti, &res) == MI_RESULT_OK && res;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Destruct(Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Delete(Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Post(
+    const Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_InstanceID(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_SetPtr_InstanceID(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_InstanceID(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_Caption(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_SetPtr_Caption(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_Caption(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_Description(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_SetPtr_Description(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_Description(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ElementName(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_SetPtr_ElementName(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ElementName(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        3);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_StartStatisticTime(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->StartStatisticTime)->value = x;
+    ((MI_DatetimeField*)&self->StartStatisticTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_StartStatisticTime(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->StartStatisticTime, 0, sizeof(self->StartStatisticTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_StatisticTime(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->StatisticTime)->value = x;
+    ((MI_DatetimeField*)&self->StatisticTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_StatisticTime(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->StatisticTime, 0, sizeof(self->StatisticTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_SampleInterval(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->SampleInterval)->value = x;
+    ((MI_DatetimeField*)&self->SampleInterval)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_SampleInterval(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->SampleInterval, 0, sizeof(self->SampleInterval));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ServerName(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_SetPtr_ServerName(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ServerName(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        7);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount1xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount1xx)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount1xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount1xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount1xx, 0, sizeof(self->ResponseCount1xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount2xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount2xx)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount2xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount2xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount2xx, 0, sizeof(self->ResponseCount2xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount3xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount3xx)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount3xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount3xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount3xx, 0, sizeof(self->ResponseCount3xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount4xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount4xx)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount4xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount4xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount4xx, 0, sizeof(self->ResponseCount4xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount5xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount5xx)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount5xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount5xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount5xx, 0, sizeof(self->ResponseCount5xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount404(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount404)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount404)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount404(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount404, 0, sizeof(self->ResponseCount404));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount429(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount429)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount429)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount429(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount429, 0, sizeof(self->ResponseCount429));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount499(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount499)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount499)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount499(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount499, 0, sizeof(self->ResponseCount499));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount502(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount502)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount502)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount502(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount502, 0, sizeof(self->ResponseCount502));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount503(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount503)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount503)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount503(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount503, 0, sizeof(self->ResponseCount503));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponseCount504(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->ResponseCount504)->value = x;
+    ((MI_Uint64Field*)&self->ResponseCount504)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponseCount504(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponseCount504, 0, sizeof(self->ResponseCount504));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_AbortedCount(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->AbortedCount)->value = x;
+    ((MI_Uint64Field*)&self->AbortedCount)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_AbortedCount(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->AbortedCount, 0, sizeof(self->AbortedCount));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute1xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute1xx)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute1xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute1xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute1xx, 0, sizeof(self->ResponsesPerMinute1xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute2xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute2xx)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute2xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute2xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute2xx, 0, sizeof(self->ResponsesPerMinute2xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute3xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute3xx)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute3xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute3xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute3xx, 0, sizeof(self->ResponsesPerMinute3xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute4xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute4xx)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute4xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute4xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute4xx, 0, sizeof(self->ResponsesPerMinute4xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute5xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute5xx)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute5xx)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute5xx(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute5xx, 0, sizeof(self->ResponsesPerMinute5xx));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute404(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute404)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute404)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute404(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute404, 0, sizeof(self->ResponsesPerMinute404));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute429(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute429)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute429)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute429(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute429, 0, sizeof(self->ResponsesPerMinute429));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute499(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute499)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute499)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute499(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute499, 0, sizeof(self->ResponsesPerMinute499));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute502(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute502)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute502)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute502(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute502, 0, sizeof(self->ResponsesPerMinute502));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute503(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute503)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute503)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute503(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute503, 0, sizeof(self->ResponsesPerMinute503));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_ResponsesPerMinute504(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ResponsesPerMinute504)->value = x;
+    ((MI_Uint32Field*)&self->ResponsesPerMinute504)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_ResponsesPerMinute504(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->ResponsesPerMinute504, 0, sizeof(self->ResponsesPerMinute504));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Set_AbortedPerMinute(
+    Apache_HTTPDVirtualHostResponseStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->AbortedPerMinute)->value = x;
+    ((MI_Uint32Field*)&self->AbortedPerMinute)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Clear_AbortedPerMinute(
+    Apache_HTTPDVirtualHostResponseStatistics* self)
+{
+    memset((void*)&self->AbortedPerMinute, 0, sizeof(self->AbortedPerMinute));
+    return MI_RESULT_OK;
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostResponseStatistics.ResetSelectedStats()
+**
+**==============================================================================
+*/
+
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstUint32Field MIReturn;
+    /*IN*/ MI_ConstStringAField SelectedStatistics;
+}
+Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti;
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Construct(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Clone(
+    const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Destruct(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Delete(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Post(
+    const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Set_MIReturn(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->MIReturn)->value = x;
+    ((MI_Uint32Field*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Clear_MIReturn(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Set_SelectedStatistics(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_SetPtr_SelectedStatistics(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Clear_SelectedStatistics(
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostResponseStatistics provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _Apache_HTTPDVirtualHostResponseStatistics_Self Apache_HTTPDVirtualHostResponseStatistics_Self;
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Load(
+    Apache_HTTPDVirtualHostResponseStatistics_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Unload(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_EnumerateInstances(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_GetInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_CreateInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* newInstance);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ModifyInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* modifiedInstance,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_DeleteInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Invoke_ResetSelectedStats(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName,
+    const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* in);
+
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostResponseStatistics_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class Apache_HTTPDVirtualHostResponseStatistics_Class : public CIM_StatisticalData_Class
+{
+public:
+    
+    typedef Apache_HTTPDVirtualHostResponseStatistics Self;
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class() :
+        CIM_StatisticalData_Class(&Apache_HTTPDVirtualHostResponseStatistics_rtti)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class(
+        const Apache_HTTPDVirtualHostResponseStatistics* instanceName,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(
+            &Apache_HTTPDVirtualHostResponseStatistics_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_StatisticalData_Class(clDecl)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class& operator=(
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_Class(
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& x) :
+        CIM_StatisticalData_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &Apache_HTTPDVirtualHostResponseStatistics_rtti;
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ServerName
+    //
+    
+    const Field<String>& ServerName() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n);
+    }
+    
+    void ServerName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ServerName_value() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).value;
+    }
+    
+    void ServerName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ServerName_exists() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ServerName_clear()
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount1xx
+    //
+    
+    const Field<Uint64>& ResponseCount1xx() const
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount1xx(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount1xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount1xx_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount1xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount1xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount1xx);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount2xx
+    //
+    
+    const Field<Uint64>& ResponseCount2xx() const
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount2xx(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount2xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount2xx_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount2xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount2xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount2xx);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount3xx
+    //
+    
+    const Field<Uint64>& ResponseCount3xx() const
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount3xx(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount3xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount3xx_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount3xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount3xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount3xx);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount4xx
+    //
+    
+    const Field<Uint64>& ResponseCount4xx() const
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount4xx(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount4xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount4xx_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount4xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount4xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount4xx);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount5xx
+    //
+    
+    const Field<Uint64>& ResponseCount5xx() const
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount5xx(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount5xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount5xx_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount5xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount5xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount5xx);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount404
+    //
+    
+    const Field<Uint64>& ResponseCount404() const
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount404(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount404_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount404_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount404_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount404_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount404);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount429
+    //
+    
+    const Field<Uint64>& ResponseCount429() const
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount429(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount429_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount429_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount429_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount429_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount429);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount499
+    //
+    
+    const Field<Uint64>& ResponseCount499() const
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount499(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount499_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount499_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount499_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount499_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount499);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount502
+    //
+    
+    const Field<Uint64>& ResponseCount502() const
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount502(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount502_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount502_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount502_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount502_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount502);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount503
+    //
+    
+    const Field<Uint64>& ResponseCount503() const
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount503(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount503_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount503_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount503_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount503_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount503);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponseCount504
+    //
+    
+    const Field<Uint64>& ResponseCount504() const
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        return GetField<Uint64>(n);
+    }
+    
+    void ResponseCount504(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ResponseCount504_value() const
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ResponseCount504_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ResponseCount504_exists() const
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ResponseCount504_clear()
+    {
+        const size_t n = offsetof(Self, ResponseCount504);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.AbortedCount
+    //
+    
+    const Field<Uint64>& AbortedCount() const
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        return GetField<Uint64>(n);
+    }
+    
+    void AbortedCount(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& AbortedCount_value() const
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void AbortedCount_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool AbortedCount_exists() const
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void AbortedCount_clear()
+    {
+        const size_t n = offsetof(Self, AbortedCount);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute1xx
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute1xx() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute1xx(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute1xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute1xx_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute1xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute1xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute1xx);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute2xx
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute2xx() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute2xx(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute2xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute2xx_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute2xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute2xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute2xx);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute3xx
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute3xx() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute3xx(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute3xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute3xx_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute3xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute3xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute3xx);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute4xx
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute4xx() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute4xx(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute4xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute4xx_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute4xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute4xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute4xx);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute5xx
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute5xx() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute5xx(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute5xx_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute5xx_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute5xx_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute5xx_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute5xx);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute404
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute404() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute404(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute404_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute404_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute404_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute404_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute404);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute429
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute429() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute429(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute429_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute429_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute429_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute429_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute429);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute499
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute499() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute499(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute499_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute499_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute499_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute499_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute499);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute502
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute502() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute502(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute502_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute502_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute502_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute502_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute502);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute503
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute503() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute503(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute503_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute503_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute503_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute503_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute503);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.ResponsesPerMinute504
+    //
+    
+    const Field<Uint32>& ResponsesPerMinute504() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        return GetField<Uint32>(n);
+    }
+    
+    void ResponsesPerMinute504(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ResponsesPerMinute504_value() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ResponsesPerMinute504_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ResponsesPerMinute504_exists() const
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ResponsesPerMinute504_clear()
+    {
+        const size_t n = offsetof(Self, ResponsesPerMinute504);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_Class.AbortedPerMinute
+    //
+    
+    const Field<Uint32>& AbortedPerMinute() const
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        return GetField<Uint32>(n);
+    }
+    
+    void AbortedPerMinute(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& AbortedPerMinute_value() const
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void AbortedPerMinute_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool AbortedPerMinute_exists() const
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void AbortedPerMinute_clear()
+    {
+        const size_t n = offsetof(Self, AbortedPerMinute);
+        GetField<Uint32>(n).Clear();
+    }
+};
+
+typedef Array<Apache_HTTPDVirtualHostResponseStatistics_Class> Apache_HTTPDVirtualHostResponseStatistics_ClassA;
+
+class Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class : public Instance
+{
+public:
+    
+    typedef Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats Self;
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class() :
+        Instance(&Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class(
+        const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* instanceName,
+        bool keysOnly) :
+        Instance(
+            &Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class& operator=(
+        const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class(
+        const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class.MIReturn
+    //
+    
+    const Field<Uint32>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n);
+    }
+    
+    void MIReturn(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void MIReturn_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class.SelectedStatistics
+    //
+    
+    const Field<StringA>& SelectedStatistics() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n);
+    }
+    
+    void SelectedStatistics(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& SelectedStatistics_value() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n).value;
+    }
+    
+    void SelectedStatistics_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool SelectedStatistics_exists() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void SelectedStatistics_clear()
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n).Clear();
+    }
+};
+
+typedef Array<Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class> Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_ClassA;
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _Apache_HTTPDVirtualHostResponseStatistics_h */
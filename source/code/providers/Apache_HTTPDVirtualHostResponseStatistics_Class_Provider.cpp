@@ -0,0 +1,251 @@
+/* @migen@ */
+
+//
+//--------------------------------- START OF LICENSE ----------------------------
+//
+// Apache Cimprov ver. 1.0
+//
+// Copyright (c) Microsoft Corporation
+//
+// All rights reserved. 
+//
+// Licensed under the Apache License, Version 2.0 (the License); you may not use
+// this file except in compliance with the license. You may obtain a copy of the
+// License at http://www.apache.org/licenses/LICENSE-2.0 
+//
+// THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+// WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+// MERCHANTABLITY OR NON-INFRINGEMENT.
+//
+// See the Apache Version 2.0 License for specific language governing permissions
+// and limitations under the License.
+//
+//---------------------------------- END OF LICENSE -----------------------------
+//
+
+#include <MI.h>
+#include "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider.h"
+
+// Provider include definitions
+#include "apachebinding.h"
+
+#include <vector>
+
+
+MI_BEGIN_NAMESPACE
+
+static void EnumerateOneInstance(std::vector<Apache_HTTPDVirtualHostResponseStatistics_Class>& instances,
+        bool keysOnly,
+        apr_size_t item,
+        ApacheDataCollector& data,
+        const ApacheVHostSnapshot& vhost)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class inst;
+
+    // Insert the key into the instance
+    inst.InstanceID_value(data.GetVHostInstanceID(item));
+
+    if (! keysOnly)
+    {
+        // Insert the values into the instance
+
+        inst.ServerName_value(data.GetVHostName(item));
+        inst.ResponseCount1xx_value(vhost.responses[MMAP_RESPONSE_1XX]);
+        inst.ResponseCount2xx_value(vhost.responses[MMAP_RESPONSE_2XX]);
+        inst.ResponseCount3xx_value(vhost.responses[MMAP_RESPONSE_3XX]);
+        inst.ResponseCount4xx_value(vhost.responses[MMAP_RESPONSE_4XX]);
+        inst.ResponseCount5xx_value(vhost.responses[MMAP_RESPONSE_5XX]);
+        inst.ResponseCount404_value(vhost.responses[MMAP_RESPONSE_404]);
+        inst.ResponseCount429_value(vhost.responses[MMAP_RESPONSE_429]);
+        inst.ResponseCount499_value(vhost.responses[MMAP_RESPONSE_499]);
+        inst.ResponseCount502_value(vhost.responses[MMAP_RESPONSE_502]);
+        inst.ResponseCount503_value(vhost.responses[MMAP_RESPONSE_503]);
+        inst.ResponseCount504_value(vhost.responses[MMAP_RESPONSE_504]);
+        inst.AbortedCount_value(vhost.responses[MMAP_RESPONSE_ABORTED]);
+
+        // Insert the time-based values into the instance
+
+        inst.ResponsesPerMinute1xx_value(vhost.responsesPerMinute[MMAP_RESPONSE_1XX]);
+        inst.ResponsesPerMinute2xx_value(vhost.responsesPerMinute[MMAP_RESPONSE_2XX]);
+        inst.ResponsesPerMinute3xx_value(vhost.responsesPerMinute[MMAP_RESPONSE_3XX]);
+        inst.ResponsesPerMinute4xx_value(vhost.responsesPerMinute[MMAP_RESPONSE_4XX]);
+        inst.ResponsesPerMinute5xx_value(vhost.responsesPerMinute[MMAP_RESPONSE_5XX]);
+        inst.ResponsesPerMinute404_value(vhost.responsesPerMinute[MMAP_RESPONSE_404]);
+        inst.ResponsesPerMinute429_value(vhost.responsesPerMinute[MMAP_RESPONSE_429]);
+        inst.ResponsesPerMinute499_value(vhost.responsesPerMinute[MMAP_RESPONSE_499]);
+        inst.ResponsesPerMinute502_value(vhost.responsesPerMinute[MMAP_RESPONSE_502]);
+        inst.ResponsesPerMinute503_value(vhost.responsesPerMinute[MMAP_RESPONSE_503]);
+        inst.ResponsesPerMinute504_value(vhost.responsesPerMinute[MMAP_RESPONSE_504]);
+        inst.AbortedPerMinute_value(vhost.responsesPerMinute[MMAP_RESPONSE_ABORTED]);
+    }
+
+    instances.push_back(inst);
+}
+
+Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Apache_HTTPDVirtualHostResponseStatistics_Class_Provider(
+    Module* module) :
+    m_Module(module)
+{
+}
+
+Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::~Apache_HTTPDVirtualHostResponseStatistics_Class_Provider()
+{
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Load(
+        Context& context)
+{
+    CIM_PEX_BEGIN
+    {
+        if (NULL == g_pFactory)
+        {
+            g_pFactory = new ApacheFactory();
+        }
+
+        if (APR_SUCCESS != g_pFactory->GetInit()->Load("VirtualHostResponseStatistics"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        MI_Result r = context.RefuseUnload();
+        if ( MI_RESULT_OK != r )
+        {
+            DisplayError(OMI_Error(r), "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider refuses to not unload");
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Load" );
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Unload(
+        Context& context)
+{
+    CIM_PEX_BEGIN
+    {
+        if (APR_SUCCESS != g_pFactory->GetInit()->Unload("VirtualHostResponseStatistics"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Unload" );
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::EnumerateInstances(
+    Context& context,
+    const String& nameSpace,
+    const PropertySet& propertySet,
+    bool keysOnly,
+    const MI_Filter* filter)
+{
+    ApacheDataCollector data;
+
+    CIM_PEX_BEGIN
+    {
+        std::vector<Apache_HTTPDVirtualHostResponseStatistics_Class> instances;
+        apr_uint32_t sequence;
+        int attempt = 0;
+
+        if (APR_SUCCESS != data.Attach("Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::EnumerateInstances"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        // Build the instances from a consistent view of the region, without holding
+        // the global mutex (which would keep Apache waiting if it reloads meanwhile)
+        do
+        {
+            if (++attempt > ApacheDataCollector::ReadAttempts
+                || (attempt > 1 && APR_SUCCESS != data.Reattach("Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::EnumerateInstances")))
+            {
+                DisplayError(0, "VirtualHostResponseStatistics::EnumerateInstances: shared memory region changed while reading");
+                context.Post(MI_RESULT_FAILED);
+                return;
+            }
+
+            sequence = data.ReadBegin();
+            instances.clear();
+
+            // Serve the counters and rates from a copy taken in one pass
+            const ApacheSnapshot& snapshot = data.Snapshot();
+
+            for (apr_size_t i = 2; i <= snapshot.vhostCount - 1; i++)
+            {
+                if (! snapshot.vhosts[i].active)
+                {
+                    continue;
+                }
+                EnumerateOneInstance(instances, keysOnly, i, data, snapshot.vhosts[i]);
+            }
+
+            // Only display _Unknown if data is saved to it
+            if (snapshot.vhosts[1].requestsTotal)
+            {
+                EnumerateOneInstance(instances, keysOnly, 1, data, snapshot.vhosts[1]);
+            }
+
+            // Support _Total
+            EnumerateOneInstance(instances, keysOnly, 0, data, snapshot.vhosts[0]);
+        } while (data.ReadRetry(sequence));
+
+        for (size_t i = 0; i < instances.size(); i++)
+        {
+            context.Post(instances[i]);
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::EnumerateInstances" );
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::GetInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostResponseStatistics_Class& instanceName,
+    const PropertySet& propertySet)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::CreateInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostResponseStatistics_Class& newInstance)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::ModifyInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostResponseStatistics_Class& modifiedInstance,
+    const PropertySet& propertySet)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::DeleteInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostResponseStatistics_Class& instanceName)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostResponseStatistics_Class_Provider::Invoke_ResetSelectedStats(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostResponseStatistics_Class& instanceName,
+    const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class& in)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+
+MI_END_NAMESPACE
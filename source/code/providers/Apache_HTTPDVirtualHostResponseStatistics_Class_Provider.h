@@ -0,0 +1,81 @@
+/* @migen@ */
+#ifndef _Apache_HTTPDVirtualHostResponseStatistics_Class_Provider_h
+#define _Apache_HTTPDVirtualHostResponseStatistics_Class_Provider_h
+
+#include "Apache_HTTPDVirtualHostResponseStatistics.h"
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+# include "module.h"
+
+MI_BEGIN_NAMESPACE
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostResponseStatistics provider class declaration
+**
+**==============================================================================
+*/
+
+class Apache_HTTPDVirtualHostResponseStatistics_Class_Provider
+{
+/* @MIGEN.BEGIN@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+private:
+    Module* m_Module;
+
+public:
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider(
+        Module* module);
+
+    ~Apache_HTTPDVirtualHostResponseStatistics_Class_Provider();
+
+    void Load(
+        Context& context);
+
+    void Unload(
+        Context& context);
+
+    void EnumerateInstances(
+        Context& context,
+        const String& nameSpace,
+        const PropertySet& propertySet,
+        bool keysOnly,
+        const MI_Filter* filter);
+
+    void GetInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& instance,
+        const PropertySet& propertySet);
+
+    void CreateInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& newInstance);
+
+    void ModifyInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& modifiedInstance,
+        const PropertySet& propertySet);
+
+    void DeleteInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& instance);
+
+    void Invoke_ResetSelectedStats(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostResponseStatistics_Class& instanceName,
+        const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class& in);
+
+/* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+};
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _Apache_HTTPDVirtualHostResponseStatistics_Class_Provider_h */
+
@@ -46,6 +46,44 @@ typedef struct _Apache_HTTPDVirtualHostStatistics /* extends CIM_StatisticalData
     MI_ConstUint64Field ErrorCount500;
     MI_ConstUint32Field ErrorsPerMinute400;
     MI_ConstUint32Field ErrorsPerMinute500;
+    MI_ConstUint32Field RequestLatencyP50;
+    MI_ConstUint32Field RequestLatencyP95;
+    MI_ConstUint32Field RequestLatencyP99;
+    MI_ConstUint32Field RequestLatencyMax;
+    MI_ConstUint32Field UniqueClients;
+    MI_ConstUint32Field UniqueClientsToday;
+    MI_ConstUint32Field RequestsPerSecondAverage1Min;
+    MI_ConstUint32Field RequestsPerSecondPeak1Min;
+    MI_ConstUint32Field RequestsPerSecondAverage5Min;
+    MI_ConstUint32Field RequestsPerSecondPeak5Min;
+    MI_ConstUint32Field RequestsPerSecondAverage15Min;
+    MI_ConstUint32Field RequestsPerSecondPeak15Min;
+    MI_ConstUint32Field RequestsPerSecondAverage60Min;
+    MI_ConstUint32Field RequestsPerSecondPeak60Min;
+    MI_ConstUint32Field KBPerSecondAverage1Min;
+    MI_ConstUint32Field KBPerSecondPeak1Min;
+    MI_ConstUint32Field KBPerSecondAverage5Min;
+    MI_ConstUint32Field KBPerSecondPeak5Min;
+    MI_ConstUint32Field KBPerSecondAverage15Min;
+    MI_ConstUint32Field KBPerSecondPeak15Min;
+    MI_ConstUint32Field KBPerSecondAverage60Min;
+    MI_ConstUint32Field KBPerSecondPeak60Min;
+    MI_ConstUint32Field ErrorsPerMinute400Average1Min;
+    MI_ConstUint32Field ErrorsPerMinute400Peak1Min;
+    MI_ConstUint32Field ErrorsPerMinute400Average5Min;
+    MI_ConstUint32Field ErrorsPerMinute400Peak5Min;
+    MI_ConstUint32Field ErrorsPerMinute400Average15Min;
+    MI_ConstUint32Field ErrorsPerMinute400Peak15Min;
+    MI_ConstUint32Field ErrorsPerMinute400Average60Min;
+    MI_ConstUint32Field ErrorsPerMinute400Peak60Min;
+    MI_ConstUint32Field ErrorsPerMinute500Average1Min;
+    MI_ConstUint32Field ErrorsPerMinute500Peak1Min;
+    MI_ConstUint32Field ErrorsPerMinute500Average5Min;
+    MI_ConstUint32Field ErrorsPerMinute500Peak5Min;
+    MI_ConstUint32Field ErrorsPerMinute500Average15Min;
+    MI_ConstUint32Field ErrorsPerMinute500Peak15Min;
+    MI_ConstUint32Field ErrorsPerMinute500Average60Min;
+    MI_ConstUint32Field ErrorsPerMinute500Peak60Min;
 }
 Apache_HTTPDVirtualHostStatistics;
 
@@ -489,647 +527,2775 @@ MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMin
     return MI_RESULT_OK;
 }
 
-/*
-**==============================================================================
-**
-** Apache_HTTPDVirtualHostStatistics.ResetSelectedStats()
-**
-**==============================================================================
-*/
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestLatencyP50(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestLatencyP50)->value = x;
+    ((MI_Uint32Field*)&self->RequestLatencyP50)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-typedef struct _Apache_HTTPDVirtualHostStatistics_ResetSelectedStats
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestLatencyP50(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    MI_Instance __instance;
-    /*OUT*/ MI_ConstUint32Field MIReturn;
-    /*IN*/ MI_ConstStringAField SelectedStatistics;
+    memset((void*)&self->RequestLatencyP50, 0, sizeof(self->RequestLatencyP50));
+    return MI_RESULT_OK;
 }
-Apache_HTTPDVirtualHostStatistics_ResetSelectedStats;
 
-MI_EXTERN_C MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_rtti;
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestLatencyP95(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestLatencyP95)->value = x;
+    ((MI_Uint32Field*)&self->RequestLatencyP95)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Construct(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
-    MI_Context* context)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestLatencyP95(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    return MI_ConstructParameters(context, &Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_rtti,
-        (MI_Instance*)&self->__instance);
+    memset((void*)&self->RequestLatencyP95, 0, sizeof(self->RequestLatencyP95));
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clone(
-    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats** newInstance)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestLatencyP99(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
 {
-    return MI_Instance_Clone(
-        &self->__instance, (MI_Instance**)newInstance);
+    ((MI_Uint32Field*)&self->RequestLatencyP99)->value = x;
+    ((MI_Uint32Field*)&self->RequestLatencyP99)->exists = 1;
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Destruct(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestLatencyP99(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    return MI_Instance_Destruct(&self->__instance);
+    memset((void*)&self->RequestLatencyP99, 0, sizeof(self->RequestLatencyP99));
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Delete(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestLatencyMax(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
 {
-    return MI_Instance_Delete(&self->__instance);
+    ((MI_Uint32Field*)&self->RequestLatencyMax)->value = x;
+    ((MI_Uint32Field*)&self->RequestLatencyMax)->exists = 1;
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Post(
-    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
-    MI_Context* context)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestLatencyMax(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    return MI_PostInstance(context, &self->__instance);
+    memset((void*)&self->RequestLatencyMax, 0, sizeof(self->RequestLatencyMax));
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Set_MIReturn(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_UniqueClients(
+    Apache_HTTPDVirtualHostStatistics* self,
     MI_Uint32 x)
 {
-    ((MI_Uint32Field*)&self->MIReturn)->value = x;
-    ((MI_Uint32Field*)&self->MIReturn)->exists = 1;
+    ((MI_Uint32Field*)&self->UniqueClients)->value = x;
+    ((MI_Uint32Field*)&self->UniqueClients)->exists = 1;
     return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clear_MIReturn(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_UniqueClients(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    memset((void*)&self->UniqueClients, 0, sizeof(self->UniqueClients));
     return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Set_SelectedStatistics(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
-    const MI_Char** data,
-    MI_Uint32 size)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_UniqueClientsToday(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
 {
-    MI_Array arr;
-    arr.data = (void*)data;
-    arr.size = size;
-    return self->__instance.ft->SetElementAt(
-        (MI_Instance*)&self->__instance,
-        1,
-        (MI_Value*)&arr,
-        MI_STRINGA,
-        0);
+    ((MI_Uint32Field*)&self->UniqueClientsToday)->value = x;
+    ((MI_Uint32Field*)&self->UniqueClientsToday)->exists = 1;
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_SetPtr_SelectedStatistics(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
-    const MI_Char** data,
-    MI_Uint32 size)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_UniqueClientsToday(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-    MI_Array arr;
-    arr.data = (void*)data;
-    arr.size = size;
-    return self->__instance.ft->SetElementAt(
-        (MI_Instance*)&self->__instance,
-        1,
-        (MI_Value*)&arr,
-        MI_STRINGA,
-        MI_FLAG_BORROW);
+    memset((void*)&self->UniqueClientsToday, 0, sizeof(self->UniqueClientsToday));
+    return MI_RESULT_OK;
 }
 
-MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clear_SelectedStatistics(
-    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondAverage1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
 {
-    return self->__instance.ft->ClearElementAt(
-        (MI_Instance*)&self->__instance,
-        1);
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage1Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage1Min)->exists = 1;
+    return MI_RESULT_OK;
 }
 
-/*
-**==============================================================================
-**
-** Apache_HTTPDVirtualHostStatistics provider function prototypes
-**
-**==============================================================================
-*/
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondAverage1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondAverage1Min, 0, sizeof(self->RequestsPerSecondAverage1Min));
+    return MI_RESULT_OK;
+}
 
-/* The developer may optionally define this structure */
-typedef struct _Apache_HTTPDVirtualHostStatistics_Self Apache_HTTPDVirtualHostStatistics_Self;
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondPeak1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak1Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Load(
-    Apache_HTTPDVirtualHostStatistics_Self** self,
-    MI_Module_Self* selfModule,
-    MI_Context* context);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondPeak1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondPeak1Min, 0, sizeof(self->RequestsPerSecondPeak1Min));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Unload(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondAverage5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage5Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_EnumerateInstances(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_PropertySet* propertySet,
-    MI_Boolean keysOnly,
-    const MI_Filter* filter);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondAverage5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondAverage5Min, 0, sizeof(self->RequestsPerSecondAverage5Min));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_GetInstance(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const Apache_HTTPDVirtualHostStatistics* instanceName,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondPeak5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak5Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_CreateInstance(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const Apache_HTTPDVirtualHostStatistics* newInstance);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondPeak5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondPeak5Min, 0, sizeof(self->RequestsPerSecondPeak5Min));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_ModifyInstance(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const Apache_HTTPDVirtualHostStatistics* modifiedInstance,
-    const MI_PropertySet* propertySet);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondAverage15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage15Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_DeleteInstance(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const Apache_HTTPDVirtualHostStatistics* instanceName);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondAverage15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondAverage15Min, 0, sizeof(self->RequestsPerSecondAverage15Min));
+    return MI_RESULT_OK;
+}
 
-MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Invoke_ResetSelectedStats(
-    Apache_HTTPDVirtualHostStatistics_Self* self,
-    MI_Context* context,
-    const MI_Char* nameSpace,
-    const MI_Char* className,
-    const MI_Char* methodName,
-    const Apache_HTTPDVirtualHostStatistics* instanceName,
-    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* in);
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondPeak15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak15Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondPeak15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondPeak15Min, 0, sizeof(self->RequestsPerSecondPeak15Min));
+    return MI_RESULT_OK;
+}
 
-/*
-**==============================================================================
-**
-** Apache_HTTPDVirtualHostStatistics_Class
-**
-**==============================================================================
-*/
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondAverage60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage60Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondAverage60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-#ifdef __cplusplus
-# include <micxx/micxx.h>
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondAverage60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->RequestsPerSecondAverage60Min, 0, sizeof(self->RequestsPerSecondAverage60Min));
+    return MI_RESULT_OK;
+}
 
-MI_BEGIN_NAMESPACE
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_RequestsPerSecondPeak60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak60Min)->value = x;
+    ((MI_Uint32Field*)&self->RequestsPerSecondPeak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
 
-class Apache_HTTPDVirtualHostStatistics_Class : public CIM_StatisticalData_Class
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_RequestsPerSecondPeak60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
 {
-public:
+    memset((void*)&self->RequestsPerSecondPeak60Min, 0, sizeof(self->RequestsPerSecondPeak60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondAverage1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondAverage1Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondAverage1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondAverage1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondAverage1Min, 0, sizeof(self->KBPerSecondAverage1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondPeak1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondPeak1Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondPeak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondPeak1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondPeak1Min, 0, sizeof(self->KBPerSecondPeak1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondAverage5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondAverage5Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondAverage5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondAverage5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondAverage5Min, 0, sizeof(self->KBPerSecondAverage5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondPeak5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondPeak5Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondPeak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondPeak5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondPeak5Min, 0, sizeof(self->KBPerSecondPeak5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondAverage15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondAverage15Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondAverage15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondAverage15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondAverage15Min, 0, sizeof(self->KBPerSecondAverage15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondPeak15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondPeak15Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondPeak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondPeak15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondPeak15Min, 0, sizeof(self->KBPerSecondPeak15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondAverage60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondAverage60Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondAverage60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondAverage60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondAverage60Min, 0, sizeof(self->KBPerSecondAverage60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_KBPerSecondPeak60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->KBPerSecondPeak60Min)->value = x;
+    ((MI_Uint32Field*)&self->KBPerSecondPeak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_KBPerSecondPeak60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->KBPerSecondPeak60Min, 0, sizeof(self->KBPerSecondPeak60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Average1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average1Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Average1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Average1Min, 0, sizeof(self->ErrorsPerMinute400Average1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Peak1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak1Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Peak1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Peak1Min, 0, sizeof(self->ErrorsPerMinute400Peak1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Average5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average5Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Average5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Average5Min, 0, sizeof(self->ErrorsPerMinute400Average5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Peak5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak5Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Peak5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Peak5Min, 0, sizeof(self->ErrorsPerMinute400Peak5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Average15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average15Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Average15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Average15Min, 0, sizeof(self->ErrorsPerMinute400Average15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Peak15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak15Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Peak15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Peak15Min, 0, sizeof(self->ErrorsPerMinute400Peak15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Average60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average60Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Average60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Average60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Average60Min, 0, sizeof(self->ErrorsPerMinute400Average60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute400Peak60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak60Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute400Peak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute400Peak60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute400Peak60Min, 0, sizeof(self->ErrorsPerMinute400Peak60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Average1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average1Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Average1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Average1Min, 0, sizeof(self->ErrorsPerMinute500Average1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Peak1Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak1Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak1Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Peak1Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Peak1Min, 0, sizeof(self->ErrorsPerMinute500Peak1Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Average5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average5Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Average5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Average5Min, 0, sizeof(self->ErrorsPerMinute500Average5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Peak5Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak5Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak5Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Peak5Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Peak5Min, 0, sizeof(self->ErrorsPerMinute500Peak5Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Average15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average15Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Average15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Average15Min, 0, sizeof(self->ErrorsPerMinute500Average15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Peak15Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak15Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak15Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Peak15Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Peak15Min, 0, sizeof(self->ErrorsPerMinute500Peak15Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Average60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average60Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Average60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Average60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Average60Min, 0, sizeof(self->ErrorsPerMinute500Average60Min));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Set_ErrorsPerMinute500Peak60Min(
+    Apache_HTTPDVirtualHostStatistics* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak60Min)->value = x;
+    ((MI_Uint32Field*)&self->ErrorsPerMinute500Peak60Min)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_Clear_ErrorsPerMinute500Peak60Min(
+    Apache_HTTPDVirtualHostStatistics* self)
+{
+    memset((void*)&self->ErrorsPerMinute500Peak60Min, 0, sizeof(self->ErrorsPerMinute500Peak60Min));
+    return MI_RESULT_OK;
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostStatistics.ResetSelectedStats()
+**
+**==============================================================================
+*/
+
+typedef struct _Apache_HTTPDVirtualHostStatistics_ResetSelectedStats
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstUint32Field MIReturn;
+    /*IN*/ MI_ConstStringAField SelectedStatistics;
+}
+Apache_HTTPDVirtualHostStatistics_ResetSelectedStats;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_rtti;
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Construct(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clone(
+    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Destruct(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Delete(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Post(
+    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Set_MIReturn(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->MIReturn)->value = x;
+    ((MI_Uint32Field*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clear_MIReturn(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Set_SelectedStatistics(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_SetPtr_SelectedStatistics(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostStatistics_ResetSelectedStats_Clear_SelectedStatistics(
+    Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostStatistics provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _Apache_HTTPDVirtualHostStatistics_Self Apache_HTTPDVirtualHostStatistics_Self;
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Load(
+    Apache_HTTPDVirtualHostStatistics_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Unload(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_EnumerateInstances(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_GetInstance(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostStatistics* instanceName,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_CreateInstance(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostStatistics* newInstance);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_ModifyInstance(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostStatistics* modifiedInstance,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_DeleteInstance(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostStatistics* instanceName);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Invoke_ResetSelectedStats(
+    Apache_HTTPDVirtualHostStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const Apache_HTTPDVirtualHostStatistics* instanceName,
+    const Apache_HTTPDVirtualHostStatistics_ResetSelectedStats* in);
+
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostStatistics_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class Apache_HTTPDVirtualHostStatistics_Class : public CIM_StatisticalData_Class
+{
+public:
+    
+    typedef Apache_HTTPDVirtualHostStatistics Self;
+    
+    Apache_HTTPDVirtualHostStatistics_Class() :
+        CIM_StatisticalData_Class(&Apache_HTTPDVirtualHostStatistics_rtti)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostStatistics_Class(
+        const Apache_HTTPDVirtualHostStatistics* instanceName,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(
+            &Apache_HTTPDVirtualHostStatistics_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostStatistics_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostStatistics_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_StatisticalData_Class(clDecl)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostStatistics_Class& operator=(
+        const Apache_HTTPDVirtualHostStatistics_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    Apache_HTTPDVirtualHostStatistics_Class(
+        const Apache_HTTPDVirtualHostStatistics_Class& x) :
+        CIM_StatisticalData_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &Apache_HTTPDVirtualHostStatistics_rtti;
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ServerName
+    //
+    
+    const Field<String>& ServerName() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n);
+    }
+    
+    void ServerName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ServerName_value() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).value;
+    }
+    
+    void ServerName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ServerName_exists() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ServerName_clear()
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsTotal
+    //
+    
+    const Field<Uint64>& RequestsTotal() const
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        return GetField<Uint64>(n);
+    }
+    
+    void RequestsTotal(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& RequestsTotal_value() const
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void RequestsTotal_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool RequestsTotal_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void RequestsTotal_clear()
+    {
+        const size_t n = offsetof(Self, RequestsTotal);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsTotalBytes
+    //
+    
+    const Field<Uint64>& RequestsTotalBytes() const
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        return GetField<Uint64>(n);
+    }
+    
+    void RequestsTotalBytes(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& RequestsTotalBytes_value() const
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void RequestsTotalBytes_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool RequestsTotalBytes_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void RequestsTotalBytes_clear()
+    {
+        const size_t n = offsetof(Self, RequestsTotalBytes);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecond
+    //
+    
+    const Field<Uint32>& RequestsPerSecond() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecond(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecond_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecond_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecond_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecond_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecond);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerRequest
+    //
+    
+    const Field<Uint32>& KBPerRequest() const
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerRequest(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerRequest_value() const
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerRequest_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerRequest_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerRequest_clear()
+    {
+        const size_t n = offsetof(Self, KBPerRequest);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecond
+    //
+    
+    const Field<Uint32>& KBPerSecond() const
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecond(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecond_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecond_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecond_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecond_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecond);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorCount400
+    //
+    
+    const Field<Uint64>& ErrorCount400() const
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        return GetField<Uint64>(n);
+    }
+    
+    void ErrorCount400(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ErrorCount400_value() const
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ErrorCount400_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ErrorCount400_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ErrorCount400_clear()
+    {
+        const size_t n = offsetof(Self, ErrorCount400);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorCount500
+    //
+    
+    const Field<Uint64>& ErrorCount500() const
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        return GetField<Uint64>(n);
+    }
+    
+    void ErrorCount500(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& ErrorCount500_value() const
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void ErrorCount500_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool ErrorCount500_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void ErrorCount500_clear()
+    {
+        const size_t n = offsetof(Self, ErrorCount500);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute400_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute500() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute500(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute500_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute500_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute500_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute500_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestLatencyP50
+    //
+    
+    const Field<Uint32>& RequestLatencyP50() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestLatencyP50(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestLatencyP50_value() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestLatencyP50_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestLatencyP50_exists() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestLatencyP50_clear()
+    {
+        const size_t n = offsetof(Self, RequestLatencyP50);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestLatencyP95
+    //
+    
+    const Field<Uint32>& RequestLatencyP95() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestLatencyP95(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestLatencyP95_value() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestLatencyP95_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestLatencyP95_exists() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestLatencyP95_clear()
+    {
+        const size_t n = offsetof(Self, RequestLatencyP95);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestLatencyP99
+    //
+    
+    const Field<Uint32>& RequestLatencyP99() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestLatencyP99(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestLatencyP99_value() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestLatencyP99_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestLatencyP99_exists() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestLatencyP99_clear()
+    {
+        const size_t n = offsetof(Self, RequestLatencyP99);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestLatencyMax
+    //
+    
+    const Field<Uint32>& RequestLatencyMax() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestLatencyMax(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestLatencyMax_value() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestLatencyMax_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestLatencyMax_exists() const
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestLatencyMax_clear()
+    {
+        const size_t n = offsetof(Self, RequestLatencyMax);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.UniqueClients
+    //
+    
+    const Field<Uint32>& UniqueClients() const
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        return GetField<Uint32>(n);
+    }
+    
+    void UniqueClients(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& UniqueClients_value() const
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void UniqueClients_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool UniqueClients_exists() const
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void UniqueClients_clear()
+    {
+        const size_t n = offsetof(Self, UniqueClients);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.UniqueClientsToday
+    //
+    
+    const Field<Uint32>& UniqueClientsToday() const
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        return GetField<Uint32>(n);
+    }
+    
+    void UniqueClientsToday(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& UniqueClientsToday_value() const
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void UniqueClientsToday_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool UniqueClientsToday_exists() const
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void UniqueClientsToday_clear()
+    {
+        const size_t n = offsetof(Self, UniqueClientsToday);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondAverage1Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondAverage1Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondAverage1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondAverage1Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondAverage1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondAverage1Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondAverage1Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondPeak1Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondPeak1Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondPeak1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondPeak1Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondPeak1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondPeak1Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondPeak1Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondAverage5Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondAverage5Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondAverage5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondAverage5Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondAverage5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondAverage5Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondAverage5Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondPeak5Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondPeak5Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondPeak5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondPeak5Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondPeak5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondPeak5Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondPeak5Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondAverage15Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondAverage15Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondAverage15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondAverage15Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondAverage15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondAverage15Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondAverage15Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondPeak15Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondPeak15Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondPeak15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondPeak15Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondPeak15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondPeak15Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondPeak15Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondAverage60Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondAverage60Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondAverage60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondAverage60Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondAverage60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondAverage60Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondAverage60Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondAverage60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecondPeak60Min
+    //
+    
+    const Field<Uint32>& RequestsPerSecondPeak60Min() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void RequestsPerSecondPeak60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RequestsPerSecondPeak60Min_value() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RequestsPerSecondPeak60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RequestsPerSecondPeak60Min_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RequestsPerSecondPeak60Min_clear()
+    {
+        const size_t n = offsetof(Self, RequestsPerSecondPeak60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondAverage1Min
+    //
+    
+    const Field<Uint32>& KBPerSecondAverage1Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondAverage1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondAverage1Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondAverage1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondAverage1Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondAverage1Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondPeak1Min
+    //
+    
+    const Field<Uint32>& KBPerSecondPeak1Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondPeak1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondPeak1Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondPeak1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondPeak1Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondPeak1Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondAverage5Min
+    //
+    
+    const Field<Uint32>& KBPerSecondAverage5Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondAverage5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondAverage5Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondAverage5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondAverage5Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondAverage5Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondPeak5Min
+    //
+    
+    const Field<Uint32>& KBPerSecondPeak5Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondPeak5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondPeak5Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondPeak5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondPeak5Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondPeak5Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondAverage15Min
+    //
+    
+    const Field<Uint32>& KBPerSecondAverage15Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondAverage15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondAverage15Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondAverage15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondAverage15Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondAverage15Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondPeak15Min
+    //
+    
+    const Field<Uint32>& KBPerSecondPeak15Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondPeak15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondPeak15Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondPeak15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondPeak15Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondPeak15Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak15Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondAverage60Min
+    //
+    
+    const Field<Uint32>& KBPerSecondAverage60Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondAverage60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondAverage60Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondAverage60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondAverage60Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondAverage60Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondAverage60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecondPeak60Min
+    //
+    
+    const Field<Uint32>& KBPerSecondPeak60Min() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void KBPerSecondPeak60Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& KBPerSecondPeak60Min_value() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void KBPerSecondPeak60Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool KBPerSecondPeak60Min_exists() const
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void KBPerSecondPeak60Min_clear()
+    {
+        const size_t n = offsetof(Self, KBPerSecondPeak60Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Average1Min
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400Average1Min() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400Average1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400Average1Min_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400Average1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400Average1Min_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute400Average1Min_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Peak1Min
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400Peak1Min() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400Peak1Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400Peak1Min_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400Peak1Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400Peak1Min_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute400Peak1Min_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak1Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Average5Min
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400Average5Min() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400Average5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400Average5Min_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400Average5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400Average5Min_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute400Average5Min_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Peak5Min
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400Peak5Min() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400Peak5Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400Peak5Min_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400Peak5Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400Peak5Min_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
     
-    typedef Apache_HTTPDVirtualHostStatistics Self;
+    void ErrorsPerMinute400Peak5Min_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak5Min);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Average15Min
+    //
     
-    Apache_HTTPDVirtualHostStatistics_Class() :
-        CIM_StatisticalData_Class(&Apache_HTTPDVirtualHostStatistics_rtti)
+    const Field<Uint32>& ErrorsPerMinute400Average15Min() const
     {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        return GetField<Uint32>(n);
     }
     
-    Apache_HTTPDVirtualHostStatistics_Class(
-        const Apache_HTTPDVirtualHostStatistics* instanceName,
-        bool keysOnly) :
-        CIM_StatisticalData_Class(
-            &Apache_HTTPDVirtualHostStatistics_rtti,
-            &instanceName->__instance,
-            keysOnly)
+    void ErrorsPerMinute400Average15Min(const Field<Uint32>& x)
     {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        GetField<Uint32>(n) = x;
     }
     
-    Apache_HTTPDVirtualHostStatistics_Class(
-        const MI_ClassDecl* clDecl,
-        const MI_Instance* instance,
-        bool keysOnly) :
-        CIM_StatisticalData_Class(clDecl, instance, keysOnly)
+    const Uint32& ErrorsPerMinute400Average15Min_value() const
     {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        return GetField<Uint32>(n).value;
     }
     
-    Apache_HTTPDVirtualHostStatistics_Class(
-        const MI_ClassDecl* clDecl) :
-        CIM_StatisticalData_Class(clDecl)
+    void ErrorsPerMinute400Average15Min_value(const Uint32& x)
     {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    Apache_HTTPDVirtualHostStatistics_Class& operator=(
-        const Apache_HTTPDVirtualHostStatistics_Class& x)
+    bool ErrorsPerMinute400Average15Min_exists() const
     {
-        CopyRef(x);
-        return *this;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    Apache_HTTPDVirtualHostStatistics_Class(
-        const Apache_HTTPDVirtualHostStatistics_Class& x) :
-        CIM_StatisticalData_Class(x)
+    void ErrorsPerMinute400Average15Min_clear()
     {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average15Min);
+        GetField<Uint32>(n).Clear();
     }
 
-    static const MI_ClassDecl* GetClassDecl()
+    //
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Peak15Min
+    //
+    
+    const Field<Uint32>& ErrorsPerMinute400Peak15Min() const
     {
-        return &Apache_HTTPDVirtualHostStatistics_rtti;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        return GetField<Uint32>(n);
+    }
+    
+    void ErrorsPerMinute400Peak15Min(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& ErrorsPerMinute400Peak15Min_value() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void ErrorsPerMinute400Peak15Min_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool ErrorsPerMinute400Peak15Min_exists() const
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void ErrorsPerMinute400Peak15Min_clear()
+    {
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak15Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.ServerName
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Average60Min
     //
     
-    const Field<String>& ServerName() const
+    const Field<Uint32>& ErrorsPerMinute400Average60Min() const
     {
-        const size_t n = offsetof(Self, ServerName);
-        return GetField<String>(n);
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        return GetField<Uint32>(n);
     }
     
-    void ServerName(const Field<String>& x)
+    void ErrorsPerMinute400Average60Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, ServerName);
-        GetField<String>(n) = x;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        GetField<Uint32>(n) = x;
     }
     
-    const String& ServerName_value() const
+    const Uint32& ErrorsPerMinute400Average60Min_value() const
     {
-        const size_t n = offsetof(Self, ServerName);
-        return GetField<String>(n).value;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        return GetField<Uint32>(n).value;
     }
     
-    void ServerName_value(const String& x)
+    void ErrorsPerMinute400Average60Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, ServerName);
-        GetField<String>(n).Set(x);
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    bool ServerName_exists() const
+    bool ErrorsPerMinute400Average60Min_exists() const
     {
-        const size_t n = offsetof(Self, ServerName);
-        return GetField<String>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void ServerName_clear()
+    void ErrorsPerMinute400Average60Min_clear()
     {
-        const size_t n = offsetof(Self, ServerName);
-        GetField<String>(n).Clear();
+        const size_t n = offsetof(Self, ErrorsPerMinute400Average60Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.RequestsTotal
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400Peak60Min
     //
     
-    const Field<Uint64>& RequestsTotal() const
+    const Field<Uint32>& ErrorsPerMinute400Peak60Min() const
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        return GetField<Uint64>(n);
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        return GetField<Uint32>(n);
     }
     
-    void RequestsTotal(const Field<Uint64>& x)
+    void ErrorsPerMinute400Peak60Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        GetField<Uint64>(n) = x;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        GetField<Uint32>(n) = x;
     }
     
-    const Uint64& RequestsTotal_value() const
+    const Uint32& ErrorsPerMinute400Peak60Min_value() const
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        return GetField<Uint64>(n).value;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        return GetField<Uint32>(n).value;
     }
     
-    void RequestsTotal_value(const Uint64& x)
+    void ErrorsPerMinute400Peak60Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        GetField<Uint64>(n).Set(x);
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    bool RequestsTotal_exists() const
+    bool ErrorsPerMinute400Peak60Min_exists() const
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        return GetField<Uint64>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void RequestsTotal_clear()
+    void ErrorsPerMinute400Peak60Min_clear()
     {
-        const size_t n = offsetof(Self, RequestsTotal);
-        GetField<Uint64>(n).Clear();
+        const size_t n = offsetof(Self, ErrorsPerMinute400Peak60Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.RequestsTotalBytes
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Average1Min
     //
     
-    const Field<Uint64>& RequestsTotalBytes() const
+    const Field<Uint32>& ErrorsPerMinute500Average1Min() const
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        return GetField<Uint64>(n);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        return GetField<Uint32>(n);
     }
     
-    void RequestsTotalBytes(const Field<Uint64>& x)
+    void ErrorsPerMinute500Average1Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        GetField<Uint64>(n) = x;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        GetField<Uint32>(n) = x;
     }
     
-    const Uint64& RequestsTotalBytes_value() const
+    const Uint32& ErrorsPerMinute500Average1Min_value() const
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        return GetField<Uint64>(n).value;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        return GetField<Uint32>(n).value;
     }
     
-    void RequestsTotalBytes_value(const Uint64& x)
+    void ErrorsPerMinute500Average1Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        GetField<Uint64>(n).Set(x);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    bool RequestsTotalBytes_exists() const
+    bool ErrorsPerMinute500Average1Min_exists() const
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        return GetField<Uint64>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void RequestsTotalBytes_clear()
+    void ErrorsPerMinute500Average1Min_clear()
     {
-        const size_t n = offsetof(Self, RequestsTotalBytes);
-        GetField<Uint64>(n).Clear();
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average1Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.RequestsPerSecond
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Peak1Min
     //
     
-    const Field<Uint32>& RequestsPerSecond() const
+    const Field<Uint32>& ErrorsPerMinute500Peak1Min() const
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         return GetField<Uint32>(n);
     }
     
-    void RequestsPerSecond(const Field<Uint32>& x)
+    void ErrorsPerMinute500Peak1Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         GetField<Uint32>(n) = x;
     }
     
-    const Uint32& RequestsPerSecond_value() const
+    const Uint32& ErrorsPerMinute500Peak1Min_value() const
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         return GetField<Uint32>(n).value;
     }
     
-    void RequestsPerSecond_value(const Uint32& x)
+    void ErrorsPerMinute500Peak1Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         GetField<Uint32>(n).Set(x);
     }
     
-    bool RequestsPerSecond_exists() const
+    bool ErrorsPerMinute500Peak1Min_exists() const
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void RequestsPerSecond_clear()
+    void ErrorsPerMinute500Peak1Min_clear()
     {
-        const size_t n = offsetof(Self, RequestsPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak1Min);
         GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.KBPerRequest
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Average5Min
     //
     
-    const Field<Uint32>& KBPerRequest() const
+    const Field<Uint32>& ErrorsPerMinute500Average5Min() const
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         return GetField<Uint32>(n);
     }
     
-    void KBPerRequest(const Field<Uint32>& x)
+    void ErrorsPerMinute500Average5Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         GetField<Uint32>(n) = x;
     }
     
-    const Uint32& KBPerRequest_value() const
+    const Uint32& ErrorsPerMinute500Average5Min_value() const
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         return GetField<Uint32>(n).value;
     }
     
-    void KBPerRequest_value(const Uint32& x)
+    void ErrorsPerMinute500Average5Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         GetField<Uint32>(n).Set(x);
     }
     
-    bool KBPerRequest_exists() const
+    bool ErrorsPerMinute500Average5Min_exists() const
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void KBPerRequest_clear()
+    void ErrorsPerMinute500Average5Min_clear()
     {
-        const size_t n = offsetof(Self, KBPerRequest);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average5Min);
         GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.KBPerSecond
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Peak5Min
     //
     
-    const Field<Uint32>& KBPerSecond() const
+    const Field<Uint32>& ErrorsPerMinute500Peak5Min() const
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         return GetField<Uint32>(n);
     }
     
-    void KBPerSecond(const Field<Uint32>& x)
+    void ErrorsPerMinute500Peak5Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         GetField<Uint32>(n) = x;
     }
     
-    const Uint32& KBPerSecond_value() const
+    const Uint32& ErrorsPerMinute500Peak5Min_value() const
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         return GetField<Uint32>(n).value;
     }
     
-    void KBPerSecond_value(const Uint32& x)
+    void ErrorsPerMinute500Peak5Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         GetField<Uint32>(n).Set(x);
     }
     
-    bool KBPerSecond_exists() const
+    bool ErrorsPerMinute500Peak5Min_exists() const
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void KBPerSecond_clear()
+    void ErrorsPerMinute500Peak5Min_clear()
     {
-        const size_t n = offsetof(Self, KBPerSecond);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak5Min);
         GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.ErrorCount400
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Average15Min
     //
     
-    const Field<Uint64>& ErrorCount400() const
+    const Field<Uint32>& ErrorsPerMinute500Average15Min() const
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        return GetField<Uint64>(n);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        return GetField<Uint32>(n);
     }
     
-    void ErrorCount400(const Field<Uint64>& x)
+    void ErrorsPerMinute500Average15Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        GetField<Uint64>(n) = x;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        GetField<Uint32>(n) = x;
     }
     
-    const Uint64& ErrorCount400_value() const
+    const Uint32& ErrorsPerMinute500Average15Min_value() const
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        return GetField<Uint64>(n).value;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        return GetField<Uint32>(n).value;
     }
     
-    void ErrorCount400_value(const Uint64& x)
+    void ErrorsPerMinute500Average15Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        GetField<Uint64>(n).Set(x);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    bool ErrorCount400_exists() const
+    bool ErrorsPerMinute500Average15Min_exists() const
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        return GetField<Uint64>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void ErrorCount400_clear()
+    void ErrorsPerMinute500Average15Min_clear()
     {
-        const size_t n = offsetof(Self, ErrorCount400);
-        GetField<Uint64>(n).Clear();
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average15Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.ErrorCount500
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Peak15Min
     //
     
-    const Field<Uint64>& ErrorCount500() const
+    const Field<Uint32>& ErrorsPerMinute500Peak15Min() const
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        return GetField<Uint64>(n);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        return GetField<Uint32>(n);
     }
     
-    void ErrorCount500(const Field<Uint64>& x)
+    void ErrorsPerMinute500Peak15Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        GetField<Uint64>(n) = x;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        GetField<Uint32>(n) = x;
     }
     
-    const Uint64& ErrorCount500_value() const
+    const Uint32& ErrorsPerMinute500Peak15Min_value() const
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        return GetField<Uint64>(n).value;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        return GetField<Uint32>(n).value;
     }
     
-    void ErrorCount500_value(const Uint64& x)
+    void ErrorsPerMinute500Peak15Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        GetField<Uint64>(n).Set(x);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        GetField<Uint32>(n).Set(x);
     }
     
-    bool ErrorCount500_exists() const
+    bool ErrorsPerMinute500Peak15Min_exists() const
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        return GetField<Uint64>(n).exists ? true : false;
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void ErrorCount500_clear()
+    void ErrorsPerMinute500Peak15Min_clear()
     {
-        const size_t n = offsetof(Self, ErrorCount500);
-        GetField<Uint64>(n).Clear();
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak15Min);
+        GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute400
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Average60Min
     //
     
-    const Field<Uint32>& ErrorsPerMinute400() const
+    const Field<Uint32>& ErrorsPerMinute500Average60Min() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         return GetField<Uint32>(n);
     }
     
-    void ErrorsPerMinute400(const Field<Uint32>& x)
+    void ErrorsPerMinute500Average60Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         GetField<Uint32>(n) = x;
     }
     
-    const Uint32& ErrorsPerMinute400_value() const
+    const Uint32& ErrorsPerMinute500Average60Min_value() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         return GetField<Uint32>(n).value;
     }
     
-    void ErrorsPerMinute400_value(const Uint32& x)
+    void ErrorsPerMinute500Average60Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         GetField<Uint32>(n).Set(x);
     }
     
-    bool ErrorsPerMinute400_exists() const
+    bool ErrorsPerMinute500Average60Min_exists() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void ErrorsPerMinute400_clear()
+    void ErrorsPerMinute500Average60Min_clear()
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute400);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Average60Min);
         GetField<Uint32>(n).Clear();
     }
 
     //
-    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500
+    // Apache_HTTPDVirtualHostStatistics_Class.ErrorsPerMinute500Peak60Min
     //
     
-    const Field<Uint32>& ErrorsPerMinute500() const
+    const Field<Uint32>& ErrorsPerMinute500Peak60Min() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         return GetField<Uint32>(n);
     }
     
-    void ErrorsPerMinute500(const Field<Uint32>& x)
+    void ErrorsPerMinute500Peak60Min(const Field<Uint32>& x)
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         GetField<Uint32>(n) = x;
     }
     
-    const Uint32& ErrorsPerMinute500_value() const
+    const Uint32& ErrorsPerMinute500Peak60Min_value() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         return GetField<Uint32>(n).value;
     }
     
-    void ErrorsPerMinute500_value(const Uint32& x)
+    void ErrorsPerMinute500Peak60Min_value(const Uint32& x)
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         GetField<Uint32>(n).Set(x);
     }
     
-    bool ErrorsPerMinute500_exists() const
+    bool ErrorsPerMinute500Peak60Min_exists() const
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         return GetField<Uint32>(n).exists ? true : false;
     }
     
-    void ErrorsPerMinute500_clear()
+    void ErrorsPerMinute500Peak60Min_clear()
     {
-        const size_t n = offsetof(Self, ErrorsPerMinute500);
+        const size_t n = offsetof(Self, ErrorsPerMinute500Peak60Min);
         GetField<Uint32>(n).Clear();
     }
 };
@@ -28,43 +28,118 @@
 #include "Apache_HTTPDVirtualHostStatistics_Class_Provider.h"
 
 // Provider include definitions
-#include <apr_atomic.h>
 #include "apachebinding.h"
 
+#include <vector>
+
 
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(Context& context,
+// Rate history properties, by rate (MMAP_RATE_*) and window (1, 5, 15 and 60 minutes)
+typedef void (Apache_HTTPDVirtualHostStatistics_Class::*RateProperty)(const Uint32& x);
+
+static const RateProperty s_rateAverages[MMAP_RATE_COUNT][MMAP_RATE_WINDOWS] =
+{
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondAverage1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondAverage5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondAverage15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondAverage60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondAverage1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondAverage5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondAverage15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondAverage60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Average1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Average5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Average15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Average60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Average1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Average5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Average15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Average60Min_value
+    }
+};
+
+static const RateProperty s_ratePeaks[MMAP_RATE_COUNT][MMAP_RATE_WINDOWS] =
+{
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondPeak1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondPeak5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondPeak15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::RequestsPerSecondPeak60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondPeak1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondPeak5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondPeak15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::KBPerSecondPeak60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Peak1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Peak5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Peak15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute400Peak60Min_value
+    },
+    {
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Peak1Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Peak5Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Peak15Min_value,
+        &Apache_HTTPDVirtualHostStatistics_Class::ErrorsPerMinute500Peak60Min_value
+    }
+};
+
+static void EnumerateOneInstance(std::vector<Apache_HTTPDVirtualHostStatistics_Class>& instances,
         bool keysOnly,
         apr_size_t item,
-        ApacheDataCollector& data)
+        ApacheDataCollector& data,
+        const ApacheVHostSnapshot& vhost)
 {
     Apache_HTTPDVirtualHostStatistics_Class inst;
-    mmap_vhost_elements *vhosts = data.GetVHostElements();
 
     // Insert the key into the instance
-    inst.InstanceID_value(data.GetDataString(vhosts[item].instanceIDOffset));
+    inst.InstanceID_value(data.GetVHostInstanceID(item));
 
     if (! keysOnly)
     {
         // Insert the values into the instance
 
-        inst.ServerName_value(data.GetDataString(vhosts[item].hostNameOffset));
-        inst.RequestsTotal_value(vhosts[item].requestsTotal);
-        inst.RequestsTotalBytes_value(vhosts[item].requestsBytes);
-        inst.ErrorCount400_value(vhosts[item].errorCount400);
-        inst.ErrorCount500_value(vhosts[item].errorCount500);
+        inst.ServerName_value(data.GetVHostName(item));
+        inst.RequestsTotal_value(vhost.requestsTotal);
+        inst.RequestsTotalBytes_value(vhost.requestsBytes);
+        inst.ErrorCount400_value(vhost.responses[MMAP_RESPONSE_4XX]);
+        inst.ErrorCount500_value(vhost.responses[MMAP_RESPONSE_5XX]);
 
         // Insert the time-based values into the instance
 
-        inst.RequestsPerSecond_value(apr_atomic_read32(&vhosts[item].requestsPerSecond));
-        inst.KBPerRequest_value(apr_atomic_read32(&vhosts[item].kbPerRequest));
-        inst.KBPerSecond_value(apr_atomic_read32(&vhosts[item].kbPerSecond));
-        inst.ErrorsPerMinute400_value(apr_atomic_read32(&vhosts[item].errorsPerMinute400));
-        inst.ErrorsPerMinute500_value(apr_atomic_read32(&vhosts[item].errorsPerMinute500));
+        inst.RequestsPerSecond_value(vhost.requestsPerSecond);
+        inst.KBPerRequest_value(vhost.kbPerRequest);
+        inst.KBPerSecond_value(vhost.kbPerSecond);
+        inst.ErrorsPerMinute400_value(vhost.responsesPerMinute[MMAP_RESPONSE_4XX]);
+        inst.ErrorsPerMinute500_value(vhost.responsesPerMinute[MMAP_RESPONSE_5XX]);
+        inst.RequestLatencyP50_value(vhost.latencyP50);
+        inst.RequestLatencyP95_value(vhost.latencyP95);
+        inst.RequestLatencyP99_value(vhost.latencyP99);
+        inst.RequestLatencyMax_value(vhost.latencyMax);
+        inst.UniqueClients_value(vhost.uniqueClients);
+        inst.UniqueClientsToday_value(vhost.uniqueClientsToday);
+
+        for (int r = 0; r < MMAP_RATE_COUNT; r++)
+        {
+            for (int w = 0; w < MMAP_RATE_WINDOWS; w++)
+            {
+                (inst.*s_rateAverages[r][w])(vhost.rateAverage[r][w]);
+                (inst.*s_ratePeaks[r][w])(vhost.ratePeak[r][w]);
+            }
+        }
     }
 
-    context.Post(inst);
+    instances.push_back(inst);
 }
 
 Apache_HTTPDVirtualHostStatistics_Class_Provider::Apache_HTTPDVirtualHostStatistics_Class_Provider(
@@ -127,11 +202,13 @@ void Apache_HTTPDVirtualHostStatistics_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    ApacheDataCollector data = g_pFactory->DataCollectorFactory();
+    ApacheDataCollector data;
 
     CIM_PEX_BEGIN
     {
-        apr_status_t status;
+        std::vector<Apache_HTTPDVirtualHostStatistics_Class> instances;
+        apr_uint32_t sequence;
+        int attempt = 0;
 
         if (APR_SUCCESS != data.Attach("Apache_HTTPDServer_Class_Provider::EnumerateInstances"))
         {
@@ -139,34 +216,51 @@ void Apache_HTTPDVirtualHostStatistics_Class_Provider::EnumerateInstances(
             return;
         }
 
-        /* Lock the mutex to walk the list */
-        if (APR_SUCCESS != (status = data.LockMutex()))
+        // Build the instances from a consistent view of the region, without holding
+        // the global mutex (which would keep Apache waiting if it reloads meanwhile)
+        do
         {
-            DisplayError(status, "VirtualHostStatistics::EnumerateInstances: failed to lock mutex");
-            context.Post(MI_RESULT_FAILED);
-            return;
-        }
-
-        for (apr_size_t i = 2; i <= data.GetVHostCount() - 1; i++)
-        {
-            EnumerateOneInstance(context, keysOnly, i, data);
-        }
-
-        // Only display _Unknown if data is saved to it
-        if (data.GetVHostElements()[1].requestsTotal)
+            if (++attempt > ApacheDataCollector::ReadAttempts
+                || (attempt > 1 && APR_SUCCESS != data.Reattach("Apache_HTTPDVirtualHostStatistics_Class_Provider::EnumerateInstances")))
+            {
+                DisplayError(0, "VirtualHostStatistics::EnumerateInstances: shared memory region changed while reading");
+                context.Post(MI_RESULT_FAILED);
+                return;
+            }
+
+            sequence = data.ReadBegin();
+            instances.clear();
+
+            // Serve the counters and rates from a copy taken in one pass
+            const ApacheSnapshot& snapshot = data.Snapshot();
+
+            for (apr_size_t i = 2; i <= snapshot.vhostCount - 1; i++)
+            {
+                if (! snapshot.vhosts[i].active)
+                {
+                    continue;
+                }
+                EnumerateOneInstance(instances, keysOnly, i, data, snapshot.vhosts[i]);
+            }
+
+            // Only display _Unknown if data is saved to it
+            if (snapshot.vhosts[1].requestsTotal)
+            {
+                EnumerateOneInstance(instances, keysOnly, 1, data, snapshot.vhosts[1]);
+            }
+
+            // Support _Total
+            EnumerateOneInstance(instances, keysOnly, 0, data, snapshot.vhosts[0]);
+        } while (data.ReadRetry(sequence));
+
+        for (size_t i = 0; i < instances.size(); i++)
         {
-            EnumerateOneInstance(context, keysOnly, 1, data);
+            context.Post(instances[i]);
         }
 
-        // Support _Total
-        EnumerateOneInstance(context, keysOnly, 0, data);
-
         context.Post(MI_RESULT_OK);
     }
     CIM_PEX_END( "Apache_HTTPDVirtualHostStatistics_Class_Provider::EnumerateInstances" );
-
-    // Be sure mutex gets unlocked, regardless if an exception occurs
-    data.UnlockMutex();
 }
 
 void Apache_HTTPDVirtualHostStatistics_Class_Provider::GetInstance(
@@ -0,0 +1,1062 @@
+/* @migen@ */
+/*
+**==============================================================================
+**
+** WARNING: THIS FILE WAS AUTOMATICALLY GENERATED. PLEASE DO NOT EDIT.
+**
+**==============================================================================
+*/
+#ifndef _Apache_HTTPDVirtualHostTopURL_h
+#define _Apache_HTTPDVirtualHostTopURL_h
+
+#include <MI.h>
+#include "CIM_StatisticalData.h"
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL [Apache_HTTPDVirtualHostTopURL]
+**
+** Keys:
+**    InstanceID
+**
+**==============================================================================
+*/
+
+typedef struct _Apache_HTTPDVirtualHostTopURL /* extends CIM_StatisticalData */
+{
+    MI_Instance __instance;
+    /* CIM_ManagedElement properties */
+    /*KEY*/ MI_ConstStringField InstanceID;
+    MI_ConstStringField Caption;
+    MI_ConstStringField Description;
+    MI_ConstStringField ElementName;
+    /* CIM_StatisticalData properties */
+    MI_ConstDatetimeField StartStatisticTime;
+    MI_ConstDatetimeField StatisticTime;
+    MI_ConstDatetimeField SampleInterval;
+    /* Apache_HTTPDVirtualHostTopURL properties */
+    MI_ConstStringField ServerName;
+    MI_ConstStringField URL;
+    MI_ConstUint64Field Requests;
+    MI_ConstUint64Field RequestsBytes;
+    MI_ConstUint32Field RankByRequests;
+    MI_ConstUint32Field RankByBytes;
+}
+Apache_HTTPDVirtualHostTopURL;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_Ref
+{
+    Apache_HTTPDVirtualHostTopURL* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostTopURL_Ref;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_ConstRef
+{
+    MI_CONST Apache_HTTPDVirtualHostTopURL* value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostTopURL_ConstRef;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_Array
+{
+    struct _Apache_HTTPDVirtualHostTopURL** data;
+    MI_Uint32 size;
+}
+Apache_HTTPDVirtualHostTopURL_Array;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_ConstArray
+{
+    struct _Apache_HTTPDVirtualHostTopURL MI_CONST* MI_CONST* data;
+    MI_Uint32 size;
+}
+Apache_HTTPDVirtualHostTopURL_ConstArray;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_ArrayRef
+{
+    Apache_HTTPDVirtualHostTopURL_Array value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostTopURL_ArrayRef;
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_ConstArrayRef
+{
+    Apache_HTTPDVirtualHostTopURL_ConstArray value;
+    MI_Boolean exists;
+    MI_Uint8 flags;
+}
+Apache_HTTPDVirtualHostTopURL_ConstArrayRef;
+
+MI_EXTERN_C MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostTopURL_rtti;
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Construct(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Context* context)
+{
+    return MI_ConstructInstance(context, &Apache_HTTPDVirtualHostTopURL_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clone(
+    const Apache_HTTPDVirtualHostTopURL* self,
+    Apache_HTTPDVirtualHostTopURL** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Boolean MI_CALL Apache_HTTPDVirtualHostTopURL_IsA(
+    const MI_Instance* self)
+{
+    MI_Boolean res = MI_FALSE;
+    return MI_Instance_IsA(self, &Apache_HTTPDVirtualHostTopURL_rtti, &res) == MI_RESULT_OK && res;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Destruct(Apache_HTTPDVirtualHostTopURL* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Delete(Apache_HTTPDVirtualHostTopURL* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Post(
+    const Apache_HTTPDVirtualHostTopURL* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_InstanceID(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_InstanceID(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        0,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_InstanceID(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_Caption(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_Caption(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_Caption(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_Description(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_Description(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        2,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_Description(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        2);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_ElementName(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_ElementName(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        3,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_ElementName(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        3);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_StartStatisticTime(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->StartStatisticTime)->value = x;
+    ((MI_DatetimeField*)&self->StartStatisticTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_StartStatisticTime(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->StartStatisticTime, 0, sizeof(self->StartStatisticTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_StatisticTime(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->StatisticTime)->value = x;
+    ((MI_DatetimeField*)&self->StatisticTime)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_StatisticTime(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->StatisticTime, 0, sizeof(self->StatisticTime));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_SampleInterval(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Datetime x)
+{
+    ((MI_DatetimeField*)&self->SampleInterval)->value = x;
+    ((MI_DatetimeField*)&self->SampleInterval)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_SampleInterval(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->SampleInterval, 0, sizeof(self->SampleInterval));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_ServerName(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_ServerName(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        7,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_ServerName(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        7);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_URL(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_SetPtr_URL(
+    Apache_HTTPDVirtualHostTopURL* self,
+    const MI_Char* str)
+{
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        8,
+        (MI_Value*)&str,
+        MI_STRING,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_URL(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        8);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_Requests(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->Requests)->value = x;
+    ((MI_Uint64Field*)&self->Requests)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_Requests(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->Requests, 0, sizeof(self->Requests));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_RequestsBytes(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Uint64 x)
+{
+    ((MI_Uint64Field*)&self->RequestsBytes)->value = x;
+    ((MI_Uint64Field*)&self->RequestsBytes)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_RequestsBytes(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->RequestsBytes, 0, sizeof(self->RequestsBytes));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_RankByRequests(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RankByRequests)->value = x;
+    ((MI_Uint32Field*)&self->RankByRequests)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_RankByRequests(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->RankByRequests, 0, sizeof(self->RankByRequests));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Set_RankByBytes(
+    Apache_HTTPDVirtualHostTopURL* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->RankByBytes)->value = x;
+    ((MI_Uint32Field*)&self->RankByBytes)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_Clear_RankByBytes(
+    Apache_HTTPDVirtualHostTopURL* self)
+{
+    memset((void*)&self->RankByBytes, 0, sizeof(self->RankByBytes));
+    return MI_RESULT_OK;
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL.ResetSelectedStats()
+**
+**==============================================================================
+*/
+
+typedef struct _Apache_HTTPDVirtualHostTopURL_ResetSelectedStats
+{
+    MI_Instance __instance;
+    /*OUT*/ MI_ConstUint32Field MIReturn;
+    /*IN*/ MI_ConstStringAField SelectedStatistics;
+}
+Apache_HTTPDVirtualHostTopURL_ResetSelectedStats;
+
+MI_EXTERN_C MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti;
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Construct(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_ConstructParameters(context, &Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti,
+        (MI_Instance*)&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Clone(
+    const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats** newInstance)
+{
+    return MI_Instance_Clone(
+        &self->__instance, (MI_Instance**)newInstance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Destruct(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self)
+{
+    return MI_Instance_Destruct(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Delete(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self)
+{
+    return MI_Instance_Delete(&self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Post(
+    const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    MI_Context* context)
+{
+    return MI_PostInstance(context, &self->__instance);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Set_MIReturn(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    MI_Uint32 x)
+{
+    ((MI_Uint32Field*)&self->MIReturn)->value = x;
+    ((MI_Uint32Field*)&self->MIReturn)->exists = 1;
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Clear_MIReturn(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self)
+{
+    memset((void*)&self->MIReturn, 0, sizeof(self->MIReturn));
+    return MI_RESULT_OK;
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Set_SelectedStatistics(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        0);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_SetPtr_SelectedStatistics(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self,
+    const MI_Char** data,
+    MI_Uint32 size)
+{
+    MI_Array arr;
+    arr.data = (void*)data;
+    arr.size = size;
+    return self->__instance.ft->SetElementAt(
+        (MI_Instance*)&self->__instance,
+        1,
+        (MI_Value*)&arr,
+        MI_STRINGA,
+        MI_FLAG_BORROW);
+}
+
+MI_INLINE MI_Result MI_CALL Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Clear_SelectedStatistics(
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* self)
+{
+    return self->__instance.ft->ClearElementAt(
+        (MI_Instance*)&self->__instance,
+        1);
+}
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL provider function prototypes
+**
+**==============================================================================
+*/
+
+/* The developer may optionally define this structure */
+typedef struct _Apache_HTTPDVirtualHostTopURL_Self Apache_HTTPDVirtualHostTopURL_Self;
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Load(
+    Apache_HTTPDVirtualHostTopURL_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Unload(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_EnumerateInstances(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_GetInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* instanceName,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_CreateInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* newInstance);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_ModifyInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* modifiedInstance,
+    const MI_PropertySet* propertySet);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_DeleteInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* instanceName);
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Invoke_ResetSelectedStats(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const Apache_HTTPDVirtualHostTopURL* instanceName,
+    const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* in);
+
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL_Class
+**
+**==============================================================================
+*/
+
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+
+MI_BEGIN_NAMESPACE
+
+class Apache_HTTPDVirtualHostTopURL_Class : public CIM_StatisticalData_Class
+{
+public:
+    
+    typedef Apache_HTTPDVirtualHostTopURL Self;
+    
+    Apache_HTTPDVirtualHostTopURL_Class() :
+        CIM_StatisticalData_Class(&Apache_HTTPDVirtualHostTopURL_rtti)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_Class(
+        const Apache_HTTPDVirtualHostTopURL* instanceName,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(
+            &Apache_HTTPDVirtualHostTopURL_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        CIM_StatisticalData_Class(clDecl, instance, keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_Class(
+        const MI_ClassDecl* clDecl) :
+        CIM_StatisticalData_Class(clDecl)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_Class& operator=(
+        const Apache_HTTPDVirtualHostTopURL_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_Class(
+        const Apache_HTTPDVirtualHostTopURL_Class& x) :
+        CIM_StatisticalData_Class(x)
+    {
+    }
+
+    static const MI_ClassDecl* GetClassDecl()
+    {
+        return &Apache_HTTPDVirtualHostTopURL_rtti;
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.ServerName
+    //
+    
+    const Field<String>& ServerName() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n);
+    }
+    
+    void ServerName(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n) = x;
+    }
+    
+    const String& ServerName_value() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).value;
+    }
+    
+    void ServerName_value(const String& x)
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool ServerName_exists() const
+    {
+        const size_t n = offsetof(Self, ServerName);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void ServerName_clear()
+    {
+        const size_t n = offsetof(Self, ServerName);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.URL
+    //
+    
+    const Field<String>& URL() const
+    {
+        const size_t n = offsetof(Self, URL);
+        return GetField<String>(n);
+    }
+    
+    void URL(const Field<String>& x)
+    {
+        const size_t n = offsetof(Self, URL);
+        GetField<String>(n) = x;
+    }
+    
+    const String& URL_value() const
+    {
+        const size_t n = offsetof(Self, URL);
+        return GetField<String>(n).value;
+    }
+    
+    void URL_value(const String& x)
+    {
+        const size_t n = offsetof(Self, URL);
+        GetField<String>(n).Set(x);
+    }
+    
+    bool URL_exists() const
+    {
+        const size_t n = offsetof(Self, URL);
+        return GetField<String>(n).exists ? true : false;
+    }
+    
+    void URL_clear()
+    {
+        const size_t n = offsetof(Self, URL);
+        GetField<String>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.Requests
+    //
+    
+    const Field<Uint64>& Requests() const
+    {
+        const size_t n = offsetof(Self, Requests);
+        return GetField<Uint64>(n);
+    }
+    
+    void Requests(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, Requests);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& Requests_value() const
+    {
+        const size_t n = offsetof(Self, Requests);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void Requests_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, Requests);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool Requests_exists() const
+    {
+        const size_t n = offsetof(Self, Requests);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void Requests_clear()
+    {
+        const size_t n = offsetof(Self, Requests);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.RequestsBytes
+    //
+    
+    const Field<Uint64>& RequestsBytes() const
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        return GetField<Uint64>(n);
+    }
+    
+    void RequestsBytes(const Field<Uint64>& x)
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        GetField<Uint64>(n) = x;
+    }
+    
+    const Uint64& RequestsBytes_value() const
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        return GetField<Uint64>(n).value;
+    }
+    
+    void RequestsBytes_value(const Uint64& x)
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        GetField<Uint64>(n).Set(x);
+    }
+    
+    bool RequestsBytes_exists() const
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        return GetField<Uint64>(n).exists ? true : false;
+    }
+    
+    void RequestsBytes_clear()
+    {
+        const size_t n = offsetof(Self, RequestsBytes);
+        GetField<Uint64>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.RankByRequests
+    //
+    
+    const Field<Uint32>& RankByRequests() const
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        return GetField<Uint32>(n);
+    }
+    
+    void RankByRequests(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RankByRequests_value() const
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RankByRequests_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RankByRequests_exists() const
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RankByRequests_clear()
+    {
+        const size_t n = offsetof(Self, RankByRequests);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_Class.RankByBytes
+    //
+    
+    const Field<Uint32>& RankByBytes() const
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        return GetField<Uint32>(n);
+    }
+    
+    void RankByBytes(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& RankByBytes_value() const
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void RankByBytes_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool RankByBytes_exists() const
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void RankByBytes_clear()
+    {
+        const size_t n = offsetof(Self, RankByBytes);
+        GetField<Uint32>(n).Clear();
+    }
+};
+
+typedef Array<Apache_HTTPDVirtualHostTopURL_Class> Apache_HTTPDVirtualHostTopURL_ClassA;
+
+class Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class : public Instance
+{
+public:
+    
+    typedef Apache_HTTPDVirtualHostTopURL_ResetSelectedStats Self;
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class() :
+        Instance(&Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class(
+        const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* instanceName,
+        bool keysOnly) :
+        Instance(
+            &Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti,
+            &instanceName->__instance,
+            keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class(
+        const MI_ClassDecl* clDecl,
+        const MI_Instance* instance,
+        bool keysOnly) :
+        Instance(clDecl, instance, keysOnly)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class(
+        const MI_ClassDecl* clDecl) :
+        Instance(clDecl)
+    {
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class& operator=(
+        const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class& x)
+    {
+        CopyRef(x);
+        return *this;
+    }
+    
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class(
+        const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class& x) :
+        Instance(x)
+    {
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class.MIReturn
+    //
+    
+    const Field<Uint32>& MIReturn() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n);
+    }
+    
+    void MIReturn(const Field<Uint32>& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n) = x;
+    }
+    
+    const Uint32& MIReturn_value() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).value;
+    }
+    
+    void MIReturn_value(const Uint32& x)
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Set(x);
+    }
+    
+    bool MIReturn_exists() const
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        return GetField<Uint32>(n).exists ? true : false;
+    }
+    
+    void MIReturn_clear()
+    {
+        const size_t n = offsetof(Self, MIReturn);
+        GetField<Uint32>(n).Clear();
+    }
+
+    //
+    // Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class.SelectedStatistics
+    //
+    
+    const Field<StringA>& SelectedStatistics() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n);
+    }
+    
+    void SelectedStatistics(const Field<StringA>& x)
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n) = x;
+    }
+    
+    const StringA& SelectedStatistics_value() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n).value;
+    }
+    
+    void SelectedStatistics_value(const StringA& x)
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n).Set(x);
+    }
+    
+    bool SelectedStatistics_exists() const
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        return GetField<StringA>(n).exists ? true : false;
+    }
+    
+    void SelectedStatistics_clear()
+    {
+        const size_t n = offsetof(Self, SelectedStatistics);
+        GetField<StringA>(n).Clear();
+    }
+};
+
+typedef Array<Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class> Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_ClassA;
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _Apache_HTTPDVirtualHostTopURL_h */
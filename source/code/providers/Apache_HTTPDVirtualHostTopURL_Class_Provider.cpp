@@ -0,0 +1,234 @@
+/* @migen@ */
+
+//
+//--------------------------------- START OF LICENSE ----------------------------
+//
+// Apache Cimprov ver. 1.0
+//
+// Copyright (c) Microsoft Corporation
+//
+// All rights reserved. 
+//
+// Licensed under the Apache License, Version 2.0 (the License); you may not use
+// this file except in compliance with the license. You may obtain a copy of the
+// License at http://www.apache.org/licenses/LICENSE-2.0 
+//
+// THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+// ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+// WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+// MERCHANTABLITY OR NON-INFRINGEMENT.
+//
+// See the Apache Version 2.0 License for specific language governing permissions
+// and limitations under the License.
+//
+//---------------------------------- END OF LICENSE -----------------------------
+//
+
+#include <MI.h>
+#include "Apache_HTTPDVirtualHostTopURL_Class_Provider.h"
+
+// Provider include definitions
+#include "apachebinding.h"
+
+#include <string>
+#include <vector>
+
+
+MI_BEGIN_NAMESPACE
+
+static void EnumerateOneInstance(std::vector<Apache_HTTPDVirtualHostTopURL_Class>& instances,
+        bool keysOnly,
+        apr_size_t item,
+        const mmap_topurl_result& result,
+        ApacheDataCollector& data)
+{
+    Apache_HTTPDVirtualHostTopURL_Class inst;
+
+    // Insert the key into the instance (virtual host and URL)
+    std::string instanceID = std::string(data.GetVHostInstanceID(item)) + ";" + result.url;
+    inst.InstanceID_value(instanceID.c_str());
+
+    if (! keysOnly)
+    {
+        // Insert the values into the instance
+
+        inst.ServerName_value(data.GetVHostName(item));
+        inst.URL_value(result.url);
+        inst.Requests_value(result.requests);
+        inst.RequestsBytes_value(result.bytes);
+        inst.RankByRequests_value(result.rankByRequests);
+        inst.RankByBytes_value(result.rankByBytes);
+    }
+
+    instances.push_back(inst);
+}
+
+static void EnumerateHostInstances(std::vector<Apache_HTTPDVirtualHostTopURL_Class>& instances,
+        bool keysOnly,
+        apr_size_t item,
+        ApacheDataCollector& data)
+{
+    mmap_topurl_result *results = data.GetTopUrlResults(item);
+
+    for (apr_size_t i = 0; i < 2 * data.GetTopUrlCount() && results[i].url[0] != '\0'; i++)
+    {
+        EnumerateOneInstance(instances, keysOnly, item, results[i], data);
+    }
+}
+
+Apache_HTTPDVirtualHostTopURL_Class_Provider::Apache_HTTPDVirtualHostTopURL_Class_Provider(
+    Module* module) :
+    m_Module(module)
+{
+}
+
+Apache_HTTPDVirtualHostTopURL_Class_Provider::~Apache_HTTPDVirtualHostTopURL_Class_Provider()
+{
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::Load(
+        Context& context)
+{
+    CIM_PEX_BEGIN
+    {
+        if (NULL == g_pFactory)
+        {
+            g_pFactory = new ApacheFactory();
+        }
+
+        if (APR_SUCCESS != g_pFactory->GetInit()->Load("VirtualHostTopURL"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        MI_Result r = context.RefuseUnload();
+        if ( MI_RESULT_OK != r )
+        {
+            DisplayError(OMI_Error(r), "Apache_HTTPDVirtualHostTopURL_Class_Provider refuses to not unload");
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostTopURL_Class_Provider::Load" );
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::Unload(
+        Context& context)
+{
+    CIM_PEX_BEGIN
+    {
+        if (APR_SUCCESS != g_pFactory->GetInit()->Unload("VirtualHostTopURL"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostTopURL_Class_Provider::Unload" );
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::EnumerateInstances(
+    Context& context,
+    const String& nameSpace,
+    const PropertySet& propertySet,
+    bool keysOnly,
+    const MI_Filter* filter)
+{
+    ApacheDataCollector data;
+
+    CIM_PEX_BEGIN
+    {
+        std::vector<Apache_HTTPDVirtualHostTopURL_Class> instances;
+        apr_uint32_t sequence;
+        int attempt = 0;
+
+        if (APR_SUCCESS != data.Attach("Apache_HTTPDVirtualHostTopURL_Class_Provider::EnumerateInstances"))
+        {
+            context.Post(MI_RESULT_FAILED);
+            return;
+        }
+
+        // Build the instances from a consistent view of the region, without holding
+        // the global mutex (which would keep Apache waiting if it reloads meanwhile)
+        do
+        {
+            if (++attempt > ApacheDataCollector::ReadAttempts
+                || (attempt > 1 && APR_SUCCESS != data.Reattach("Apache_HTTPDVirtualHostTopURL_Class_Provider::EnumerateInstances")))
+            {
+                DisplayError(0, "VirtualHostTopURL::EnumerateInstances: shared memory region changed while reading");
+                context.Post(MI_RESULT_FAILED);
+                return;
+            }
+
+            sequence = data.ReadBegin();
+            instances.clear();
+
+            // Top URLs are only kept for virtual hosts (including _Unknown), not for _Total
+            for (apr_size_t i = 2; i <= data.GetVHostCount() - 1; i++)
+            {
+                if (! data.IsVHostActive(i))
+                {
+                    continue;
+                }
+                EnumerateHostInstances(instances, keysOnly, i, data);
+            }
+            EnumerateHostInstances(instances, keysOnly, 1, data);
+        } while (data.ReadRetry(sequence));
+
+        for (size_t i = 0; i < instances.size(); i++)
+        {
+            context.Post(instances[i]);
+        }
+
+        context.Post(MI_RESULT_OK);
+    }
+    CIM_PEX_END( "Apache_HTTPDVirtualHostTopURL_Class_Provider::EnumerateInstances" );
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::GetInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostTopURL_Class& instanceName,
+    const PropertySet& propertySet)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::CreateInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostTopURL_Class& newInstance)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::ModifyInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostTopURL_Class& modifiedInstance,
+    const PropertySet& propertySet)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::DeleteInstance(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostTopURL_Class& instanceName)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+void Apache_HTTPDVirtualHostTopURL_Class_Provider::Invoke_ResetSelectedStats(
+    Context& context,
+    const String& nameSpace,
+    const Apache_HTTPDVirtualHostTopURL_Class& instanceName,
+    const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class& in)
+{
+    context.Post(MI_RESULT_NOT_SUPPORTED);
+}
+
+
+MI_END_NAMESPACE
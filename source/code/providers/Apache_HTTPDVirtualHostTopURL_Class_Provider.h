@@ -0,0 +1,81 @@
+/* @migen@ */
+#ifndef _Apache_HTTPDVirtualHostTopURL_Class_Provider_h
+#define _Apache_HTTPDVirtualHostTopURL_Class_Provider_h
+
+#include "Apache_HTTPDVirtualHostTopURL.h"
+#ifdef __cplusplus
+# include <micxx/micxx.h>
+# include "module.h"
+
+MI_BEGIN_NAMESPACE
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL provider class declaration
+**
+**==============================================================================
+*/
+
+class Apache_HTTPDVirtualHostTopURL_Class_Provider
+{
+/* @MIGEN.BEGIN@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+private:
+    Module* m_Module;
+
+public:
+    Apache_HTTPDVirtualHostTopURL_Class_Provider(
+        Module* module);
+
+    ~Apache_HTTPDVirtualHostTopURL_Class_Provider();
+
+    void Load(
+        Context& context);
+
+    void Unload(
+        Context& context);
+
+    void EnumerateInstances(
+        Context& context,
+        const String& nameSpace,
+        const PropertySet& propertySet,
+        bool keysOnly,
+        const MI_Filter* filter);
+
+    void GetInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostTopURL_Class& instance,
+        const PropertySet& propertySet);
+
+    void CreateInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostTopURL_Class& newInstance);
+
+    void ModifyInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostTopURL_Class& modifiedInstance,
+        const PropertySet& propertySet);
+
+    void DeleteInstance(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostTopURL_Class& instance);
+
+    void Invoke_ResetSelectedStats(
+        Context& context,
+        const String& nameSpace,
+        const Apache_HTTPDVirtualHostTopURL_Class& instanceName,
+        const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class& in);
+
+/* @MIGEN.END@ CAUTION: PLEASE DO NOT EDIT OR DELETE THIS LINE. */
+};
+
+MI_END_NAMESPACE
+
+#endif /* __cplusplus */
+
+#endif /* _Apache_HTTPDVirtualHostTopURL_Class_Provider_h */
+
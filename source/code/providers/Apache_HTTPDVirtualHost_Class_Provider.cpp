@@ -39,88 +39,74 @@
 // Virtual host memory mapped file definitions
 #include "apachebinding.h"
 #include "cimconstants.h"
+#include "instancecache.h"
 #include "utils.h"
 
-// Convert a string encoded in this project's base-64 encoding into a 16-bit integer
-static apr_uint16_t decode64(const char* str)
-{
-    return (((apr_uint16_t)(unsigned char)*str       - 0x0030) << 12) |
-           (((apr_uint16_t)(unsigned char)*(str + 1) - 0x0030) <<  6) |
-            ((apr_uint16_t)(unsigned char)*(str + 2) - 0x0030);
-}
-
 MI_BEGIN_NAMESPACE
 
-static void EnumerateOneInstance(Context& context,
+// Instances only change when Apache reloads its configuration (except for
+// dynamic hosts, which are named at run time, so they aren't cached)
+static InstanceCache<Apache_HTTPDVirtualHost_Class> s_instanceCache;
+
+static void EnumerateOneInstance(std::vector<Apache_HTTPDVirtualHost_Class>& instances,
         bool keysOnly,
         apr_size_t item,
         ApacheDataCollector& data)
 {
     Apache_HTTPDVirtualHost_Class inst;
+    bool fCacheable = ! data.IsDynamicHost(item);
+
+    if (fCacheable && s_instanceCache.Lookup(data.GetGeneration(), keysOnly, item, inst))
+    {
+        instances.push_back(inst);
+        return;
+    }
+
     mmap_vhost_elements *vhosts = data.GetVHostElements();
     const char* apacheServerVersion = GetApacheComponentVersion(data.GetServerVersion(), "Apache");
 
     // Insert the key properties into the instance
-    inst.Name_value(data.GetDataString(vhosts[item].instanceIDOffset));
+    inst.Name_value(data.GetVHostInstanceID(item));
     inst.Version_value(apacheServerVersion);
-    inst.SoftwareElementID_value(data.GetDataString(vhosts[item].instanceIDOffset));
+    inst.SoftwareElementID_value(data.GetVHostInstanceID(item));
     inst.TargetOperatingSystem_value(CIM_TARGET_OPERATING_SYSTEM);
     inst.SoftwareElementState_value(CIM_SOFTWARE_ELEMENT_STATE_RUNNING);
 
     // Insert the instance ID into the instance
 
-    inst.InstanceID_value(data.GetDataString(vhosts[item].instanceIDOffset));
+    inst.InstanceID_value(data.GetVHostInstanceID(item));
 
     if (! keysOnly)
     {
-        // Get the IP addresses and ports from the array of (IP address, port) items
-        // corresponding to this host
+        // Get the IP addresses, ports and aliases of this host from the region's typed arrays
+        // (their formatted forms are built by Apache, so nothing here needs parsing)
+
+        const mmap_vhost_address* addresses = data.GetVHostAddresses() + vhosts[item].addressIndex;
+        const apr_size_t* aliases = data.GetVHostAliases() + vhosts[item].aliasIndex;
 
         std::vector<mi::String> ipAddressesArray;
         std::vector<mi::Uint16> portsArray;
         std::vector<mi::String> aliasesArray;
 
-        std::string ipAddressesFormatted;
-        std::string portsFormatted;
-        std::string aliasesFormatted;
-
-        const char* ptr = data.GetDataString(vhosts[item].addressesAndPortsOffset);
-        while (*ptr != '\0')
+        ipAddressesArray.reserve(vhosts[item].addressCount);
+        portsArray.reserve(vhosts[item].addressCount);
+        for (apr_size_t i = 0; i < vhosts[item].addressCount; i++)
         {
-            ipAddressesArray.push_back(ptr);
-            if (ipAddressesFormatted.size())
-            {
-                ipAddressesFormatted += ", ";
-            }
-            ipAddressesFormatted += ptr;
-            ptr += strlen(ptr) + 1;
-
-            portsArray.push_back(decode64(ptr));
-            if (portsFormatted.size())
-            {
-                portsFormatted += ", ";
-            }
-            portsFormatted += apr_itoa(data.GetPool(), decode64(ptr));
-            ptr += strlen(ptr) + 1;
+            ipAddressesArray.push_back(data.GetDataString(addresses[i].hostOffset));
+            portsArray.push_back(addresses[i].port);
         }
 
-        ptr = data.GetDataString(vhosts[item].serverAliasesOffset);
-        while (*ptr != '\0')
+        aliasesArray.reserve(vhosts[item].aliasCount);
+        for (apr_size_t i = 0; i < vhosts[item].aliasCount; i++)
         {
-            aliasesArray.push_back(ptr);
-            if (aliasesFormatted.size())
-            {
-                aliasesFormatted += ", ";
-            }
-            aliasesFormatted += ptr;
-            ptr += strlen(ptr) + 1;
+            aliasesArray.push_back(data.GetDataString(aliases[i]));
         }
 
         // Insert the values into the instance
 
-        inst.ServerName_value(data.GetDataString(vhosts[item].hostNameOffset));
+        inst.ServerName_value(data.GetVHostName(item));
         inst.SoftwareElementState_value(CIM_SOFTWARE_ELEMENT_STATE_RUNNING);
-        inst.SoftwareElementID_value(data.GetDataString(vhosts[item].instanceIDOffset));
+        inst.SoftwareElementID_value(data.GetVHostInstanceID(item));
         inst.TargetOperatingSystem_value(CIM_TARGET_OPERATING_SYSTEM);
 
         inst.DocumentRoot_value(data.GetDataString(vhosts[item].documentRootOffset));
@@ -131,18 +117,23 @@ static void EnumerateOneInstance(Context& context,
 
         mi::StringA ipAddressesA(&ipAddressesArray[0], (MI_Uint32)ipAddressesArray.size());
         inst.IPAddresses_value(ipAddressesA);
-        inst.IPAddressesFormatted_value(ipAddressesFormatted.c_str());
+        inst.IPAddressesFormatted_value(data.GetDataString(vhosts[item].ipAddressesFormattedOffset));
 
         mi::Uint16A portsA(&portsArray[0], (MI_Uint32)portsArray.size());
         inst.Ports_value(portsA);
-        inst.PortsFormatted_value(portsFormatted.c_str());
+        inst.PortsFormatted_value(data.GetDataString(vhosts[item].portsFormattedOffset));
 
         mi::StringA aliasesA(&aliasesArray[0], (MI_Uint32)aliasesArray.size());
         inst.ServerAlias_value(aliasesA);
-        inst.ServerAliasFormatted_value(aliasesFormatted.c_str());
+        inst.ServerAliasFormatted_value(data.GetDataString(vhosts[item].aliasesFormattedOffset));
+    }
+
+    if (fCacheable)
+    {
+        s_instanceCache.Store(data.GetGeneration(), keysOnly, item, inst);
     }
 
-    context.Post(inst);
+    instances.push_back(inst);
 }
 
 Apache_HTTPDVirtualHost_Class_Provider::Apache_HTTPDVirtualHost_Class_Provider(
@@ -171,6 +162,13 @@ void Apache_HTTPDVirtualHost_Class_Provider::Load(
             return;
         }
 
+        // Not fatal; instances are just built every time
+        apr_status_t status = s_instanceCache.Initialize(g_pFactory->GetInit()->GetPool());
+        if (APR_SUCCESS != status)
+        {
+            DisplayError(status, "Apache_HTTPDVirtualHost_Class_Provider::Load: failed to create instance cache");
+        }
+
         // Notify that we don't wish to unload
         MI_Result r = context.RefuseUnload();
         if ( MI_RESULT_OK != r )
@@ -188,6 +186,8 @@ void Apache_HTTPDVirtualHost_Class_Provider::Unload(
 {
     CIM_PEX_BEGIN
     {
+        s_instanceCache.Shutdown();
+
         if (APR_SUCCESS != g_pFactory->GetInit()->Unload("VirtualHost"))
         {
             context.Post(MI_RESULT_FAILED);
@@ -206,12 +206,13 @@ void Apache_HTTPDVirtualHost_Class_Provider::EnumerateInstances(
     bool keysOnly,
     const MI_Filter* filter)
 {
-    ApacheDataCollector data = g_pFactory->DataCollectorFactory();
+    ApacheDataCollector data;
 
     CIM_PEX_BEGIN
     {
-        Apache_HTTPDVirtualHost_Class inst;
-        apr_status_t status;
+        std::vector<Apache_HTTPDVirtualHost_Class> instances;
+        apr_uint32_t sequence;
+        int attempt = 0;
 
         if (APR_SUCCESS != data.Attach("Apache_HTTPDVirtualHost_Class_Provider::EnumerateInstances"))
         {
@@ -219,31 +220,46 @@ void Apache_HTTPDVirtualHost_Class_Provider::EnumerateInstances(
             return;
         }
 
-        /* Lock the mutex to walk the list */
-        if (APR_SUCCESS != (status = data.LockMutex()))
+        // Build the instances from a consistent view of the region, without holding
+        // the global mutex (which would keep Apache waiting if it reloads meanwhile)
+        do
         {
-            DisplayError(status, "VirtualHost::EnumerateInstances: failed to lock mutex");
-            context.Post(MI_RESULT_FAILED);
-            return;
-        }
+            if (++attempt > ApacheDataCollector::ReadAttempts
+                || (attempt > 1 && APR_SUCCESS != data.Reattach("Apache_HTTPDVirtualHost_Class_Provider::EnumerateInstances")))
+            {
+                DisplayError(0, "VirtualHost::EnumerateInstances: shared memory region changed while reading");
+                context.Post(MI_RESULT_FAILED);
+                return;
+            }
 
-        for (apr_size_t i = 2; i <= data.GetVHostCount() - 1; i++)
-        {
-            EnumerateOneInstance(context, keysOnly, i, data);
-        }
+            sequence = data.ReadBegin();
+            instances.clear();
+            const ApacheSnapshot& snapshot = data.Snapshot();
+
+            for (apr_size_t i = 2; i <= snapshot.vhostCount - 1; i++)
+            {
+                if (! snapshot.vhosts[i].active)
+                {
+                    continue;
+                }
+                EnumerateOneInstance(instances, keysOnly, i, data);
+            }
 
-        // Only display _Unknown if data is saved to it
-        if (data.GetVHostElements()[1].requestsTotal)
+            // Only display _Unknown if data is saved to it
+            if (snapshot.vhosts[1].requestsTotal)
+            {
+                EnumerateOneInstance(instances, keysOnly, 1, data);
+            }
+        } while (data.ReadRetry(sequence));
+
+        for (size_t i = 0; i < instances.size(); i++)
         {
-            EnumerateOneInstance(context, keysOnly, 1, data);
+            context.Post(instances[i]);
         }
 
         context.Post(MI_RESULT_OK);
     }
     CIM_PEX_END( "Apache_HTTPDVirtualHost_Class_Provider::EnumerateInstances" );
-
-    // Be sure mutex gets unlocked, regardless if an exception occurs
-    data.UnlockMutex();
 }
 
 void Apache_HTTPDVirtualHost_Class_Provider::GetInstance(
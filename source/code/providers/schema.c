@@ -12,7 +12,9 @@
 #include "Apache_HTTPDServerStatistics.h"
 #include "Apache_HTTPDVirtualHost.h"
 #include "Apache_HTTPDVirtualHostCertificate.h"
+#include "Apache_HTTPDVirtualHostResponseStatistics.h"
 #include "Apache_HTTPDVirtualHostStatistics.h"
+#include "Apache_HTTPDVirtualHostTopURL.h"
 
 /*
 **==============================================================================
@@ -1139,6 +1141,346 @@ static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_ConfigurationFile_p
     NULL,
 };
 
+/* property Apache_HTTPDServerStatistics.TotalPctCPUAverage1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUAverage1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E16, /* code */
+    MI_T("TotalPctCPUAverage1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUAverage1Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUPeak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUPeak1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E13, /* code */
+    MI_T("TotalPctCPUPeak1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUPeak1Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUAverage5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUAverage5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E16, /* code */
+    MI_T("TotalPctCPUAverage5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUAverage5Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUPeak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUPeak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E13, /* code */
+    MI_T("TotalPctCPUPeak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUPeak5Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUAverage15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUAverage15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E17, /* code */
+    MI_T("TotalPctCPUAverage15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUAverage15Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUPeak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUPeak15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E14, /* code */
+    MI_T("TotalPctCPUPeak15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUPeak15Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUAverage60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUAverage60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E17, /* code */
+    MI_T("TotalPctCPUAverage60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUAverage60Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.TotalPctCPUPeak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_TotalPctCPUPeak60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00746E14, /* code */
+    MI_T("TotalPctCPUPeak60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, TotalPctCPUPeak60Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersAverage1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersAverage1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E16, /* code */
+    MI_T("BusyWorkersAverage1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersAverage1Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersPeak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersPeak1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E13, /* code */
+    MI_T("BusyWorkersPeak1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersPeak1Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersAverage5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersAverage5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E16, /* code */
+    MI_T("BusyWorkersAverage5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersAverage5Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersPeak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersPeak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E13, /* code */
+    MI_T("BusyWorkersPeak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersPeak5Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersAverage15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersAverage15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E17, /* code */
+    MI_T("BusyWorkersAverage15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersAverage15Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersPeak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersPeak15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E14, /* code */
+    MI_T("BusyWorkersPeak15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersPeak15Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersAverage60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersAverage60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E17, /* code */
+    MI_T("BusyWorkersAverage60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersAverage60Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.BusyWorkersPeak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_BusyWorkersPeak60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00626E14, /* code */
+    MI_T("BusyWorkersPeak60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, BusyWorkersPeak60Min), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.ResidentMemoryKB */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_ResidentMemoryKB_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726210, /* code */
+    MI_T("ResidentMemoryKB"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, ResidentMemoryKB), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.ChildProcesses */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_ChildProcesses_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0063730E, /* code */
+    MI_T("ChildProcesses"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, ChildProcesses), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.AverageChildResidentMemoryKB */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_AverageChildResidentMemoryKB_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0061621C, /* code */
+    MI_T("AverageChildResidentMemoryKB"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, AverageChildResidentMemoryKB), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDServerStatistics.AverageChildPctCPU */
+static MI_CONST MI_PropertyDecl Apache_HTTPDServerStatistics_AverageChildPctCPU_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00617512, /* code */
+    MI_T("AverageChildPctCPU"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDServerStatistics, AverageChildPctCPU), /* offset */
+    MI_T("Apache_HTTPDServerStatistics"), /* origin */
+    MI_T("Apache_HTTPDServerStatistics"), /* propagator */
+    NULL,
+};
+
 static MI_PropertyDecl MI_CONST* MI_CONST Apache_HTTPDServerStatistics_props[] =
 {
     &CIM_StatisticalData_InstanceID_prop,
@@ -1153,6 +1495,26 @@ static MI_PropertyDecl MI_CONST* MI_CONST Apache_HTTPDServerStatistics_props[] =
     &Apache_HTTPDServerStatistics_BusyWorkers_prop,
     &Apache_HTTPDServerStatistics_PctBusyWorkers_prop,
     &Apache_HTTPDServerStatistics_ConfigurationFile_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUAverage1Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUPeak1Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUAverage5Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUPeak5Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUAverage15Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUPeak15Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUAverage60Min_prop,
+    &Apache_HTTPDServerStatistics_TotalPctCPUPeak60Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersAverage1Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersPeak1Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersAverage5Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersPeak5Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersAverage15Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersPeak15Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersAverage60Min_prop,
+    &Apache_HTTPDServerStatistics_BusyWorkersPeak60Min_prop,
+    &Apache_HTTPDServerStatistics_ResidentMemoryKB_prop,
+    &Apache_HTTPDServerStatistics_ChildProcesses_prop,
+    &Apache_HTTPDServerStatistics_AverageChildResidentMemoryKB_prop,
+    &Apache_HTTPDServerStatistics_AverageChildPctCPU_prop,
 };
 
 /* parameter Apache_HTTPDServerStatistics.ResetSelectedStats(): SelectedStatistics */
@@ -2769,13 +3131,13 @@ MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostCertificate_rtti =
 /*
 **==============================================================================
 **
-** Apache_HTTPDVirtualHostStatistics
+** Apache_HTTPDVirtualHostResponseStatistics
 **
 **==============================================================================
 */
 
-/* property Apache_HTTPDVirtualHostStatistics.ServerName */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ServerName_prop =
+/* property Apache_HTTPDVirtualHostResponseStatistics.ServerName */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ServerName_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
     0x0073650A, /* code */
@@ -2785,160 +3147,1396 @@ static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ServerName_pro
     MI_STRING, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, ServerName), /* offset */
-    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
-    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ServerName), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.RequestsTotal */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsTotal_prop =
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount1xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount1xx_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00726C0D, /* code */
-    MI_T("RequestsTotal"), /* name */
+    0x00727810, /* code */
+    MI_T("ResponseCount1xx"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT64, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsTotal), /* offset */
-    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
-    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount1xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.RequestsTotalBytes */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsTotalBytes_prop =
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount2xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount2xx_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00727312, /* code */
+    0x00727810, /* code */
+    MI_T("ResponseCount2xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount2xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount3xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount3xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727810, /* code */
+    MI_T("ResponseCount3xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount3xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount4xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount4xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727810, /* code */
+    MI_T("ResponseCount4xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount4xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount5xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount5xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727810, /* code */
+    MI_T("ResponseCount5xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount5xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount404 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount404_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723410, /* code */
+    MI_T("ResponseCount404"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount404), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount429 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount429_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723910, /* code */
+    MI_T("ResponseCount429"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount429), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount499 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount499_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723910, /* code */
+    MI_T("ResponseCount499"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount499), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount502 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount502_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723210, /* code */
+    MI_T("ResponseCount502"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount502), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount503 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount503_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723310, /* code */
+    MI_T("ResponseCount503"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount503), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponseCount504 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponseCount504_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723410, /* code */
+    MI_T("ResponseCount504"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponseCount504), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.AbortedCount */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_AbortedCount_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0061740C, /* code */
+    MI_T("AbortedCount"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, AbortedCount), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute1xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute1xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727815, /* code */
+    MI_T("ResponsesPerMinute1xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute1xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute2xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute2xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727815, /* code */
+    MI_T("ResponsesPerMinute2xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute2xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute3xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute3xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727815, /* code */
+    MI_T("ResponsesPerMinute3xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute3xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute4xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute4xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727815, /* code */
+    MI_T("ResponsesPerMinute4xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute4xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute5xx */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute5xx_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727815, /* code */
+    MI_T("ResponsesPerMinute5xx"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute5xx), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute404 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute404_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723415, /* code */
+    MI_T("ResponsesPerMinute404"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute404), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute429 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute429_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723915, /* code */
+    MI_T("ResponsesPerMinute429"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute429), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute499 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute499_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723915, /* code */
+    MI_T("ResponsesPerMinute499"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute499), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute502 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute502_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723215, /* code */
+    MI_T("ResponsesPerMinute502"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute502), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute503 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute503_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723315, /* code */
+    MI_T("ResponsesPerMinute503"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute503), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.ResponsesPerMinute504 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute504_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723415, /* code */
+    MI_T("ResponsesPerMinute504"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, ResponsesPerMinute504), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostResponseStatistics.AbortedPerMinute */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostResponseStatistics_AbortedPerMinute_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00616510, /* code */
+    MI_T("AbortedPerMinute"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics, AbortedPerMinute), /* offset */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* propagator */
+    NULL,
+};
+
+static MI_PropertyDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostResponseStatistics_props[] =
+{
+    &CIM_StatisticalData_InstanceID_prop,
+    &CIM_ManagedElement_Caption_prop,
+    &CIM_ManagedElement_Description_prop,
+    &CIM_StatisticalData_ElementName_prop,
+    &CIM_StatisticalData_StartStatisticTime_prop,
+    &CIM_StatisticalData_StatisticTime_prop,
+    &CIM_StatisticalData_SampleInterval_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ServerName_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount1xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount2xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount3xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount4xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount5xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount404_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount429_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount499_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount502_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount503_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponseCount504_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_AbortedCount_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute1xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute2xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute3xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute4xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute5xx_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute404_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute429_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute499_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute502_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute503_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResponsesPerMinute504_prop,
+    &Apache_HTTPDVirtualHostResponseStatistics_AbortedPerMinute_prop,
+};
+
+/* parameter Apache_HTTPDVirtualHostResponseStatistics.ResetSelectedStats(): SelectedStatistics */
+static MI_CONST MI_ParameterDecl Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_SelectedStatistics_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00737312, /* code */
+    MI_T("SelectedStatistics"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats, SelectedStatistics), /* offset */
+};
+
+/* parameter Apache_HTTPDVirtualHostResponseStatistics.ResetSelectedStats(): MIReturn */
+static MI_CONST MI_ParameterDecl Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_params[] =
+{
+    &Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_MIReturn_param,
+    &Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_SelectedStatistics_param,
+};
+
+/* method Apache_HTTPDVirtualHostResponseStatistics.ResetSelectedStats() */
+MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti =
+{
+    MI_FLAG_METHOD, /* flags */
+    0x00727312, /* code */
+    MI_T("ResetSelectedStats"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_params, /* parameters */
+    MI_COUNT(Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_params), /* numParameters */
+    sizeof(Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats), /* size */
+    MI_UINT32, /* returnType */
+    MI_T("CIM_StatisticalData"), /* origin */
+    MI_T("CIM_StatisticalData"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)Apache_HTTPDVirtualHostResponseStatistics_Invoke_ResetSelectedStats, /* method */
+};
+
+static MI_MethodDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostResponseStatistics_meths[] =
+{
+    &Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_rtti,
+};
+
+static MI_CONST MI_ProviderFT Apache_HTTPDVirtualHostResponseStatistics_funcs =
+{
+  (MI_ProviderFT_Load)Apache_HTTPDVirtualHostResponseStatistics_Load,
+  (MI_ProviderFT_Unload)Apache_HTTPDVirtualHostResponseStatistics_Unload,
+  (MI_ProviderFT_GetInstance)Apache_HTTPDVirtualHostResponseStatistics_GetInstance,
+  (MI_ProviderFT_EnumerateInstances)Apache_HTTPDVirtualHostResponseStatistics_EnumerateInstances,
+  (MI_ProviderFT_CreateInstance)Apache_HTTPDVirtualHostResponseStatistics_CreateInstance,
+  (MI_ProviderFT_ModifyInstance)Apache_HTTPDVirtualHostResponseStatistics_ModifyInstance,
+  (MI_ProviderFT_DeleteInstance)Apache_HTTPDVirtualHostResponseStatistics_DeleteInstance,
+  (MI_ProviderFT_AssociatorInstances)NULL,
+  (MI_ProviderFT_ReferenceInstances)NULL,
+  (MI_ProviderFT_EnableIndications)NULL,
+  (MI_ProviderFT_DisableIndications)NULL,
+  (MI_ProviderFT_Subscribe)NULL,
+  (MI_ProviderFT_Unsubscribe)NULL,
+  (MI_ProviderFT_Invoke)NULL,
+};
+
+static MI_CONST MI_Char* Apache_HTTPDVirtualHostResponseStatistics_UMLPackagePath_qual_value = MI_T("CIM::Core::Statistics");
+
+static MI_CONST MI_Qualifier Apache_HTTPDVirtualHostResponseStatistics_UMLPackagePath_qual =
+{
+    MI_T("UMLPackagePath"),
+    MI_STRING,
+    0,
+    &Apache_HTTPDVirtualHostResponseStatistics_UMLPackagePath_qual_value
+};
+
+static MI_CONST MI_Char* Apache_HTTPDVirtualHostResponseStatistics_Version_qual_value = MI_T("1.0.0");
+
+static MI_CONST MI_Qualifier Apache_HTTPDVirtualHostResponseStatistics_Version_qual =
+{
+    MI_T("Version"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TRANSLATABLE|MI_FLAG_RESTRICTED,
+    &Apache_HTTPDVirtualHostResponseStatistics_Version_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST Apache_HTTPDVirtualHostResponseStatistics_quals[] =
+{
+    &Apache_HTTPDVirtualHostResponseStatistics_UMLPackagePath_qual,
+    &Apache_HTTPDVirtualHostResponseStatistics_Version_qual,
+};
+
+/* class Apache_HTTPDVirtualHostResponseStatistics */
+MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostResponseStatistics_rtti =
+{
+    MI_FLAG_CLASS, /* flags */
+    0x00617329, /* code */
+    MI_T("Apache_HTTPDVirtualHostResponseStatistics"), /* name */
+    Apache_HTTPDVirtualHostResponseStatistics_quals, /* qualifiers */
+    MI_COUNT(Apache_HTTPDVirtualHostResponseStatistics_quals), /* numQualifiers */
+    Apache_HTTPDVirtualHostResponseStatistics_props, /* properties */
+    MI_COUNT(Apache_HTTPDVirtualHostResponseStatistics_props), /* numProperties */
+    sizeof(Apache_HTTPDVirtualHostResponseStatistics), /* size */
+    MI_T("CIM_StatisticalData"), /* superClass */
+    &CIM_StatisticalData_rtti, /* superClassDecl */
+    Apache_HTTPDVirtualHostResponseStatistics_meths, /* methods */
+    MI_COUNT(Apache_HTTPDVirtualHostResponseStatistics_meths), /* numMethods */
+    &schemaDecl, /* schema */
+    &Apache_HTTPDVirtualHostResponseStatistics_funcs, /* functions */
+    NULL, /* owningClass */
+};
+
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostStatistics
+**
+**==============================================================================
+*/
+
+/* property Apache_HTTPDVirtualHostStatistics.ServerName */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ServerName_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0073650A, /* code */
+    MI_T("ServerName"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ServerName), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsTotal */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsTotal_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726C0D, /* code */
+    MI_T("RequestsTotal"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsTotal), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsTotalBytes */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsTotalBytes_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727312, /* code */
     MI_T("RequestsTotalBytes"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
-    MI_UINT64, /* type */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsTotalBytes), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecond */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecond_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726411, /* code */
+    MI_T("RequestsPerSecond"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecond), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerRequest */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerRequest_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B740C, /* code */
+    MI_T("KBPerRequest"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerRequest), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecond */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecond_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B640B, /* code */
+    MI_T("KBPerSecond"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecond), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorCount400 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorCount400_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0065300D, /* code */
+    MI_T("ErrorCount400"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorCount400), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorCount500 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorCount500_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0065300D, /* code */
+    MI_T("ErrorCount500"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorCount500), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00653012, /* code */
+    MI_T("ErrorsPerMinute400"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00653012, /* code */
+    MI_T("ErrorsPerMinute500"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestLatencyP50 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestLatencyP50_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723011, /* code */
+    MI_T("RequestLatencyP50"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestLatencyP50), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestLatencyP95 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestLatencyP95_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723511, /* code */
+    MI_T("RequestLatencyP95"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestLatencyP95), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestLatencyP99 */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestLatencyP99_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00723911, /* code */
+    MI_T("RequestLatencyP99"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestLatencyP99), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestLatencyMax */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestLatencyMax_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727811, /* code */
+    MI_T("RequestLatencyMax"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestLatencyMax), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.UniqueClients */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_UniqueClients_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0075730D, /* code */
+    MI_T("UniqueClients"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, UniqueClients), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.UniqueClientsToday */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_UniqueClientsToday_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00757912, /* code */
+    MI_T("UniqueClientsToday"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, UniqueClientsToday), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondAverage1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1C, /* code */
+    MI_T("RequestsPerSecondAverage1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondAverage1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondPeak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E19, /* code */
+    MI_T("RequestsPerSecondPeak1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondPeak1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondAverage5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1C, /* code */
+    MI_T("RequestsPerSecondAverage5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondAverage5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondPeak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E19, /* code */
+    MI_T("RequestsPerSecondPeak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondPeak5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondAverage15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1D, /* code */
+    MI_T("RequestsPerSecondAverage15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondAverage15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondPeak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1A, /* code */
+    MI_T("RequestsPerSecondPeak15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondPeak15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondAverage60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1D, /* code */
+    MI_T("RequestsPerSecondAverage60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondAverage60Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecondPeak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00726E1A, /* code */
+    MI_T("RequestsPerSecondPeak60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecondPeak60Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondAverage1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E16, /* code */
+    MI_T("KBPerSecondAverage1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondAverage1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondPeak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E13, /* code */
+    MI_T("KBPerSecondPeak1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondPeak1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondAverage5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E16, /* code */
+    MI_T("KBPerSecondAverage5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondAverage5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondPeak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E13, /* code */
+    MI_T("KBPerSecondPeak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondPeak5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondAverage15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E17, /* code */
+    MI_T("KBPerSecondAverage15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondAverage15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondPeak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E14, /* code */
+    MI_T("KBPerSecondPeak15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondPeak15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondAverage60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E17, /* code */
+    MI_T("KBPerSecondAverage60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondAverage60Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.KBPerSecondPeak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x006B6E14, /* code */
+    MI_T("KBPerSecondPeak60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecondPeak60Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Average1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1D, /* code */
+    MI_T("ErrorsPerMinute400Average1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Average1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Peak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak1Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1A, /* code */
+    MI_T("ErrorsPerMinute400Peak1Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Peak1Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Average5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1D, /* code */
+    MI_T("ErrorsPerMinute400Average5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Average5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Peak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1A, /* code */
+    MI_T("ErrorsPerMinute400Peak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsTotalBytes), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Peak5Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.RequestsPerSecond */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_RequestsPerSecond_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Average15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average15Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00726411, /* code */
-    MI_T("RequestsPerSecond"), /* name */
+    0x00656E1E, /* code */
+    MI_T("ErrorsPerMinute400Average15Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, RequestsPerSecond), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Average15Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.KBPerRequest */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerRequest_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Peak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak15Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x006B740C, /* code */
-    MI_T("KBPerRequest"), /* name */
+    0x00656E1B, /* code */
+    MI_T("ErrorsPerMinute400Peak15Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerRequest), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Peak15Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.KBPerSecond */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_KBPerSecond_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Average60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average60Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x006B640B, /* code */
-    MI_T("KBPerSecond"), /* name */
+    0x00656E1E, /* code */
+    MI_T("ErrorsPerMinute400Average60Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, KBPerSecond), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Average60Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.ErrorCount400 */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorCount400_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400Peak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak60Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x0065300D, /* code */
-    MI_T("ErrorCount400"), /* name */
+    0x00656E1B, /* code */
+    MI_T("ErrorsPerMinute400Peak60Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
-    MI_UINT64, /* type */
+    MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorCount400), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400Peak60Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.ErrorCount500 */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorCount500_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Average1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average1Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x0065300D, /* code */
-    MI_T("ErrorCount500"), /* name */
+    0x00656E1D, /* code */
+    MI_T("ErrorsPerMinute500Average1Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
-    MI_UINT64, /* type */
+    MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorCount500), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Average1Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute400 */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Peak1Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak1Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00653012, /* code */
-    MI_T("ErrorsPerMinute400"), /* name */
+    0x00656E1A, /* code */
+    MI_T("ErrorsPerMinute500Peak1Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute400), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Peak1Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
 };
 
-/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500 */
-static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500_prop =
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Average5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average5Min_prop =
 {
     MI_FLAG_PROPERTY, /* flags */
-    0x00653012, /* code */
-    MI_T("ErrorsPerMinute500"), /* name */
+    0x00656E1D, /* code */
+    MI_T("ErrorsPerMinute500Average5Min"), /* name */
     NULL, /* qualifiers */
     0, /* numQualifiers */
     MI_UINT32, /* type */
     NULL, /* className */
     0, /* subscript */
-    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500), /* offset */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Average5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Peak5Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak5Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1A, /* code */
+    MI_T("ErrorsPerMinute500Peak5Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Peak5Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Average15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1E, /* code */
+    MI_T("ErrorsPerMinute500Average15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Average15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Peak15Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak15Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1B, /* code */
+    MI_T("ErrorsPerMinute500Peak15Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Peak15Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Average60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1E, /* code */
+    MI_T("ErrorsPerMinute500Average60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Average60Min), /* offset */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostStatistics.ErrorsPerMinute500Peak60Min */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak60Min_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00656E1B, /* code */
+    MI_T("ErrorsPerMinute500Peak60Min"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostStatistics, ErrorsPerMinute500Peak60Min), /* offset */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* origin */
     MI_T("Apache_HTTPDVirtualHostStatistics"), /* propagator */
     NULL,
@@ -2963,6 +4561,44 @@ static MI_PropertyDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostStatistics_prop
     &Apache_HTTPDVirtualHostStatistics_ErrorCount500_prop,
     &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400_prop,
     &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestLatencyP50_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestLatencyP95_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestLatencyP99_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestLatencyMax_prop,
+    &Apache_HTTPDVirtualHostStatistics_UniqueClients_prop,
+    &Apache_HTTPDVirtualHostStatistics_UniqueClientsToday_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondAverage60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_RequestsPerSecondPeak60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondAverage60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_KBPerSecondPeak60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Average60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute400Peak60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak1Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak5Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak15Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Average60Min_prop,
+    &Apache_HTTPDVirtualHostStatistics_ErrorsPerMinute500Peak60Min_prop,
 };
 
 /* parameter Apache_HTTPDVirtualHostStatistics.ResetSelectedStats(): SelectedStatistics */
@@ -3086,6 +4722,254 @@ MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostStatistics_rtti =
     NULL, /* owningClass */
 };
 
+/*
+**==============================================================================
+**
+** Apache_HTTPDVirtualHostTopURL
+**
+**==============================================================================
+*/
+
+/* property Apache_HTTPDVirtualHostTopURL.ServerName */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_ServerName_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0073650A, /* code */
+    MI_T("ServerName"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, ServerName), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostTopURL.URL */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_URL_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00756C03, /* code */
+    MI_T("URL"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRING, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, URL), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostTopURL.Requests */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_Requests_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x00727308, /* code */
+    MI_T("Requests"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, Requests), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostTopURL.RequestsBytes */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_RequestsBytes_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0072730D, /* code */
+    MI_T("RequestsBytes"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT64, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, RequestsBytes), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostTopURL.RankByRequests */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_RankByRequests_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0072730E, /* code */
+    MI_T("RankByRequests"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, RankByRequests), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+/* property Apache_HTTPDVirtualHostTopURL.RankByBytes */
+static MI_CONST MI_PropertyDecl Apache_HTTPDVirtualHostTopURL_RankByBytes_prop =
+{
+    MI_FLAG_PROPERTY, /* flags */
+    0x0072730B, /* code */
+    MI_T("RankByBytes"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL, RankByBytes), /* offset */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* origin */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* propagator */
+    NULL,
+};
+
+static MI_PropertyDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostTopURL_props[] =
+{
+    &CIM_StatisticalData_InstanceID_prop,
+    &CIM_ManagedElement_Caption_prop,
+    &CIM_ManagedElement_Description_prop,
+    &CIM_StatisticalData_ElementName_prop,
+    &CIM_StatisticalData_StartStatisticTime_prop,
+    &CIM_StatisticalData_StatisticTime_prop,
+    &CIM_StatisticalData_SampleInterval_prop,
+    &Apache_HTTPDVirtualHostTopURL_ServerName_prop,
+    &Apache_HTTPDVirtualHostTopURL_URL_prop,
+    &Apache_HTTPDVirtualHostTopURL_Requests_prop,
+    &Apache_HTTPDVirtualHostTopURL_RequestsBytes_prop,
+    &Apache_HTTPDVirtualHostTopURL_RankByRequests_prop,
+    &Apache_HTTPDVirtualHostTopURL_RankByBytes_prop,
+};
+
+/* parameter Apache_HTTPDVirtualHostTopURL.ResetSelectedStats(): SelectedStatistics */
+static MI_CONST MI_ParameterDecl Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_SelectedStatistics_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_IN, /* flags */
+    0x00737312, /* code */
+    MI_T("SelectedStatistics"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_STRINGA, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL_ResetSelectedStats, SelectedStatistics), /* offset */
+};
+
+/* parameter Apache_HTTPDVirtualHostTopURL.ResetSelectedStats(): MIReturn */
+static MI_CONST MI_ParameterDecl Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_MIReturn_param =
+{
+    MI_FLAG_PARAMETER|MI_FLAG_OUT, /* flags */
+    0x006D6E08, /* code */
+    MI_T("MIReturn"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    MI_UINT32, /* type */
+    NULL, /* className */
+    0, /* subscript */
+    offsetof(Apache_HTTPDVirtualHostTopURL_ResetSelectedStats, MIReturn), /* offset */
+};
+
+static MI_ParameterDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_params[] =
+{
+    &Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_MIReturn_param,
+    &Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_SelectedStatistics_param,
+};
+
+/* method Apache_HTTPDVirtualHostTopURL.ResetSelectedStats() */
+MI_CONST MI_MethodDecl Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti =
+{
+    MI_FLAG_METHOD, /* flags */
+    0x00727312, /* code */
+    MI_T("ResetSelectedStats"), /* name */
+    NULL, /* qualifiers */
+    0, /* numQualifiers */
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_params, /* parameters */
+    MI_COUNT(Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_params), /* numParameters */
+    sizeof(Apache_HTTPDVirtualHostTopURL_ResetSelectedStats), /* size */
+    MI_UINT32, /* returnType */
+    MI_T("CIM_StatisticalData"), /* origin */
+    MI_T("CIM_StatisticalData"), /* propagator */
+    &schemaDecl, /* schema */
+    (MI_ProviderFT_Invoke)Apache_HTTPDVirtualHostTopURL_Invoke_ResetSelectedStats, /* method */
+};
+
+static MI_MethodDecl MI_CONST* MI_CONST Apache_HTTPDVirtualHostTopURL_meths[] =
+{
+    &Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_rtti,
+};
+
+static MI_CONST MI_ProviderFT Apache_HTTPDVirtualHostTopURL_funcs =
+{
+  (MI_ProviderFT_Load)Apache_HTTPDVirtualHostTopURL_Load,
+  (MI_ProviderFT_Unload)Apache_HTTPDVirtualHostTopURL_Unload,
+  (MI_ProviderFT_GetInstance)Apache_HTTPDVirtualHostTopURL_GetInstance,
+  (MI_ProviderFT_EnumerateInstances)Apache_HTTPDVirtualHostTopURL_EnumerateInstances,
+  (MI_ProviderFT_CreateInstance)Apache_HTTPDVirtualHostTopURL_CreateInstance,
+  (MI_ProviderFT_ModifyInstance)Apache_HTTPDVirtualHostTopURL_ModifyInstance,
+  (MI_ProviderFT_DeleteInstance)Apache_HTTPDVirtualHostTopURL_DeleteInstance,
+  (MI_ProviderFT_AssociatorInstances)NULL,
+  (MI_ProviderFT_ReferenceInstances)NULL,
+  (MI_ProviderFT_EnableIndications)NULL,
+  (MI_ProviderFT_DisableIndications)NULL,
+  (MI_ProviderFT_Subscribe)NULL,
+  (MI_ProviderFT_Unsubscribe)NULL,
+  (MI_ProviderFT_Invoke)NULL,
+};
+
+static MI_CONST MI_Char* Apache_HTTPDVirtualHostTopURL_UMLPackagePath_qual_value = MI_T("CIM::Core::Statistics");
+
+static MI_CONST MI_Qualifier Apache_HTTPDVirtualHostTopURL_UMLPackagePath_qual =
+{
+    MI_T("UMLPackagePath"),
+    MI_STRING,
+    0,
+    &Apache_HTTPDVirtualHostTopURL_UMLPackagePath_qual_value
+};
+
+static MI_CONST MI_Char* Apache_HTTPDVirtualHostTopURL_Version_qual_value = MI_T("1.0.0");
+
+static MI_CONST MI_Qualifier Apache_HTTPDVirtualHostTopURL_Version_qual =
+{
+    MI_T("Version"),
+    MI_STRING,
+    MI_FLAG_ENABLEOVERRIDE|MI_FLAG_TRANSLATABLE|MI_FLAG_RESTRICTED,
+    &Apache_HTTPDVirtualHostTopURL_Version_qual_value
+};
+
+static MI_Qualifier MI_CONST* MI_CONST Apache_HTTPDVirtualHostTopURL_quals[] =
+{
+    &Apache_HTTPDVirtualHostTopURL_UMLPackagePath_qual,
+    &Apache_HTTPDVirtualHostTopURL_Version_qual,
+};
+
+/* class Apache_HTTPDVirtualHostTopURL */
+MI_CONST MI_ClassDecl Apache_HTTPDVirtualHostTopURL_rtti =
+{
+    MI_FLAG_CLASS, /* flags */
+    0x00616C1D, /* code */
+    MI_T("Apache_HTTPDVirtualHostTopURL"), /* name */
+    Apache_HTTPDVirtualHostTopURL_quals, /* qualifiers */
+    MI_COUNT(Apache_HTTPDVirtualHostTopURL_quals), /* numQualifiers */
+    Apache_HTTPDVirtualHostTopURL_props, /* properties */
+    MI_COUNT(Apache_HTTPDVirtualHostTopURL_props), /* numProperties */
+    sizeof(Apache_HTTPDVirtualHostTopURL), /* size */
+    MI_T("CIM_StatisticalData"), /* superClass */
+    &CIM_StatisticalData_rtti, /* superClassDecl */
+    Apache_HTTPDVirtualHostTopURL_meths, /* methods */
+    MI_COUNT(Apache_HTTPDVirtualHostTopURL_meths), /* numMethods */
+    &schemaDecl, /* schema */
+    &Apache_HTTPDVirtualHostTopURL_funcs, /* functions */
+    NULL, /* owningClass */
+};
+
 /*
 **==============================================================================
 **
@@ -3109,7 +4993,9 @@ static MI_ClassDecl MI_CONST* MI_CONST classes[] =
     &Apache_HTTPDServerStatistics_rtti,
     &Apache_HTTPDVirtualHost_rtti,
     &Apache_HTTPDVirtualHostCertificate_rtti,
+    &Apache_HTTPDVirtualHostResponseStatistics_rtti,
     &Apache_HTTPDVirtualHostStatistics_rtti,
+    &Apache_HTTPDVirtualHostTopURL_rtti,
     &CIM_Collection_rtti,
     &CIM_InstalledProduct_rtti,
     &CIM_LogicalElement_rtti,
@@ -12,7 +12,9 @@
 #include "Apache_HTTPDServerStatistics_Class_Provider.h"
 #include "Apache_HTTPDVirtualHost_Class_Provider.h"
 #include "Apache_HTTPDVirtualHostCertificate_Class_Provider.h"
+#include "Apache_HTTPDVirtualHostResponseStatistics_Class_Provider.h"
 #include "Apache_HTTPDVirtualHostStatistics_Class_Provider.h"
+#include "Apache_HTTPDVirtualHostTopURL_Class_Provider.h"
 
 using namespace mi;
 
@@ -509,6 +511,141 @@ MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostCertificate_DeleteInstance(
     cxxSelf->DeleteInstance(cxxContext, nameSpace, cxxInstanceName);
 }
 
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Load(
+    Apache_HTTPDVirtualHostResponseStatistics_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* prov = new Apache_HTTPDVirtualHostResponseStatistics_Class_Provider((Module*)selfModule);
+
+    prov->Load(ctx);
+    if (MI_RESULT_OK != r)
+    {
+        delete prov;
+        MI_PostResult(context, r);
+        return;
+    }
+    *self = (Apache_HTTPDVirtualHostResponseStatistics_Self*)prov;
+    MI_PostResult(context, MI_RESULT_OK);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Unload(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* prov = (Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self;
+
+    prov->Unload(ctx);
+    delete ((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    MI_PostResult(context, r);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_EnumerateInstances(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Context  cxxContext(context);
+
+    cxxSelf->EnumerateInstances(
+        cxxContext,
+        nameSpace,
+        __PropertySet(propertySet),
+        __bool(keysOnly),
+        filter);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_GetInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName,
+    const MI_PropertySet* propertySet)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostResponseStatistics_Class cxxInstanceName(instanceName, true);
+
+    cxxSelf->GetInstance(
+        cxxContext,
+        nameSpace,
+        cxxInstanceName,
+        __PropertySet(propertySet));
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_CreateInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* newInstance)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostResponseStatistics_Class cxxNewInstance(newInstance, false);
+
+    cxxSelf->CreateInstance(cxxContext, nameSpace, cxxNewInstance);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_ModifyInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* modifiedInstance,
+    const MI_PropertySet* propertySet)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostResponseStatistics_Class cxxModifiedInstance(modifiedInstance, false);
+
+    cxxSelf->ModifyInstance(
+        cxxContext,
+        nameSpace,
+        cxxModifiedInstance,
+        __PropertySet(propertySet));
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_DeleteInstance(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostResponseStatistics_Class cxxInstanceName(instanceName, true);
+
+    cxxSelf->DeleteInstance(cxxContext, nameSpace, cxxInstanceName);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostResponseStatistics_Invoke_ResetSelectedStats(
+    Apache_HTTPDVirtualHostResponseStatistics_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const Apache_HTTPDVirtualHostResponseStatistics* instanceName,
+    const Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats* in)
+{
+    Apache_HTTPDVirtualHostResponseStatistics_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostResponseStatistics_Class_Provider*)self);
+    Apache_HTTPDVirtualHostResponseStatistics_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostResponseStatistics_ResetSelectedStats_Class param(in, false);
+
+    cxxSelf->Invoke_ResetSelectedStats(cxxContext, nameSpace, instance, param);
+}
 MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Load(
     Apache_HTTPDVirtualHostStatistics_Self** self,
     MI_Module_Self* selfModule,
@@ -645,6 +782,142 @@ MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostStatistics_Invoke_ResetSelectedS
     cxxSelf->Invoke_ResetSelectedStats(cxxContext, nameSpace, instance, param);
 }
 
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Load(
+    Apache_HTTPDVirtualHostTopURL_Self** self,
+    MI_Module_Self* selfModule,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* prov = new Apache_HTTPDVirtualHostTopURL_Class_Provider((Module*)selfModule);
+
+    prov->Load(ctx);
+    if (MI_RESULT_OK != r)
+    {
+        delete prov;
+        MI_PostResult(context, r);
+        return;
+    }
+    *self = (Apache_HTTPDVirtualHostTopURL_Self*)prov;
+    MI_PostResult(context, MI_RESULT_OK);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Unload(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context)
+{
+    MI_Result r = MI_RESULT_OK;
+    Context ctx(context, &r);
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* prov = (Apache_HTTPDVirtualHostTopURL_Class_Provider*)self;
+
+    prov->Unload(ctx);
+    delete ((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    MI_PostResult(context, r);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_EnumerateInstances(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_PropertySet* propertySet,
+    MI_Boolean keysOnly,
+    const MI_Filter* filter)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Context  cxxContext(context);
+
+    cxxSelf->EnumerateInstances(
+        cxxContext,
+        nameSpace,
+        __PropertySet(propertySet),
+        __bool(keysOnly),
+        filter);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_GetInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* instanceName,
+    const MI_PropertySet* propertySet)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostTopURL_Class cxxInstanceName(instanceName, true);
+
+    cxxSelf->GetInstance(
+        cxxContext,
+        nameSpace,
+        cxxInstanceName,
+        __PropertySet(propertySet));
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_CreateInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* newInstance)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostTopURL_Class cxxNewInstance(newInstance, false);
+
+    cxxSelf->CreateInstance(cxxContext, nameSpace, cxxNewInstance);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_ModifyInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* modifiedInstance,
+    const MI_PropertySet* propertySet)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostTopURL_Class cxxModifiedInstance(modifiedInstance, false);
+
+    cxxSelf->ModifyInstance(
+        cxxContext,
+        nameSpace,
+        cxxModifiedInstance,
+        __PropertySet(propertySet));
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_DeleteInstance(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const Apache_HTTPDVirtualHostTopURL* instanceName)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostTopURL_Class cxxInstanceName(instanceName, true);
+
+    cxxSelf->DeleteInstance(cxxContext, nameSpace, cxxInstanceName);
+}
+
+MI_EXTERN_C void MI_CALL Apache_HTTPDVirtualHostTopURL_Invoke_ResetSelectedStats(
+    Apache_HTTPDVirtualHostTopURL_Self* self,
+    MI_Context* context,
+    const MI_Char* nameSpace,
+    const MI_Char* className,
+    const MI_Char* methodName,
+    const Apache_HTTPDVirtualHostTopURL* instanceName,
+    const Apache_HTTPDVirtualHostTopURL_ResetSelectedStats* in)
+{
+    Apache_HTTPDVirtualHostTopURL_Class_Provider* cxxSelf =((Apache_HTTPDVirtualHostTopURL_Class_Provider*)self);
+    Apache_HTTPDVirtualHostTopURL_Class instance(instanceName, false);
+    Context  cxxContext(context);
+    Apache_HTTPDVirtualHostTopURL_ResetSelectedStats_Class param(in, false);
+
+    cxxSelf->Invoke_ResetSelectedStats(cxxContext, nameSpace, instance, param);
+}
+
 
 MI_EXTERN_C MI_SchemaDecl schemaDecl;
 
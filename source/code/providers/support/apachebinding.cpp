@@ -33,12 +33,18 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include <apr_file_info.h>
 #include <apr_strings.h>
+#include <apr_thread_proc.h>
+#include <time.h>
+#include <sys/stat.h>
 
 #include "apachebinding.h"
 #include "datasampler.h"
 #include "utils.h"
 
+#include <algorithm>
+
 // Define single global copy (intended as a singleton class)
 ApacheFactory* g_pFactory = NULL;
 
@@ -291,7 +297,7 @@ apr_status_t ApacheInitDependencies::ValidateSharedMemory(ApacheDataCollector& d
     {
     public:
         DisplayInvalid() : m_isValid(false)
-            { DisplayError(0, "ValidateSharedMemory: Checking region ..."); }
+            { DisplayMessage(ProviderLogger::LevelDebug, "ValidateSharedMemory: Checking region ..."); }
         ~DisplayInvalid()
             { if (!m_isValid) DisplayError(0, "ValidateSharedMemory: Apache server appears dead!"); }
         void MarkValid() { m_isValid = true; }
@@ -410,7 +416,10 @@ apr_status_t ApacheDataCollectorDependencies::Attach(
     // Save the pool that we used for the attach (used for destruction)
     m_apr_attach_pool = pool;
 
-    DisplayError(0, apr_psprintf(pool, "ApacheDataCollectorDependencies::Attach (%s): Attaching", text));
+    if (IsLogging(ProviderLogger::LevelDebug))
+    {
+        DisplayMessage(ProviderLogger::LevelDebug, apr_psprintf(pool, "ApacheDataCollectorDependencies::Attach (%s): Attaching", text));
+    }
 
     // Initialize the mutex that we need
     if (APR_SUCCESS != (status = InitializeMutex()))
@@ -434,7 +443,10 @@ apr_status_t ApacheDataCollectorDependencies::Detach(const char *text)
 {
     apr_status_t statusMap, statusMutex;
 
-    DisplayError(0, apr_psprintf(m_apr_attach_pool, "ApacheDataCollector::Detach (%s): Detaching", text));
+    if (IsLogging(ProviderLogger::LevelDebug))
+    {
+        DisplayMessage(ProviderLogger::LevelDebug, apr_psprintf(m_apr_attach_pool, "ApacheDataCollector::Detach (%s): Detaching", text));
+    }
 
     // Unmap the shared memory region and clean up resources
     if (APR_SUCCESS != (statusMap = UnloadMemoryMap()))
@@ -482,17 +494,73 @@ apr_status_t ApacheDataCollectorDependencies::LoadMemoryMap(
     mmap_string_table** p_str)
 {
     apr_status_t status;
+    apr_uint32_t generation = 0;
+
+    // Find the current region through the control block (Apache builds each
+    // region under a name of its own, and publishes it here once it's complete);
+    // it stays attached so we can tell when the region is replaced
+    if (APR_SUCCESS != (status = apr_shm_attach(&m_control_region, PROVIDER_MMAP_NAME, m_apr_attach_pool)))
+    {
+        return status;
+    }
+
+    mmap_control_block* control = reinterpret_cast<mmap_control_block*> (apr_shm_baseaddr_get(m_control_region));
+    if (apr_shm_size_get(m_control_region) >= sizeof(mmap_control_block) && MMAP_CONTROL_MAGIC == control->magic)
+    {
+        generation = apr_atomic_read32(&control->generation);
+    }
+
+    if (0 == generation)
+    {
+        DisplayError(0, "ApacheDataCollectorDependencies::LoadMemoryMap: no shared memory region published yet");
+        UnloadMemoryMap();
+        return APR_EAGAIN;
+    }
 
     // Attach to the memory mapped file
-    if (APR_SUCCESS != (status = apr_shm_attach(&m_mmap_region, PROVIDER_MMAP_NAME, m_apr_attach_pool)))
+    const char *regionName = apr_psprintf(m_apr_attach_pool, MMAP_REGION_NAME_FORMAT, generation);
+    if (APR_SUCCESS != (status = apr_shm_attach(&m_mmap_region, regionName, m_apr_attach_pool)))
     {
+        UnloadMemoryMap();
         return status;
     }
 
-    // Assign global pointers
+    // Note which file the region is, so we notice if Apache is stopped and started (which recreates it by the same name)
+    struct stat regionStat;
+    m_regionName = regionName;
+    m_fRegionIdentityKnown = (0 == stat(regionName, &regionStat));
+    if (m_fRegionIdentityKnown)
+    {
+        m_regionDevice = regionStat.st_dev;
+        m_regionInode = regionStat.st_ino;
+    }
+
+    // Verify that the region is completely built, and that we understand its layout
     mmap_server_data*      svr   = reinterpret_cast<mmap_server_data*> (apr_shm_baseaddr_get(m_mmap_region));
+    apr_size_t             size  = apr_shm_size_get(m_mmap_region);
+
+    if (size < sizeof(mmap_server_data) || MMAP_REGION_MAGIC != svr->header.magic || generation != svr->header.generation)
+    {
+        // Region was replaced after we read the control block (or it isn't ours); try again later
+        DisplayError(0, "ApacheDataCollectorDependencies::LoadMemoryMap: shared memory region is not yet valid");
+        UnloadMemoryMap();
+        return APR_EAGAIN;
+    }
+
+    if (MMAP_REGION_VERSION != svr->header.version || svr->header.regionSize > size
+        || svr->vhostAddressOffset > size || svr->vhostAliasOffset > size)
+    {
+        DisplayError(APR_EINVAL, apr_psprintf(m_apr_attach_pool,
+                     "ApacheDataCollectorDependencies::LoadMemoryMap: incompatible shared memory region "
+                     "(layout version %u, expected %u; size %" APR_SIZE_T_FMT ", mapped %" APR_SIZE_T_FMT ")",
+                     svr->header.version, MMAP_REGION_VERSION, svr->header.regionSize, size));
+        UnloadMemoryMap();
+        return APR_EINVAL;
+    }
+
+    // Assign global pointers
     mmap_vhost_data*       vhost = reinterpret_cast<mmap_vhost_data*> (svr->modules + svr->moduleCount);
-    mmap_certificate_data* cert  = reinterpret_cast<mmap_certificate_data*> (vhost->vhosts + vhost->count);
+    mmap_certificate_data* cert  = reinterpret_cast<mmap_certificate_data*> (MMAP_VHOST_STATISTICS(vhost) + vhost->count);
     mmap_string_table*     str   = reinterpret_cast<mmap_string_table*> (cert->certificates + cert->count);
 
     // Return pointers to the caller
@@ -506,58 +574,281 @@ apr_status_t ApacheDataCollectorDependencies::LoadMemoryMap(
 
 apr_status_t ApacheDataCollectorDependencies::UnloadMemoryMap()
 {
+    apr_status_t status = APR_SUCCESS;
+
+    if (NULL != m_control_region)
+    {
+        apr_shm_detach(m_control_region);
+        m_control_region = NULL;
+    }
+
     if (NULL != m_mmap_region)
     {
-        apr_status_t status = apr_shm_detach(m_mmap_region);
+        status = apr_shm_detach(m_mmap_region);
         m_mmap_region = NULL;
+    }
+
+    return status;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Determine if the region we're attached to is still the one Apache is using.
+
+    Apache publishes each region it builds in the control block; comparing
+    generations only reads memory.  When Apache is stopped and started, both
+    are created anew (by the same names), so that's noticed by checking the
+    region's file, which costs a system call.
+
+    \param      generation              Generation of the region we're attached to
+    \param      checkFile               true to check the region's file as well
+
+    \returns    true if the region is current
+*/
+
+bool ApacheDataCollectorDependencies::IsRegionCurrent(apr_uint32_t generation, bool checkFile)
+{
+    if (NULL == m_control_region)
+    {
+        return false;
+    }
+
+    mmap_control_block* control = reinterpret_cast<mmap_control_block*> (apr_shm_baseaddr_get(m_control_region));
+    if (MMAP_CONTROL_MAGIC != control->magic || apr_atomic_read32(&control->generation) != generation)
+    {
+        return false;
+    }
+
+    if (checkFile && m_fRegionIdentityKnown)
+    {
+        struct stat regionStat;
+
+        if (0 != stat(m_regionName.c_str(), &regionStat)
+            || regionStat.st_dev != m_regionDevice || regionStat.st_ino != m_regionInode)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+
+// How often an attachment's region file is verified (see IsRegionCurrent)
+const apr_interval_time_t ApacheRegionAttachment::s_verifyInterval = APR_USEC_PER_SEC;
+
+ApacheRegionAttachment::~ApacheRegionAttachment()
+{
+    // Deleting the dependencies detaches from the region
+    delete m_pDeps;
+    apr_pool_destroy(m_apr_pool);
+}
+
+apr_status_t ApacheRegionAttachment::Attach(const char *text)
+{
+    apr_status_t status = m_pDeps->Attach(text, m_apr_pool, &m_server_data, &m_vhost_data, &m_certificate_data, &m_string_data);
+
+    m_verifyTime = apr_time_now();
+    return status;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Determine if the region is still the one Apache is using: it's not been
+    retired (Apache retires a region by leaving its sequence lock odd), and
+    it's still the one Apache published.  Must be called with the attachment
+    manager's mutex held.
+
+    \param      now                     Current time
+
+    \returns    true if the region is current
+*/
 
+bool ApacheRegionAttachment::IsCurrent(apr_time_t now)
+{
+    if (NULL == m_server_data)
+    {
+        return false;
+    }
+
+    const mmap_region_header& header = m_server_data->header;
+    if ((header.sequence & 1) || MMAP_REGION_MAGIC != header.magic)
+    {
+        return false;
+    }
+
+    bool checkFile = (now - m_verifyTime >= s_verifyInterval || now < m_verifyTime);
+    if (! m_pDeps->IsRegionCurrent(header.generation, checkFile))
+    {
+        return false;
+    }
+
+    if (checkFile)
+    {
+        m_verifyTime = now;
+    }
+
+    return true;
+}
+
+
+
+apr_status_t ApacheAttachmentManager::Initialize(apr_pool_t* parent)
+{
+    apr_status_t status;
+
+    if (NULL != m_apr_pool)
+    {
+        return APR_SUCCESS;
+    }
+
+    if (APR_SUCCESS != (status = apr_pool_create(&m_apr_pool, parent)))
+    {
+        DisplayError(status, "ApacheAttachmentManager::Initialize: Failed to create memory pool");
+        m_apr_pool = NULL;
+        return status;
+    }
+
+    if (APR_SUCCESS != (status = apr_thread_mutex_create(&m_mutex, APR_THREAD_MUTEX_UNNESTED, m_apr_pool)))
+    {
+        DisplayError(status, "ApacheAttachmentManager::Initialize: Failed to create mutex");
+        apr_pool_destroy(m_apr_pool);
+        m_apr_pool = NULL;
+        m_mutex = NULL;
         return status;
     }
 
     return APR_SUCCESS;
 }
 
+// Drop the attachment to the current region (the provider is being unloaded)
+void ApacheAttachmentManager::Shutdown()
+{
+    if (NULL == m_apr_pool)
+    {
+        return;
+    }
+
+    if (NULL != m_current)
+    {
+        ReleaseLocked(m_current);
+        m_current = NULL;
+    }
+
+    apr_pool_destroy(m_apr_pool);
+    m_apr_pool = NULL;
+    m_mutex = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Get a reference to the attachment to the current region, mapping the
+    region if we aren't attached to it (or Apache has replaced it since).
+    The reference must be released with Release().
 
+    \param      text                    Caller (for logging)
+    \param      attachment              Attachment to the current region
 
-void ApacheInitialization::DisplayError(apr_status_t status, const char *text)
+    \returns    APR_SUCCESS if attached
+*/
+
+apr_status_t ApacheAttachmentManager::Acquire(const char *text, ApacheRegionAttachment** attachment)
 {
-    char dateStr[APR_CTIME_LEN];
-    apr_ctime(dateStr, apr_time_now());
+    apr_status_t status;
 
-    /* APR_OS_START_USERERR used for OMI errors; anything below is APR error */
+    *attachment = NULL;
+    if (NULL == m_mutex)
+    {
+        return APR_EINIT;
+    }
 
-    if (0 == status)
+    if (APR_SUCCESS != (status = apr_thread_mutex_lock(m_mutex)))
     {
-        if ( m_pDeps->AllowStatusOutput() )
+        return status;
+    }
+
+    // Stop handing out the attachment once Apache has replaced the region (those using it may finish)
+    if (NULL != m_current && ! m_current->IsCurrent(apr_time_now()))
+    {
+        char buffer[256];
+        apr_snprintf(buffer, sizeof(buffer), "ApacheAttachmentManager::Acquire (%s): shared memory region was replaced", text);
+        DisplayError(0, buffer);
+        ReleaseLocked(m_current);
+        m_current = NULL;
+    }
+
+    if (NULL == m_current)
+    {
+        apr_pool_t *pool;
+
+        if (APR_SUCCESS != (status = apr_pool_create(&pool, m_apr_pool)))
+        {
+            apr_thread_mutex_unlock(m_mutex);
+            return status;
+        }
+
+        ApacheRegionAttachment *current = new ApacheRegionAttachment(g_pFactory->DataCollectorDependenciesFactory(), pool);
+        if (APR_SUCCESS != (status = current->Attach(text)))
         {
-            fprintf(stderr, "[%s] %s\n",
-                    dateStr, (text != NULL ? text : "Unexpected error occurred"));
+            delete current;
+            apr_thread_mutex_unlock(m_mutex);
+            return status;
         }
+
+        // The manager holds a reference of its own to the current attachment
+        current->m_refCount = 1;
+        m_current = current;
     }
-    else if (status < APR_OS_START_USERERR)
+
+    m_current->m_refCount++;
+    *attachment = m_current;
+
+    apr_thread_mutex_unlock(m_mutex);
+    return APR_SUCCESS;
+}
+
+void ApacheAttachmentManager::Release(ApacheRegionAttachment* attachment)
+{
+    if (NULL == attachment || NULL == m_mutex)
     {
-        char buffer[256];
-        char *errString = apr_strerror(status, buffer, sizeof(buffer));
-        fprintf(stderr, "[%s] %s, status=%d (%s)\n",
-                dateStr, (text != NULL ? text : "Unexpected error occurred"),
-                status, (errString != NULL ? errString : "Unknown error text"));
+        return;
     }
-    else
+
+    apr_thread_mutex_lock(m_mutex);
+    ReleaseLocked(attachment);
+    apr_thread_mutex_unlock(m_mutex);
+}
+
+void ApacheAttachmentManager::ReleaseLocked(ApacheRegionAttachment* attachment)
+{
+    if (0 == --attachment->m_refCount)
     {
-        /* TODO: OMI 1.0.8 allows you to convert OMI errors;
-         * we should use that once we bind to OMI 1.0.8
-         * For now, just use APR (which will just give numeric error) */
+        delete attachment;
+    }
+}
 
-        char buffer[256];
-        char *errString = apr_strerror(status, buffer, sizeof(buffer));
-        fprintf(stderr, "[%s] %s, status=%d (%s)\n",
-                dateStr, (text != NULL ? text : "Unexpected error occurred"),
-                status, (errString != NULL ? errString : "Unknown error text"));
+
+
+void ApacheInitialization::DisplayError(apr_status_t status, const char *text)
+{
+    if (0 == status && ! m_pDeps->AllowStatusOutput())
+    {
+        return;
     }
 
-    fflush(stderr);
+    m_logger.Log(0 == status ? ProviderLogger::LevelInfo : ProviderLogger::LevelError,
+                 status, text, __builtin_return_address(0));
+}
 
-    return;
+void ApacheInitialization::DisplayMessage(ProviderLogger::Level level, const char *text, bool fRateLimit)
+{
+    if (ProviderLogger::LevelError != level && ! m_pDeps->AllowStatusOutput())
+    {
+        return;
+    }
+
+    m_logger.Log(level, 0, text, fRateLimit ? __builtin_return_address(0) : NULL);
 }
 
 apr_status_t ApacheInitialization::Load(const char *text)
@@ -581,7 +872,12 @@ int ApacheInitialization::Unload(const char *text)
     /* Only deal with memory map if we're not in test mode */
     if (0 == --m_loadCount)
     {
+        m_attachments.Shutdown();
+        m_pools.Shutdown();
+        FreeSnapshotBuffers();
+        m_logger.Stop();
         apr_pool_clear(m_apr_pool);
+        m_snapshotMutex = NULL;
 
         // Don't bother terminating the APR - makes unit tests easier,
         // and no real point if we're just going to exit the process anyway
@@ -624,6 +920,33 @@ apr_status_t ApacheInitialization::Initialize(const char *text)
         }
     }
 
+    // From here on, messages are written by the logger's own thread
+    if (APR_SUCCESS != (status = m_logger.Start(m_apr_pool)))
+    {
+        DisplayError(status, "ApacheInitialization::Initialize: Failed to start logging thread");
+        return status;
+    }
+
+    // Data collectors get their pools from a cache, and share one attachment to the shared memory region
+    if (APR_SUCCESS != (status = m_pools.Initialize(m_apr_pool)))
+    {
+        DisplayError(status, "ApacheInitialization::Initialize: Failed to create memory pool cache");
+        return status;
+    }
+
+    if (APR_SUCCESS != (status = m_attachments.Initialize(m_apr_pool)))
+    {
+        return status;
+    }
+
+    if (APR_SUCCESS != (status = apr_thread_mutex_create(&m_snapshotMutex, APR_THREAD_MUTEX_UNNESTED, m_apr_pool)))
+    {
+        DisplayError(status, "ApacheInitialization::Initialize: Failed to create snapshot buffer mutex");
+        m_snapshotMutex = NULL;
+        return status;
+    }
+    m_snapshotBuffers.reserve(MaxCachedSnapshotBuffers);
+
     // Launch the data collector
     if (APR_SUCCESS != (status = m_pDeps->LaunchDataCollector()))
     {
@@ -635,35 +958,120 @@ apr_status_t ApacheInitialization::Initialize(const char *text)
 
 
 
-ApacheDataCollector::ApacheDataCollector(ApacheDataCollectorDependencies* deps)
+/*----------------------------------------------------------------------------*/
+/**
+    Get a buffer for a snapshot of the virtual hosts, reusing one that was
+    returned if there is one.  Buffers only grow (with the number of virtual
+    hosts), so a reused buffer usually has room already.
+
+    \returns    Buffer (to be returned with PutSnapshotBuffer())
+*/
+
+ApacheSnapshotBuffer* ApacheInitialization::GetSnapshotBuffer()
+{
+    ApacheSnapshotBuffer *buffer = NULL;
+
+    if (NULL != m_snapshotMutex && APR_SUCCESS == apr_thread_mutex_lock(m_snapshotMutex))
+    {
+        if (! m_snapshotBuffers.empty())
+        {
+            buffer = m_snapshotBuffers.back();
+            m_snapshotBuffers.pop_back();
+        }
+        apr_thread_mutex_unlock(m_snapshotMutex);
+    }
+
+    return NULL != buffer ? buffer : new ApacheSnapshotBuffer;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Return a snapshot buffer (from GetSnapshotBuffer()).  It's kept for reuse
+    if there's room; otherwise (or if the provider isn't loaded) it's freed.
+
+    \param      buffer                  Buffer to return (may be NULL)
+*/
+
+void ApacheInitialization::PutSnapshotBuffer(ApacheSnapshotBuffer* buffer)
+{
+    if (NULL != buffer && NULL != m_snapshotMutex && APR_SUCCESS == apr_thread_mutex_lock(m_snapshotMutex))
+    {
+        if (m_snapshotBuffers.size() < MaxCachedSnapshotBuffers)
+        {
+            m_snapshotBuffers.push_back(buffer);
+            buffer = NULL;
+        }
+        apr_thread_mutex_unlock(m_snapshotMutex);
+    }
+
+    delete buffer;
+}
+
+void ApacheInitialization::FreeSnapshotBuffers()
+{
+    for (size_t i = 0; i < m_snapshotBuffers.size(); i++)
+    {
+        delete m_snapshotBuffers[i];
+    }
+    m_snapshotBuffers.clear();
+}
+
+
+
+ApacheDataCollector::ApacheDataCollector()
     : m_server_data(NULL), m_vhost_data(NULL),
       m_certificate_data(NULL), m_string_data(NULL),
-      m_pDeps(deps), m_apr_pool(NULL)
+      m_attachment(NULL), m_apr_pool(NULL), m_fOwnPool(false),
+      m_snapshotBuffer(NULL)
 {
-    apr_status_t status;
+    memset(&m_snapshot, 0, sizeof(m_snapshot));
 
-    if (APR_SUCCESS != (status = apr_pool_create(&m_apr_pool, g_pFactory->GetInit()->GetPool())))
+    // Use a recycled pool if we can (the cache isn't available until the provider is loaded)
+    if (NULL == (m_apr_pool = g_pFactory->GetInit()->GetPools().Get()))
     {
-        // TODO: Throw some kind of exception or something!
+        if (APR_SUCCESS != apr_pool_create(&m_apr_pool, NULL))
+        {
+            // TODO: Throw some kind of exception or something!
+            m_apr_pool = NULL;
+        }
+        m_fOwnPool = true;
     }
 }
 
 ApacheDataCollector::~ApacheDataCollector()
 {
     Detach("Destructor");
-    apr_pool_clear(m_apr_pool);
+    g_pFactory->GetInit()->PutSnapshotBuffer(m_snapshotBuffer);
+
+    if (m_fOwnPool)
+    {
+        if (NULL != m_apr_pool)
+        {
+            apr_pool_destroy(m_apr_pool);
+        }
+    }
+    else
+    {
+        g_pFactory->GetInit()->GetPools().Put(m_apr_pool);
+    }
 }
 
 apr_status_t ApacheDataCollector::Attach(const char *text)
 {
     apr_status_t status;
 
-    // Map to the shared memory region
-    if (APR_SUCCESS != (status = m_pDeps->Attach(text, m_apr_pool, &m_server_data, &m_vhost_data, &m_certificate_data, &m_string_data)))
+    // Use the provider's mapping of the shared memory region (mapping it if need be)
+    if (NULL == m_attachment
+        && APR_SUCCESS != (status = g_pFactory->GetInit()->GetAttachments().Acquire(text, &m_attachment)))
     {
         return status;
     }
 
+    m_server_data = m_attachment->m_server_data;
+    m_vhost_data = m_attachment->m_vhost_data;
+    m_certificate_data = m_attachment->m_certificate_data;
+    m_string_data = m_attachment->m_string_data;
+
     // We are mapped to a region; verify if it's actually valid
     //
     // Note: If it's not valid, then immediately validate again (since we are loaded)
@@ -686,14 +1094,22 @@ apr_status_t ApacheDataCollector::Attach(const char *text)
 
 apr_status_t ApacheDataCollector::Detach(const char *text)
 {
-    apr_status_t status = m_pDeps->Detach(text);
+    // The region stays mapped (for the next collector) unless Apache has replaced it
+    g_pFactory->GetInit()->GetAttachments().Release(m_attachment);
+    m_attachment = NULL;
 
     m_server_data = NULL;
     m_vhost_data = NULL;
     m_certificate_data = NULL;
     m_string_data = NULL;
 
-    return status;
+    return APR_SUCCESS;
+}
+
+apr_status_t ApacheDataCollector::Reattach(const char *text)
+{
+    Detach(text);
+    return Attach(text);
 }
 
 const char* ApacheDataCollector::GetDataString(apr_size_t offset)
@@ -706,6 +1122,656 @@ const char* ApacheDataCollector::GetDataString(apr_size_t offset)
     return m_string_data->data + offset;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+    Get the name and instance ID of a virtual host.  Dynamic hosts are named
+    (by Host header) in the dynamic host table; their name is their instance
+    ID, and is empty while the slot is free.
+
+    \param      item                    Index of the virtual host
+*/
+
+const char* ApacheDataCollector::GetVHostName(apr_size_t item)
+{
+    if (IsDynamicHost(item))
+    {
+        mmap_dynamic_host *host = GetDynamicHost(item);
+
+        // The name is always terminated (its last byte is only ever written as a terminator)
+        return apr_atomic_read32(&host->ready) ? host->name : "";
+    }
+
+    return GetDataString(m_vhost_data->vhosts[item].hostNameOffset);
+}
+
+const char* ApacheDataCollector::GetVHostInstanceID(apr_size_t item)
+{
+    if (IsDynamicHost(item))
+    {
+        return GetVHostName(item);
+    }
+
+    return GetDataString(m_vhost_data->vhosts[item].instanceIDOffset);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Determine if a virtual host should be enumerated (all hosts are, except
+    dynamic host slots that no name has claimed).
+
+    \param      item                    Index of the virtual host
+*/
+
+bool ApacheDataCollector::IsVHostActive(apr_size_t item)
+{
+    return ! IsDynamicHost(item) || apr_atomic_read32(&GetDynamicHost(item)->ready);
+}
+
+void ApacheDataCollector::GetVHostCounters(apr_size_t item, mmap_vhost_counters& counters)
+{
+    apr_size_t shardCount = GetCounterShardCount();
+    apr_size_t first = item, last = item;
+    apr_uint64_t requests = 0, bytes = 0, responses[MMAP_RESPONSE_COUNT] = { 0 };
+
+    // With multiple counter slabs, Apache doesn't count _Total; derive it from the other hosts
+    // (and the dynamic hosts evicted so far)
+    if (0 == item && shardCount > 1)
+    {
+        mmap_vhost_counters *evicted = GetEvictedCounters();
+
+        first = 1;
+        last = GetVHostCount() - 1;
+        requests = MMAP_ATOMIC_READ64(&evicted->requestsTotal);
+        bytes = MMAP_ATOMIC_READ64(&evicted->requestsBytes);
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            responses[r] = MMAP_ATOMIC_READ64(&evicted->responses[r]);
+        }
+    }
+
+    for (apr_size_t shard = 0; shard < shardCount; shard++)
+    {
+        mmap_vhost_counters *slab = GetCounterShard(shard);
+
+        for (apr_size_t i = first; i <= last; i++)
+        {
+            requests += MMAP_ATOMIC_READ64(&slab[i].requestsTotal);
+            bytes += MMAP_ATOMIC_READ64(&slab[i].requestsBytes);
+            for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+            {
+                responses[r] += MMAP_ATOMIC_READ64(&slab[i].responses[r]);
+            }
+        }
+    }
+
+    counters.requestsTotal = requests;
+    counters.requestsBytes = bytes;
+    for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+    {
+        counters.responses[r] = responses[r];
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Take a point-in-time copy of the counters and rates of the server and of
+    every virtual host.  The copy is made in one pass (each counter slab is
+    read once, in order) into a buffer that is reused by later calls, and, with
+    multiple counter slabs, _Total is derived from the copied virtual hosts so
+    that it always agrees with them.  Call it from within a ReadBegin() /
+    ReadRetry() loop, as the number of virtual hosts is configuration data.
+
+    \returns    The snapshot (owned by the collector)
+*/
+
+const ApacheSnapshot& ApacheDataCollector::Snapshot()
+{
+    apr_size_t count = GetVHostCount();
+    apr_size_t shardCount = GetCounterShardCount();
+
+    // The buffer comes from the provider, and goes back to it for later collectors (with
+    // room for the virtual hosts, so large configurations don't reallocate it each time)
+    if (NULL == m_snapshotBuffer)
+    {
+        m_snapshotBuffer = g_pFactory->GetInit()->GetSnapshotBuffer();
+    }
+    m_snapshotBuffer->resize(count);
+    m_snapshot.vhosts = count ? &(*m_snapshotBuffer)[0] : NULL;
+    m_snapshot.vhostCount = count;
+
+    ApacheServerSnapshot& server = m_snapshot.server;
+    server.idleWorkers = GetWorkerCountIdle();
+    server.busyWorkers = GetWorkerCountBusy();
+    server.percentCPU = GetCPUUtilization();
+    for (int w = 0; w < MMAP_RATE_WINDOWS; w++)
+    {
+        server.cpuAverage[w] = apr_atomic_read32(&m_server_data->cpuHistory.average[w]);
+        server.cpuPeak[w] = apr_atomic_read32(&m_server_data->cpuHistory.peak[w]);
+        server.busyWorkersAverage[w] = apr_atomic_read32(&m_server_data->busyWorkersHistory.average[w]);
+        server.busyWorkersPeak[w] = apr_atomic_read32(&m_server_data->busyWorkersHistory.peak[w]);
+    }
+    server.residentBytes = GetResidentMemory();
+    server.childResidentBytes = GetChildResidentMemory();
+    server.childProcesses = GetChildProcessCount();
+    server.childPercentCPU = GetChildCPUUtilization();
+
+    // Counters: sum the slabs, one slab at a time
+    ApacheVHostSnapshot *vhosts = m_snapshot.vhosts;
+    memset(vhosts, 0, count * sizeof(ApacheVHostSnapshot));
+    for (apr_size_t shard = 0; shard < shardCount; shard++)
+    {
+        mmap_vhost_counters *slab = GetCounterShard(shard);
+
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            vhosts[i].requestsTotal += MMAP_ATOMIC_READ64(&slab[i].requestsTotal);
+            vhosts[i].requestsBytes += MMAP_ATOMIC_READ64(&slab[i].requestsBytes);
+            for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+            {
+                vhosts[i].responses[r] += MMAP_ATOMIC_READ64(&slab[i].responses[r]);
+            }
+        }
+    }
+
+    // With multiple counter slabs, Apache doesn't count _Total; derive it from the other hosts
+    // (and the dynamic hosts evicted so far)
+    if (shardCount > 1 && count > 0)
+    {
+        ApacheVHostSnapshot& total = vhosts[0];
+        mmap_vhost_counters *evicted = GetEvictedCounters();
+
+        total.requestsTotal = MMAP_ATOMIC_READ64(&evicted->requestsTotal);
+        total.requestsBytes = MMAP_ATOMIC_READ64(&evicted->requestsBytes);
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            total.responses[r] = MMAP_ATOMIC_READ64(&evicted->responses[r]);
+        }
+        for (apr_size_t i = 1; i < count; i++)
+        {
+            total.requestsTotal += vhosts[i].requestsTotal;
+            total.requestsBytes += vhosts[i].requestsBytes;
+            for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+            {
+                total.responses[r] += vhosts[i].responses[r];
+            }
+        }
+    }
+
+    // Rates (computed by the data sampler)
+    mmap_vhost_statistics *stats = GetVHostStatistics();
+    for (apr_size_t i = 0; i < count; i++)
+    {
+        ApacheVHostSnapshot& vhost = vhosts[i];
+
+        vhost.active = IsVHostActive(i);
+        vhost.requestsPerSecond = apr_atomic_read32(&stats[i].requestsPerSecond);
+        vhost.kbPerRequest = apr_atomic_read32(&stats[i].kbPerRequest);
+        vhost.kbPerSecond = apr_atomic_read32(&stats[i].kbPerSecond);
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            vhost.responsesPerMinute[r] = apr_atomic_read32(&stats[i].responsesPerMinute[r]);
+        }
+        vhost.latencyP50 = apr_atomic_read32(&stats[i].latencyP50);
+        vhost.latencyP95 = apr_atomic_read32(&stats[i].latencyP95);
+        vhost.latencyP99 = apr_atomic_read32(&stats[i].latencyP99);
+        vhost.latencyMax = apr_atomic_read32(&stats[i].latencyMax);
+        vhost.uniqueClients = apr_atomic_read32(&stats[i].uniqueClients);
+        vhost.uniqueClientsToday = apr_atomic_read32(&stats[i].uniqueClientsToday);
+        for (int r = 0; r < MMAP_RATE_COUNT; r++)
+        {
+            for (int w = 0; w < MMAP_RATE_WINDOWS; w++)
+            {
+                vhost.rateAverage[r][w] = apr_atomic_read32(&stats[i].rateHistory[r].average[w]);
+                vhost.ratePeak[r][w] = apr_atomic_read32(&stats[i].rateHistory[r].peak[w]);
+            }
+        }
+    }
+
+    return m_snapshot;
+}
+
+void ApacheDataCollector::TakeVHostLatency(apr_size_t item, mmap_vhost_latency& latency)
+{
+    memset(&latency, 0, sizeof(latency));
+
+    // Histograms are per-interval: sum across the slabs, clearing as we go
+    // (only touch buckets that were used, to avoid dirtying idle cache lines)
+    for (apr_size_t shard = 0; shard < GetCounterShardCount(); shard++)
+    {
+        mmap_vhost_latency *slab = &GetLatencyShard(shard)[item];
+
+        for (apr_size_t b = 0; b < MMAP_LATENCY_BUCKETS; b++)
+        {
+            if (apr_atomic_read32(&slab->buckets[b]))
+            {
+                latency.buckets[b] += apr_atomic_xchg32(&slab->buckets[b], 0);
+            }
+        }
+
+        if (apr_atomic_read32(&slab->maxLatency))
+        {
+            latency.maxLatency = std::max(static_cast<apr_uint32_t>(latency.maxLatency),
+                                          apr_atomic_xchg32(&slab->maxLatency, 0));
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Collect the unique client registers of a virtual host for the interval,
+    and clear them for the next interval.
+
+    \param      item                    Index of the virtual host
+    \param      registers               Receives MMAP_HLL_REGISTERS registers
+*/
+
+void ApacheDataCollector::TakeVHostClients(apr_size_t item, unsigned char *registers)
+{
+    volatile unsigned char *interval = GetVHostClients(item)->interval;
+
+    // Only touch registers that were raised, to avoid dirtying idle cache lines
+    for (apr_size_t i = 0; i < MMAP_HLL_REGISTERS; i++)
+    {
+        registers[i] = interval[i] ? __sync_lock_test_and_set(&interval[i], 0) : 0;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Mark a dynamic host for eviction if it has been idle (the first of two
+    phases).  Apache no longer finds the name in the slot, nor claims the
+    slot, but a request that found the host just before may still count in
+    it; EvictDynamicHost resets the slot once such requests are done.
+
+    \param      item                    Index of the virtual host
+    \param      idleSince               Mark the host if it has seen no requests since this time (seconds)
+
+    \returns    true if the host was marked
+*/
+
+bool ApacheDataCollector::MarkDynamicHostEvicting(apr_size_t item, apr_uint32_t idleSince)
+{
+    mmap_dynamic_host *host = GetDynamicHost(item);
+    volatile apr_uint64_t *key = GetDynamicHostKey(item);
+    apr_uint64_t current = MMAP_ATOMIC_READ64(key);
+
+    if (0 == current || MMAP_DYNAMIC_HOST_EVICTING == current || apr_atomic_read32(&host->lastSeen) >= idleSince
+        || ! MMAP_ATOMIC_CAS64(key, current, MMAP_DYNAMIC_HOST_EVICTING))
+    {
+        return false;
+    }
+
+    apr_atomic_set32(&host->ready, 0);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Evict a dynamic host marked by MarkDynamicHostEvicting (the second phase),
+    resetting its counters and statistics for the next name to claim the
+    slot, and then freeing the slot.  Call this no sooner than a sampling
+    interval after marking the host, so requests that found it are counted.
+
+    \param      item                    Index of the virtual host
+*/
+
+void ApacheDataCollector::EvictDynamicHost(apr_size_t item)
+{
+    volatile apr_uint64_t *key = GetDynamicHostKey(item);
+
+    // Move the counters to the evicted counters, which the derived _Total (with multiple slabs) includes,
+    // so _Total never goes backwards for the data sampler (the only thread that evicts hosts)
+    mmap_vhost_statistics *stats = GetVHostStatistics();
+    mmap_vhost_counters *evicted = GetEvictedCounters();
+    for (apr_size_t shard = 0; shard < GetCounterShardCount(); shard++)
+    {
+        mmap_vhost_counters *slab = &GetCounterShard(shard)[item];
+
+        MMAP_ATOMIC_ADD64(&evicted->requestsTotal, MMAP_ATOMIC_XCHG64(&slab->requestsTotal, 0));
+        MMAP_ATOMIC_ADD64(&evicted->requestsBytes, MMAP_ATOMIC_XCHG64(&slab->requestsBytes, 0));
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            MMAP_ATOMIC_ADD64(&evicted->responses[r], MMAP_ATOMIC_XCHG64(&slab->responses[r], 0));
+        }
+    }
+
+    // Per-interval data starts over with the next interval anyway; daily data doesn't
+    mmap_vhost_latency latency;
+    std::vector<mmap_topurl_result> urls;
+    unsigned char registers[MMAP_HLL_REGISTERS];
+    TakeVHostLatency(item, latency);
+    TakeTopUrls(item, urls);
+    if (HasVHostClients())
+    {
+        TakeVHostClients(item, registers);
+        memset(GetVHostClients(item)->day, 0, MMAP_HLL_REGISTERS);
+    }
+
+    // Providers read statistics and top URLs within ReadBegin() / ReadRetry(), so they never see them half cleared
+    mmap_region_write_begin(&m_server_data->header);
+    if (m_server_data->topUrlSlots)
+    {
+        memset(MMAP_TOPURL_SLOTS(m_server_data, item), 0, sizeof(mmap_topurl_slot) * m_server_data->topUrlSlots);
+        memset(MMAP_TOPURL_RESULTS(m_server_data, item), 0, sizeof(mmap_topurl_result) * 2 * m_server_data->topUrlCount);
+    }
+    memset(&stats[item], 0, sizeof(mmap_vhost_statistics));
+    mmap_region_write_end(&m_server_data->header);
+
+    MMAP_MEMORY_BARRIER();
+    MMAP_ATOMIC_SET64(key, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Collect the URLs held in the heavy-hitter table of a virtual host, with
+    their requests over the interval, and halve their counts for the next.
+    Counts are halved rather than cleared so that a URL colliding with a busy
+    one can't take its slot over with a single request.
+
+    \param      item                    Index of the virtual host
+    \param      urls                    Receives the URLs counted in the interval
+                                        (rank fields are left zero)
+*/
+
+void ApacheDataCollector::TakeTopUrls(apr_size_t item, std::vector<mmap_topurl_result>& urls)
+{
+    mmap_topurl_slot *slots = MMAP_TOPURL_SLOTS(m_server_data, item);
+
+    urls.clear();
+    for (apr_size_t i = 0; i < m_server_data->topUrlSlots; i++)
+    {
+        mmap_topurl_slot *slot = &slots[i];
+        apr_uint64_t key, count, bytes = 0;
+        const apr_uint64_t fingerprintMask = ~static_cast<apr_uint64_t>(0xFFFFFFFF);
+
+        // Halve the count, keeping the fingerprint so the URL carries on counting in its slot
+        do
+        {
+            key = MMAP_ATOMIC_READ64(&slot->key);
+            count = key & 0xFFFFFFFF;
+        } while (count && ! MMAP_ATOMIC_CAS64(&slot->key, key, (key & fingerprintMask) | (count / 2)));
+
+        // Take the bytes (keeping their tag), if they were counted for the URL now in the slot
+        apr_uint64_t seen;
+        do
+        {
+            seen = MMAP_ATOMIC_READ64(&slot->bytes);
+        } while ((seen & MMAP_TOPURL_BYTES_MASK) && ! MMAP_ATOMIC_CAS64(&slot->bytes, seen, seen & ~MMAP_TOPURL_BYTES_MASK));
+
+        if ((seen & ~MMAP_TOPURL_BYTES_MASK) == MMAP_TOPURL_BYTES_TAG(key >> 32))
+        {
+            bytes = seen & MMAP_TOPURL_BYTES_MASK;
+        }
+
+        // Requests are the increase over what we left in the slot last time (if the URL still holds it)
+        apr_uint64_t carried = (slot->carried & fingerprintMask) == (key & fingerprintMask) ? slot->carried & 0xFFFFFFFF : 0;
+        slot->carried = (key & fingerprintMask) | (count / 2);
+
+        if (count <= carried)
+        {
+            continue;
+        }
+
+        mmap_topurl_result result;
+        memset(&result, 0, sizeof(result));
+        memcpy(result.url, slot->url, sizeof(result.url));
+        result.url[sizeof(result.url) - 1] = '\0';
+
+        // Skip the slot if another URL was taking it over while we copied
+        apr_size_t length;
+        if (mmap_topurl_hash(result.url, &length) != (key >> 32))
+        {
+            continue;
+        }
+
+        result.requests = count - carried;
+        result.bytes = bytes;
+        urls.push_back(result);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Read completed trace records written by Apache, starting at cursor.
+
+    Records that were overwritten before we got to them are skipped; reading
+    stops at a record that is still being written (it's read next time).
+
+    \param      ring                    Trace ring in the memory mapped region
+    \param      cursor                  Sequence number of next record to read;
+                                        updated to follow the records read
+    \param      records                 Array to receive the records
+    \param      max                     Number of elements in records
+
+    \returns    Number of records returned
+*/
+
+apr_size_t ApacheDataCollector::ReadTraceRecords(mmap_trace_ring *ring, apr_uint64_t& cursor,
+                                                 mmap_trace_record *records, apr_size_t max)
+{
+    apr_uint64_t head = MMAP_ATOMIC_READ64(&ring->head);
+    apr_size_t count = 0;
+
+    if (0 == ring->capacity)
+    {
+        return 0;
+    }
+
+    // If we fell further behind than the ring holds, skip what was overwritten
+    if (head - cursor > ring->capacity)
+    {
+        cursor = head - ring->capacity;
+    }
+
+    while (cursor != head && count < max)
+    {
+        mmap_trace_record *slot = &ring->records[cursor & (ring->capacity - 1)];
+        apr_uint64_t sequence = MMAP_ATOMIC_READ64(&slot->sequence);
+
+        if (sequence != cursor + 1)
+        {
+            // Not complete yet (still being written): pick it up next time
+            if (0 == sequence || sequence < cursor + 1)
+            {
+                break;
+            }
+
+            // Overwritten by a newer record
+            cursor++;
+            continue;
+        }
+
+        MMAP_MEMORY_BARRIER();
+        memcpy(&records[count], slot, sizeof(mmap_trace_record));
+        MMAP_MEMORY_BARRIER();
+
+        // Only keep the copy if the record wasn't overwritten while we copied it
+        if (MMAP_ATOMIC_READ64(&slot->sequence) == sequence)
+        {
+            count++;
+        }
+        cursor++;
+    }
+
+    return count;
+}
+
+static char s_monNames[12][4] =
+{
+    "Jan",
+    "Feb",
+    "Mar",
+    "Apr",
+    "May",
+    "Jun",
+    "Jul",
+    "Aug",
+    "Sep",
+    "Oct",
+    "Nov",
+    "Dec"
+};
+
+// Get an SSL certificate expiration date and days until it expires
+static int GetCertificateExpirationDate(
+    const char* file,
+    apr_pool_t* pool,
+    char* date,
+    apr_time_t* expirationAprTime)
+{
+    char dateString[64];
+    char buf[128];
+    char monName[8];
+    int year, month, day, hour, min, sec;
+    struct tm tmBuf;
+    apr_status_t status;
+    apr_proc_t proc;
+    apr_procattr_t *pattr;
+    apr_exit_why_e why;
+    int exitCode;
+    const char* args[] =
+    {
+        "/usr/bin/openssl",
+        "x509",
+        "-in",
+        file,
+        "-enddate",
+        NULL
+    };
+    char* const* argptr =  const_cast<char* const*>(args);
+
+    // Initialize the process attribute
+    status = apr_procattr_create(&pattr, pool);
+    if (status != APR_SUCCESS)
+    {
+        DisplayError(status, "GetCertificateExpirationDate: error creating openssl child process attributes");
+        return -1;
+    }
+
+    // Set up the pipe of stdout from the child to this process' proc.out
+    status = apr_procattr_io_set(pattr, APR_NO_PIPE, APR_FULL_BLOCK, APR_NO_PIPE);
+    if (status != APR_SUCCESS)
+    {
+        DisplayError(status, "GetCertificateExpirationDate: error setting openssl child process i/o attributes");
+        return -1;
+    }
+
+    // Make the openssl program be run using the PATH variable
+    status = apr_procattr_cmdtype_set(pattr, APR_PROGRAM_PATH);
+    if (status != APR_SUCCESS)
+    {
+        DisplayError(status, "GetCertificateExpirationDate: error setting openssl child process command type");
+        return -1;
+    }
+
+    // Run the openssl binary
+    status = apr_proc_create(&proc, "openssl", argptr, NULL, (apr_procattr_t*)pattr, pool);
+    if (status != APR_SUCCESS)
+    {
+        DisplayError(status, "GetCertificateExpirationDate: error creating openssl child process");
+        return -1;
+    }
+
+    // Read the first line from the child process stdout
+    status = apr_file_gets(dateString, sizeof(dateString), proc.out);
+    if (status != APR_SUCCESS)
+    {
+        DisplayError(status, "GetCertificateExpirationDate: error reading openssl process output");
+        return -1;
+    }
+
+    // Drain the output from the child process
+    while (apr_file_gets(buf, 128, proc.out) == APR_SUCCESS)
+    {
+        ;
+    }
+
+    // Wait for the child process to finish
+    status = apr_proc_wait(&proc, &exitCode, &why, APR_WAIT);
+    if (!APR_STATUS_IS_CHILD_DONE(status))
+    {
+        DisplayError(status, "GetCertificateExpirationDate: openssl process did not finish successfully");
+        return -1;
+    }
+
+    // check for format: "notAfter=Mmm dd hh:mm:ss yyyy GMT", with Mmm
+    // being a three-letter Engish abbreviation for the month name
+    if (strncmp(dateString, "notAfter=", 9) != 0)
+    {
+        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter date");
+        return -1;
+    }
+    if (sscanf(&dateString[9], "%3s%d%d:%d:%d %d", monName, &day, &hour, &min, &sec, &year) < 6)
+    {
+        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter date");
+        return -1;
+    }
+    for (month = 0; month < 12; month++)
+    {
+        if (apr_strnatcasecmp(monName, s_monNames[month]) == 0)
+            break;
+    }
+    if (month == 12)
+    {
+        DisplayError(apr_get_netos_error(), "GetCertificateExpirationDate: could not read openssl notAfter month");
+        return -1;
+    }
+
+    // Set the expiration date in CIM time
+    sprintf(date, "%04d%02d%02d%02d%02d%02d.000000+000", year, month+1, day, hour, min, sec);
+
+    // Compute APR time of expiration
+    memset(&tmBuf, 0, sizeof (struct tm));   // set DST and time zone to 0
+    tmBuf.tm_year = year - 1900;
+    tmBuf.tm_mon = month;
+    tmBuf.tm_mday = day;
+    tmBuf.tm_hour = hour;
+    tmBuf.tm_min = min;
+    tmBuf.tm_sec = sec;
+    *expirationAprTime = (apr_time_t)mktime(&tmBuf) * 1000000;
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Refresh the expiration date of a certificate if its file has changed
+    since we last looked (or we haven't been able to read it yet).  This runs
+    openssl, so the DataSampler does it periodically rather than providers
+    doing it on each enumeration.
+
+    \param      item                    Index of the certificate
+
+    \returns    true if the expiration date is known
+*/
+
+bool ApacheDataCollector::RefreshCertificate(apr_size_t item)
+{
+    mmap_certificate_elements* cert = &m_certificate_data->certificates[item];
+    const char* certificateFileName = GetDataString(cert->certificateFileNameOffset);
+    apr_finfo_t fileInfo;
+    apr_status_t status;
+
+    // See if the file is newer that the stored dates
+    status = apr_stat(&fileInfo, certificateFileName, APR_FINFO_MTIME, m_apr_pool);
+    if (status != APR_SUCCESS || fileInfo.mtime != cert->certificateFileMtime)
+    {
+        // Get an updated copy of the certificate date information
+        cert->certificateFileMtime = fileInfo.mtime;
+        if (status != APR_SUCCESS
+            || GetCertificateExpirationDate(certificateFileName,
+                                            m_apr_pool,
+                                            cert->certificateExpirationCimTime,
+                                            &cert->certificateExpirationAprTime) < 0)
+        {
+            // Problem getting certificate expiration information; try later
+            cert->certificateFileMtime = 0;
+        }
+    }
+
+    return 0 != cert->certificateFileMtime;
+}
+
 const char* ApacheDataCollector::GetServerConfigFile()
 {
     const char* configFile = g_pFactory->GetInit()->GetServerConfigFile(m_apr_pool);
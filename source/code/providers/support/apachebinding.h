@@ -40,16 +40,24 @@
 #include <apr_global_mutex.h>
 #include <apr_shm.h>
 #include <apr_strings.h>
+#include <apr_thread_mutex.h>
 
 #include "mmap_region.h"
 #include "datasampler.h"
+#include "logger.h"
+#include "poolcache.h"
 #include "temppool.h"
 
 #include <string>
+#include <vector>
+
+#include <sys/types.h>
 
 
 // Forward definitions
 class ApacheDataCollector;
+struct ApacheVHostSnapshot;
+typedef std::vector<ApacheVHostSnapshot> ApacheSnapshotBuffer;
 
 /*------------------------------------------------------------------------------*/
 /**
@@ -91,13 +99,18 @@ public:
     ApacheDataCollectorDependencies()
     : m_mutexMapRW(NULL),
       m_mmap_region(NULL),
-      m_apr_attach_pool(NULL)
+      m_control_region(NULL),
+      m_apr_attach_pool(NULL),
+      m_regionDevice(0),
+      m_regionInode(0),
+      m_fRegionIdentityKnown(false)
     {}
     virtual ~ApacheDataCollectorDependencies() { Detach("Destructor"); }
     virtual apr_status_t Attach(const char *text, apr_pool_t* pool,
             mmap_server_data** svr, mmap_vhost_data** vhost,
             mmap_certificate_data** cert, mmap_string_table** str);
     virtual apr_status_t Detach(const char *text);
+    virtual bool IsRegionCurrent(apr_uint32_t generation, bool checkFile);
 
     virtual apr_status_t Lock() { return apr_global_mutex_lock(m_mutexMapRW); }
     virtual apr_status_t Unlock() { return apr_global_mutex_unlock(m_mutexMapRW); }
@@ -114,8 +127,83 @@ private:
 
     apr_global_mutex_t *m_mutexMapRW;
     apr_shm_t *m_mmap_region;
+    apr_shm_t *m_control_region;    // Kept attached to notice when Apache publishes a new region
+
+    apr_pool_t *m_apr_attach_pool; // Owned by ApacheRegionAttachment; do not clean up!
 
-    apr_pool_t *m_apr_attach_pool; // Owned by ApacheDataCollector; do not clean up!
+    // Identity of the region's file, to notice when Apache is stopped and started
+    std::string m_regionName;
+    dev_t m_regionDevice;
+    ino_t m_regionInode;
+    bool m_fRegionIdentityKnown;
+};
+
+
+//
+// Apache Region Attachment - one mapping of the shared memory region (and its
+// mutex), shared by every data collector that reads that region.  Owned by
+// ApacheAttachmentManager, which counts the collectors that use it.
+//
+
+class ApacheRegionAttachment
+{
+public:
+    ApacheRegionAttachment(ApacheDataCollectorDependencies* deps, apr_pool_t* pool)
+    : m_server_data(NULL), m_vhost_data(NULL),
+      m_certificate_data(NULL), m_string_data(NULL),
+      m_pDeps(deps), m_apr_pool(pool), m_refCount(0), m_verifyTime(0)
+    {}
+    ~ApacheRegionAttachment();
+
+    apr_status_t Attach(const char *text);
+    bool IsCurrent(apr_time_t now);
+
+    apr_status_t Lock() { return m_pDeps->Lock(); }
+    apr_status_t Unlock() { return m_pDeps->Unlock(); }
+
+    mmap_server_data *m_server_data;
+    mmap_vhost_data *m_vhost_data;
+    mmap_certificate_data *m_certificate_data;
+    mmap_string_table *m_string_data;
+
+private:
+    static const apr_interval_time_t s_verifyInterval;
+
+    ApacheDataCollectorDependencies* m_pDeps;
+    apr_pool_t *m_apr_pool;
+    apr_uint32_t m_refCount;            // Data collectors using this attachment
+    apr_time_t m_verifyTime;            // When the region's file was last verified
+
+    friend class ApacheAttachmentManager;
+};
+
+
+//
+// Apache Attachment Manager - keeps the provider attached to the current
+// shared memory region, so data collectors needn't map it each time they're
+// used.  Owned by ApacheInitialization.  The region is mapped again only when
+// Apache replaces it (on a graceful restart, or when it's stopped and started);
+// collectors still using the prior mapping keep it until they're done.
+//
+
+class ApacheAttachmentManager
+{
+public:
+    ApacheAttachmentManager() : m_apr_pool(NULL), m_mutex(NULL), m_current(NULL) {}
+    ~ApacheAttachmentManager() { Shutdown(); }
+
+    apr_status_t Initialize(apr_pool_t* parent);
+    void Shutdown();
+
+    apr_status_t Acquire(const char *text, ApacheRegionAttachment** attachment);
+    void Release(ApacheRegionAttachment* attachment);
+
+private:
+    void ReleaseLocked(ApacheRegionAttachment* attachment);
+
+    apr_pool_t *m_apr_pool;
+    apr_thread_mutex_t *m_mutex;        // Providers (and the sampler) attach from several threads
+    ApacheRegionAttachment *m_current;  // Attachment to the current region (NULL if none)
 };
 
 
@@ -127,13 +215,21 @@ private:
 class ApacheInitialization
 {
 public:
+    // Snapshot buffers kept for reuse (each has room for every virtual host, so may be large)
+    static const apr_size_t MaxCachedSnapshotBuffers = 4;
+
     explicit ApacheInitialization(ApacheInitDependencies* deps)
-    : m_pDeps(deps), m_apr_pool(NULL), m_loadCount(0)
+    : m_pDeps(deps), m_apr_pool(NULL), m_loadCount(0), m_snapshotMutex(NULL)
     {}
-    ~ApacheInitialization() { delete m_pDeps; }
+    ~ApacheInitialization() { FreeSnapshotBuffers(); delete m_pDeps; }
 
     static apr_status_t OMI_Error(int err) { return APR_OS_START_USERERR + err; }
-    void DisplayError(apr_status_t status, const char *text);
+
+    // Messages are rate limited by call site (the return address), so these mustn't be inlined
+    void DisplayError(apr_status_t status, const char *text) __attribute__ ((noinline));
+    void DisplayMessage(ProviderLogger::Level level, const char *text, bool fRateLimit) __attribute__ ((noinline));
+    ProviderLogger& GetLogger() { return m_logger; }
+
     apr_status_t Load(const char *text);
     apr_status_t Unload(const char *text);
 
@@ -148,6 +244,11 @@ public:
         { m_pDeps->GetApacheProcessName(processName); }
 
     apr_pool_t *GetPool() { return m_apr_pool; }
+    PoolCache& GetPools() { return m_pools; }
+    ApacheAttachmentManager& GetAttachments() { return m_attachments; }
+
+    ApacheSnapshotBuffer* GetSnapshotBuffer();
+    void PutSnapshotBuffer(ApacheSnapshotBuffer* buffer);
 
 protected:
     apr_status_t Initialize(const char *text);
@@ -159,17 +260,79 @@ private:
 
     apr_pool_t *m_apr_pool;
     int m_loadCount;
+    ProviderLogger m_logger;
+    PoolCache m_pools;
+    ApacheAttachmentManager m_attachments;
+
+    // Snapshot buffers outlive the collectors (and their pools), so they needn't be reallocated
+    // for every enumeration
+    void FreeSnapshotBuffers();
+    apr_thread_mutex_t *m_snapshotMutex;
+    std::vector<ApacheSnapshotBuffer*> m_snapshotBuffers;
 
     friend class DataSampler;
 };
 
 
+//
+// Apache Snapshot - point-in-time copy of the counters and rates in the region,
+// taken by ApacheDataCollector::Snapshot() in one short pass.  Providers build
+// their instances from the copy rather than from counters that Apache (and the
+// data sampler) keep changing, so _Total agrees with the virtual hosts.
+//
+
+struct ApacheServerSnapshot
+{
+    apr_uint32_t idleWorkers;
+    apr_uint32_t busyWorkers;
+    apr_uint32_t percentCPU;
+    apr_uint32_t cpuAverage[MMAP_RATE_WINDOWS];
+    apr_uint32_t cpuPeak[MMAP_RATE_WINDOWS];
+    apr_uint32_t busyWorkersAverage[MMAP_RATE_WINDOWS];
+    apr_uint32_t busyWorkersPeak[MMAP_RATE_WINDOWS];
+    apr_uint64_t residentBytes;
+    apr_uint64_t childResidentBytes;
+    apr_uint32_t childProcesses;
+    apr_uint32_t childPercentCPU;
+};
+
+struct ApacheVHostSnapshot
+{
+    bool active;                        // False for dynamic host slots not in use
+
+    apr_uint64_t requestsTotal;
+    apr_uint64_t requestsBytes;
+    apr_uint64_t responses[MMAP_RESPONSE_COUNT];
+
+    apr_uint32_t requestsPerSecond;
+    apr_uint32_t kbPerRequest;
+    apr_uint32_t kbPerSecond;
+    apr_uint32_t responsesPerMinute[MMAP_RESPONSE_COUNT];
+    apr_uint32_t latencyP50;
+    apr_uint32_t latencyP95;
+    apr_uint32_t latencyP99;
+    apr_uint32_t latencyMax;
+    apr_uint32_t uniqueClients;
+    apr_uint32_t uniqueClientsToday;
+    apr_uint32_t rateAverage[MMAP_RATE_COUNT][MMAP_RATE_WINDOWS];
+    apr_uint32_t ratePeak[MMAP_RATE_COUNT][MMAP_RATE_WINDOWS];
+};
+
+struct ApacheSnapshot
+{
+    ApacheServerSnapshot server;
+    apr_size_t vhostCount;              // Number of elements of vhosts (as GetVHostCount())
+    ApacheVHostSnapshot *vhosts;
+};
+
+
 //
 // Apache Data Collector - Attaches to shared memory segment for Apache data
 //
 // The intent is that this is generated on the stack, and when it falls out of
 // scope, the destructor will clean everything up. You may also call Detach()
-// explicitly to detach from the memory pool.
+// explicitly to detach from the memory pool.  Attaching is cheap: collectors
+// share the provider's mapping of the region (see ApacheAttachmentManager).
 //
 // Note: The Attach() method MUST be called, and MUST be checked for a valid
 // return code. If Attach() is not called, or if it fails and data accessors
@@ -180,7 +343,7 @@ private:
 class ApacheDataCollector
 {
 public:
-    explicit ApacheDataCollector(ApacheDataCollectorDependencies* deps);
+    ApacheDataCollector();
     ~ApacheDataCollector();
     apr_status_t Attach(const char *text);
     apr_status_t Detach(const char *text);
@@ -197,15 +360,75 @@ public:
     apr_uint32_t GetWorkerCountIdle() { return apr_atomic_read32(&m_server_data->idleWorkers); }
     apr_uint32_t GetWorkerCountBusy() { return apr_atomic_read32(&m_server_data->busyWorkers); }
     apr_uint32_t GetCPUUtilization() { return apr_atomic_read32(&m_server_data->percentCPU); }
+    mmap_rate_history& GetCPUHistory() { return m_server_data->cpuHistory; }
+    mmap_rate_history& GetWorkerCountBusyHistory() { return m_server_data->busyWorkersHistory; }
+    apr_uint64_t GetResidentMemory() { return MMAP_ATOMIC_READ64(&m_server_data->residentBytes); }
+    apr_uint64_t GetChildResidentMemory() { return MMAP_ATOMIC_READ64(&m_server_data->childResidentBytes); }
+    apr_uint32_t GetChildProcessCount() { return apr_atomic_read32(&m_server_data->childProcesses); }
+    apr_uint32_t GetChildCPUUtilization() { return apr_atomic_read32(&m_server_data->childPercentCPU); }
+    apr_size_t GetChildPidCount() { return m_server_data->childPidCount; }
+    volatile apr_uint32_t *GetChildPids() { return MMAP_CHILD_PIDS(m_server_data); }
 
     apr_size_t GetVHostCount() { return m_vhost_data->count; }
     mmap_vhost_elements *GetVHostElements() { return m_vhost_data->vhosts; }
+    mmap_vhost_statistics *GetVHostStatistics() { return MMAP_VHOST_STATISTICS(m_vhost_data); }
+    const char *GetVHostName(apr_size_t item);
+    const char *GetVHostInstanceID(apr_size_t item);
+    bool IsVHostActive(apr_size_t item);
+    mmap_vhost_address *GetVHostAddresses() { return MMAP_VHOST_ADDRESSES(m_server_data); }
+    apr_size_t *GetVHostAliases() { return MMAP_VHOST_ALIASES(m_server_data); }
+    void GetVHostCounters(apr_size_t item, mmap_vhost_counters& counters);
+
+    // Copy the counters and rates of the server and every virtual host (the
+    // copy belongs to the collector, and is overwritten by the next call)
+    const ApacheSnapshot& Snapshot();
+
+    apr_size_t GetCounterShardCount() { return m_server_data->counterShardCount; }
+    mmap_vhost_counters *GetCounterShard(apr_size_t shard) { return MMAP_COUNTER_SLAB(m_server_data, shard); }
+    mmap_vhost_counters *GetEvictedCounters() { return MMAP_EVICTED_COUNTERS(m_server_data); }
+    mmap_vhost_latency *GetLatencyShard(apr_size_t shard) { return MMAP_LATENCY_SLAB(m_server_data, shard); }
+    void TakeVHostLatency(apr_size_t item, mmap_vhost_latency& latency);
+
+    apr_size_t GetTopUrlCount() { return m_server_data->topUrlCount; }
+    mmap_topurl_result *GetTopUrlResults(apr_size_t item) { return MMAP_TOPURL_RESULTS(m_server_data, item); }
+    void TakeTopUrls(apr_size_t item, std::vector<mmap_topurl_result>& urls);
+
+    // Unique clients are only estimated if CimUniqueClients is On
+    bool HasVHostClients() { return 0 != m_server_data->clientsCount; }
+    apr_int32_t GetClientsDay() { return m_server_data->clientsDay; }
+    void SetClientsDay(apr_int32_t day) { m_server_data->clientsDay = day; }
+    mmap_vhost_clients *GetVHostClients(apr_size_t item) { return &MMAP_VHOST_CLIENTS(m_server_data)[item]; }
+    void TakeVHostClients(apr_size_t item, unsigned char *registers);
+
+    // Dynamic hosts (CimDynamicHosts) are named at run time, by Host header
+    apr_size_t GetDynamicHostCount() { return m_server_data->dynamicHostCount; }
+    apr_size_t GetDynamicHostBase() { return m_server_data->dynamicHostBase; }
+    bool IsDynamicHost(apr_size_t item) { return item - GetDynamicHostBase() < GetDynamicHostCount(); }
+    mmap_dynamic_host *GetDynamicHost(apr_size_t item) { return &MMAP_DYNAMIC_HOSTS(m_server_data)[item - GetDynamicHostBase()]; }
+    volatile apr_uint64_t *GetDynamicHostKey(apr_size_t item) { return &MMAP_DYNAMIC_HOST_KEYS(m_server_data)[item - GetDynamicHostBase()]; }
+    bool IsDynamicHostEvicting(apr_size_t item) { return MMAP_DYNAMIC_HOST_EVICTING == MMAP_ATOMIC_READ64(GetDynamicHostKey(item)); }
+    bool MarkDynamicHostEvicting(apr_size_t item, apr_uint32_t idleSince);
+    void EvictDynamicHost(apr_size_t item);
+
+    mmap_trace_ring *GetTraceRing() { return MMAP_TRACE_RING(m_server_data); }
+    static apr_size_t ReadTraceRecords(mmap_trace_ring *ring, apr_uint64_t& cursor,
+                                       mmap_trace_record *records, apr_size_t max);
 
     apr_size_t GetCertificateCount() { return m_certificate_data->count; }
     mmap_certificate_elements *GetCertificateElements() { return m_certificate_data->certificates; }
+    bool RefreshCertificate(apr_size_t item);
 
-    apr_status_t LockMutex() { return m_pDeps->Lock(); }
-    apr_status_t UnlockMutex() { return m_pDeps->Unlock(); }
+    apr_status_t LockMutex() { return m_attachment->Lock(); }
+    apr_status_t UnlockMutex() { return m_attachment->Unlock(); }
+
+    // Lock-free consistent reads of configuration data: call ReadBegin(), read,
+    // and if ReadRetry() says Apache rebuilt the region meanwhile, Reattach()
+    // and read again (up to ReadAttempts times)
+    static const int ReadAttempts = 3;
+    apr_uint32_t GetGeneration() { return m_server_data->header.generation; }
+    apr_uint32_t ReadBegin() { return mmap_region_read_begin(&m_server_data->header); }
+    bool ReadRetry(apr_uint32_t sequence) { return 0 != mmap_region_read_retry(&m_server_data->header, sequence); }
+    apr_status_t Reattach(const char *text);
 
     apr_pool_t *GetPool() { return m_apr_pool; }
 
@@ -215,10 +438,19 @@ protected:
     mmap_certificate_data *m_certificate_data;
     mmap_string_table *m_string_data;
 
-    ApacheDataCollectorDependencies* m_pDeps;
+    ApacheRegionAttachment* m_attachment;
 
 private:
-    apr_pool_t *m_apr_pool;
+    apr_pool_t *m_apr_pool;             // From the provider's pool cache (unless m_fOwnPool)
+    bool m_fOwnPool;
+
+    ApacheSnapshot m_snapshot;
+    ApacheSnapshotBuffer *m_snapshotBuffer; // Holds m_snapshot.vhosts (from ApacheInitialization, once needed)
+
+    // Not copyable: a copy would give back the attachment, pool and snapshot
+    // buffer a second time (declared but not defined)
+    ApacheDataCollector(const ApacheDataCollector&);
+    ApacheDataCollector& operator=(const ApacheDataCollector&);
 
     friend class DataSampler;
 };
@@ -227,7 +459,8 @@ private:
 //
 // Apache Class Factory
 //
-// Allows contruction of ApacheInitialization and ApacheDataCollector classes.
+// Allows contruction of ApacheInitialization and of the dependencies of
+// ApacheDataCollector classes (which are constructed directly, on the stack).
 // This allows us to replace the factory for dependency injection purposes.
 //
 
@@ -245,8 +478,9 @@ public:
 
         return m_pInit;
     }
-    virtual ApacheDataCollector DataCollectorFactory()
-    { return ApacheDataCollector( new ApacheDataCollectorDependencies() ); }
+    // Dependencies used to map the shared memory region (when the provider isn't attached to it)
+    virtual ApacheDataCollectorDependencies* DataCollectorDependenciesFactory()
+    { return new ApacheDataCollectorDependencies(); }
 
 protected:
     virtual ApacheInitialization* InitializationFactory()
@@ -272,11 +506,25 @@ inline apr_status_t OMI_Error(int err)
     return ApacheInitialization::OMI_Error(err);
 }
 
-inline void DisplayError(apr_status_t status, const char *text)
+// Errors (non-zero status) are logged at LevelError, and status messages at LevelInfo.
+// These are always inlined so that each caller is its own site for rate limiting.
+
+inline __attribute__ ((always_inline)) void DisplayError(apr_status_t status, const char *text)
 {
     g_pFactory->GetInit()->DisplayError(status, text);
 }
 
+inline __attribute__ ((always_inline)) void DisplayMessage(ProviderLogger::Level level, const char *text, bool fRateLimit = true)
+{
+    g_pFactory->GetInit()->DisplayMessage(level, text, fRateLimit);
+}
+
+// Check before formatting a message that may not be logged
+inline bool IsLogging(ProviderLogger::Level level)
+{
+    return g_pFactory->GetInit()->GetLogger().IsEnabled(level);
+}
+
 
 
 //
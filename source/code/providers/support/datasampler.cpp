@@ -37,77 +37,330 @@
 #include "datasampler.h"
 
 #include <algorithm>
-#include <limits>
+#include <vector>
+#include <math.h>
 
+#include <fcntl.h>
+#include <malloc.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 
-struct LinuxProcStat {
-    int processId;                           //!< %d  1
-    char command[30];                        //!< %s
-    char state;                              //!< %c
-    int parentProcessId;                     //!< %d
-    int processGroupId;                      //!< %d  5
-    int sessionId;                           //!< %d
-    int controllingTty;                      //!< %d
-    int terminalProcessId;                   //!< %d
-    unsigned long flags;                     //!< %lu
-    unsigned long minorFaults;               //!< %lu 10
-    unsigned long childMinorFaults;          //!< %lu
-    unsigned long majorFaults;               //!< %lu
-    unsigned long childMajorFaults;          //!< %lu
-    unsigned long userTime;                  //!< %lu
-    unsigned long systemTime;                //!< %lu 15
-    long childUserTime;                      //!< %ld
-    long childSystemTime;                    //!< %ld
-    long priority;                           //!< %ld
-    long nice;                               //!< %ld
-    // dummy at this position, not read;     //!< %ld 20
-    long intervalTimerValue;                 //!< %ld
-    unsigned long startTime;                 //!< %lu
-    unsigned long virtualMemSizeBytes;       //!< %lu
-    long residentSetSize;                    //!< %ld
-    unsigned long residentSetSizeLimit;      //!< %lu 25
-    unsigned long startAddress;              //!< %lu
-    unsigned long endAddress;                //!< %lu
-    unsigned long startStackAddress;         //!< %lu
-    unsigned long kernelStackPointer;        //!< %lu
-    unsigned long kernelInstructionPointer;  //!< %lu 30
-    unsigned long signal;                    //!< %lu
-    unsigned long blocked;                   //!< %lu
-    unsigned long sigignore;                 //!< %lu
-    unsigned long sigcatch;                  //!< %lu
-    unsigned long waitChannel;               //!< %lu 35
-    unsigned long numPagesSwapped;           //!< %lu
-    unsigned long cumNumPagesSwapped;        //!< %lu
-    int exitSignal;                          //!< %d
-    int processorNum;                        //!< %d
-    unsigned long realTimePriority;          //!< %lu 40 (Since 2.5.19)
-    unsigned long schedulingPolicy;          //!< %lu    (Since 2.5.19)
-
-    static const int procstat_len = 40; //!< Number of fields not counting dummy
-
-    /** The format string that should be supplied to fscanf() to read procstat_fields */
-    static const char *scanstring;  /* = 
-        "%d %s %c %d %d %d %d %d %lu %lu " // 1 to 10
-        "%lu %lu %lu %lu %lu %ld %ld %ld %ld %*ld " // 11 to 20
-        "%ld %lu %lu %ld %lu %lu %lu %lu %lu %lu " // 21 to 30
-        "%lu %lu %lu %lu %lu %lu %lu %d %d %lu %lu"; // 31 to 41
-                                    */
-};
-
-const char* LinuxProcStat::scanstring = 
-        /* "%d %s " */ "%c %d %d %d %d %d %lu %lu " // 1 to 10 (pid & command read independently)
-        "%lu %lu %lu %lu %lu %ld %ld %ld %ld %*ld " // 11 to 20
-        "%ld %lu %lu %ld %lu %lu %lu %lu %lu %lu " // 21 to 30
-        "%lu %lu %lu %lu %lu %lu %lu %d %d %lu %lu"; // 31 to 41
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+void ProcessTree::Reset(apr_size_t slots)
+{
+    Slot empty = { 0, -1, 0 };
+
+    for (size_t i = 0; i < m_slots.size(); i++)
+    {
+        if (m_slots[i].fd >= 0)
+        {
+            close(m_slots[i].fd);
+        }
+    }
+
+    m_slots.assign(slots, empty);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Read the usage of the process in a slot.  The slot's file is (re)opened
+    only when the process in the slot changes.
+
+    \param      slot                    Slot to read
+    \param      pid                     Process in the slot (zero if none)
+    \param      usage                   Usage of the process (if it's running)
+
+    \returns    true if the process is running (and usage was read)
+*/
+
+bool ProcessTree::Read(apr_size_t slot, pid_t pid, Usage& usage)
+{
+    Slot& s = m_slots[slot];
+
+    if (s.pid != pid)
+    {
+        if (s.fd >= 0)
+        {
+            close(s.fd);
+        }
+
+        s.pid = pid;
+        s.fd = -1;
+        s.ticks = 0;
+
+        if (pid > 0)
+        {
+            char path[32];
+
+            apr_snprintf(path, sizeof(path), "/proc/%d/stat", static_cast<int>(pid));
+            s.fd = open(path, O_RDONLY | O_CLOEXEC);
+        }
+    }
+
+    if (s.fd < 0)
+    {
+        return false;
+    }
+
+    // Once the process exits, its file reads no more (even if its process ID is reused), so
+    // it's closed until another process takes the slot
+    char buffer[1024];
+    ssize_t length = pread(s.fd, buffer, sizeof(buffer), 0);
+    if (length <= 0 || ! ParseStat(buffer, static_cast<apr_size_t>(length), usage))
+    {
+        close(s.fd);
+        s.fd = -1;
+        return false;
+    }
+
+    usage.intervalTicks = usage.ticks > s.ticks ? usage.ticks - s.ticks : 0;
+    s.ticks = usage.ticks;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Parse the contents of /proc/<pid>/stat in place.
+
+    The command (the second field) is in parentheses, and may contain anything
+    (including spaces and parentheses), so fields are counted from the last ')'.
+
+    \param      buffer                  Contents of the file (need not be terminated)
+    \param      length                  Length of the contents
+    \param      usage                   Usage of the process (ticks, reapedTicks and residentPages)
+
+    \returns    true if the contents were complete enough to parse
+*/
+
+bool ProcessTree::ParseStat(const char *buffer, apr_size_t length, Usage& usage)
+{
+    // Fields (numbered from one, as in proc(5)) that we use
+    static const int UserTimeField = 14, SystemTimeField = 15, ChildUserTimeField = 16, ChildSystemTimeField = 17;
+    static const int ResidentSetField = 24;
+
+    const char *end = buffer + length;
+    const char *p = end;
+    while (p > buffer && *(p - 1) != ')')
+    {
+        p--;
+    }
+    if (p == buffer)
+    {
+        return false;
+    }
+
+    apr_uint64_t userTime = 0, systemTime = 0, childUserTime = 0, childSystemTime = 0;
+    int field = 2;
+    while (field < ResidentSetField)
+    {
+        while (p < end && ' ' == *p)
+        {
+            p++;
+        }
+        if (p == end || '\n' == *p)
+        {
+            return false;
+        }
+
+        // Values we use are never negative (in practice), so a signed value is taken as zero
+        apr_uint64_t value = 0;
+        bool negative = ('-' == *p);
+        for (; p < end && ' ' != *p && '\n' != *p; p++)
+        {
+            if (*p >= '0' && *p <= '9')
+            {
+                value = value * 10 + (*p - '0');
+            }
+        }
+        if (negative)
+        {
+            value = 0;
+        }
+
+        switch (++field)
+        {
+            case UserTimeField:         userTime = value; break;
+            case SystemTimeField:       systemTime = value; break;
+            case ChildUserTimeField:    childUserTime = value; break;
+            case ChildSystemTimeField:  childSystemTime = value; break;
+            case ResidentSetField:      usage.residentPages = value; break;
+        }
+    }
+
+    usage.ticks = userTime + systemTime;
+    usage.reapedTicks = childUserTime + childSystemTime;
+    return true;
+}
+
+const apr_size_t RateHistory::SamplesPerMinute;
+const apr_size_t RateHistory::Minutes;
+const apr_size_t RateHistory::NoSeries;
+
+// Rate history windows, in minutes; the first is the individual samples of the last minute
+const apr_uint32_t RateHistory::WindowMinutes[MMAP_RATE_WINDOWS] = { 1, 5, 15, 60 };
+
+void RateHistory::Reset(apr_size_t series)
+{
+    Minute empty = { 0, 0 };
+
+    m_series = series;
+    m_samples.assign(series * SamplesPerMinute, 0);
+    m_minutes.assign(series * Minutes, empty);
+    m_sampleHead = m_sampleCount = 0;
+    m_minuteHead = m_minuteCount = 0;
+}
+
+// Rebuild the history for a new set of series, each taking the history of series from[series]
+// (or starting empty if that is NoSeries); the sample and minute positions carry on
+void RateHistory::Remap(const std::vector<apr_size_t>& from)
+{
+    Minute empty = { 0, 0 };
+    std::vector<apr_uint32_t> samples(from.size() * SamplesPerMinute, 0);
+    std::vector<Minute> minutes(from.size() * Minutes, empty);
+
+    for (apr_size_t series = 0; series < from.size(); series++)
+    {
+        if (from[series] < m_series)
+        {
+            std::copy(m_samples.begin() + from[series] * SamplesPerMinute,
+                      m_samples.begin() + (from[series] + 1) * SamplesPerMinute,
+                      samples.begin() + series * SamplesPerMinute);
+            std::copy(m_minutes.begin() + from[series] * Minutes,
+                      m_minutes.begin() + (from[series] + 1) * Minutes,
+                      minutes.begin() + series * Minutes);
+        }
+    }
+
+    m_series = from.size();
+    m_samples.swap(samples);
+    m_minutes.swap(minutes);
+}
+
+void RateHistory::Clear(apr_size_t series)
+{
+    memset(&m_samples[series * SamplesPerMinute], 0, sizeof(apr_uint32_t) * SamplesPerMinute);
+    memset(&m_minutes[series * Minutes], 0, sizeof(Minute) * Minutes);
+}
+
+// Move on to the next sample (once each series has been added); each full minute of samples
+// is folded into the per-minute history
+void RateHistory::Advance()
+{
+    m_sampleHead = (m_sampleHead + 1) % SamplesPerMinute;
+    m_sampleCount = std::min(m_sampleCount + 1, SamplesPerMinute);
+
+    if (0 != m_sampleHead)
+    {
+        return;
+    }
+
+    for (apr_size_t series = 0; series < m_series; series++)
+    {
+        const apr_uint32_t *samples = &m_samples[series * SamplesPerMinute];
+        Minute& minute = m_minutes[series * Minutes + m_minuteHead];
+        apr_uint64_t sum = 0;
+
+        minute.peak = 0;
+        for (apr_size_t i = 0; i < SamplesPerMinute; i++)
+        {
+            sum += samples[i];
+            minute.peak = std::max(minute.peak, samples[i]);
+        }
+        minute.average = static_cast<apr_uint32_t>(sum / SamplesPerMinute);
+    }
+
+    m_minuteHead = (m_minuteHead + 1) % Minutes;
+    m_minuteCount = std::min(m_minuteCount + 1, Minutes);
+}
+
+void RateHistory::Compute(apr_size_t series, mmap_rate_history& history) const
+{
+    const apr_uint32_t *samples = &m_samples[series * SamplesPerMinute];
+    apr_uint64_t sum = 0;
+    apr_uint32_t peak = 0;
+
+    for (apr_size_t i = 0; i < m_sampleCount; i++)
+    {
+        sum += samples[i];
+        peak = std::max(peak, samples[i]);
+    }
+    apr_uint32_t sampleAverage = m_sampleCount ? static_cast<apr_uint32_t>(sum / m_sampleCount) : 0;
+    apr_uint32_t samplePeak = peak;
+
+    apr_atomic_set32(&history.average[0], sampleAverage);
+    apr_atomic_set32(&history.peak[0], samplePeak);
+
+    // Longer windows cover whole minutes (until a minute has passed, they report the samples so far)
+    for (int w = 1; w < MMAP_RATE_WINDOWS; w++)
+    {
+        apr_size_t minutes = std::min(static_cast<apr_size_t>(WindowMinutes[w]), m_minuteCount);
+
+        if (minutes)
+        {
+            sum = 0;
+            peak = 0;
+            for (apr_size_t m = 0; m < minutes; m++)
+            {
+                const Minute& minute = m_minutes[series * Minutes + (m_minuteHead + Minutes - 1 - m) % Minutes];
+                sum += minute.average;
+                peak = std::max(peak, minute.peak);
+            }
+            apr_atomic_set32(&history.average[w], static_cast<apr_uint32_t>(sum / minutes));
+            apr_atomic_set32(&history.peak[w], peak);
+        }
+        else
+        {
+            apr_atomic_set32(&history.average[w], sampleAverage);
+            apr_atomic_set32(&history.peak[w], samplePeak);
+        }
+    }
+}
+
+// Rate tasks sample this soon after attaching, so providers don't report zeros until a full interval passes
+const apr_interval_time_t DataSampler::s_bootstrapInterval = apr_time_from_sec(5);
 
+// How often to look for Apache (and to wake at all, if no task is due sooner)
+const apr_interval_time_t DataSampler::s_attachRetryInterval = apr_time_from_sec(10);
+
+// How long a dynamic host stays marked for eviction before it is reset (at least a sampling interval,
+// so requests that found the host before it was marked have been counted)
+const apr_interval_time_t DataSampler::s_evictionGrace = apr_time_from_sec(10);
 
 DataSampler::DataSampler()
-    : m_tid(NULL), m_skipValidationCount(0), m_mutex(NULL), m_cond(NULL), m_fShutdown(false)
+    : m_tid(NULL), m_fBootstrapped(false), m_traceCursor(0), m_generation(0), m_historyServerPid(0), m_childTicks(0), m_mutex(NULL), m_cond(NULL), m_fShutdown(false)
 {
-    m_timeLastUpdated = apr_time_now();
+    // Tasks, in the order they run when due at the same time
+    static const struct
+    {
+        const char *name;
+        int seconds;
+        bool computesRates;
+        void (DataSampler::*run)(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    } tasks[] =
+    {
+        { "trace records",      5,    false, &DataSampler::SampleTraceRecords },
+        { "server",             10,   true,  &DataSampler::SampleServer },
+        { "rate history",       10,   true,  &DataSampler::SampleRateHistory },
+        { "region validation",  30,   false, &DataSampler::ValidateRegion },
+        { "virtual hosts",      60,   true,  &DataSampler::SampleVHosts },
+        { "certificates",       3600, false, &DataSampler::RefreshCertificates },
+        { "memory usage",       600,  false, &DataSampler::LogMemoryUsage }
+    };
+
+    for (size_t t = 0; t < sizeof(tasks) / sizeof(tasks[0]); t++)
+    {
+        Task task;
+        task.name = tasks[t].name;
+        task.interval = apr_time_from_sec(tasks[t].seconds);
+        task.computesRates = tasks[t].computesRates;
+        task.run = tasks[t].run;
+        task.lastRun = task.nextRun = 0;
+        m_tasks.push_back(task);
+    }
 }
 
 DataSampler::~DataSampler()
@@ -237,13 +490,14 @@ apr_status_t DataSampler::Unlock()
 void DataSampler::ThreadMain()
 {
     apr_status_t status;
-    const apr_time_t sleepInterval = apr_time_from_sec(60);
-    apr_time_t wakeupTime = apr_time_now() + sleepInterval;
+
+    // Attach (and take a baseline sample) right away
+    apr_time_t wakeupTime = apr_time_now();
 
     DisplayError(0, "DataSampler::ThreadMain is alive");
 
     /*
-     * Main loop: Wait for condition (shutdown); if none, then wake up one/minute for calculations
+     * Main loop: Wait for condition (shutdown); if none, then wake up when the next task is due
      */
 
     if (APR_SUCCESS != (status = Lock()))
@@ -254,18 +508,13 @@ void DataSampler::ThreadMain()
 
     while (! m_fShutdown)
     {
-        /*
-         * Schedule such that we run every 'sleepInterval' (converted to seconds).
-         * If we get scheduled "late", compensate next time around.
-         */
-
         apr_time_t currentTime = apr_time_now();
 
         // If it's time to wake up, just ignore the condition entirely
         if (currentTime <= wakeupTime)
         {
             apr_interval_time_t timeout = wakeupTime - currentTime;
-            DisplayError(0, "DataSampler::ThreadMain Waiting for condition");
+            DisplayMessage(ProviderLogger::LevelDebug, "DataSampler::ThreadMain Waiting for condition");
             status = apr_thread_cond_timedwait(m_cond, m_mutex, timeout);
         }
         else
@@ -292,7 +541,7 @@ void DataSampler::ThreadMain()
             continue;
         }
 
-        // Perform computations now (leave condition unlocked while performing computatations so it can be signalled)
+        // Run tasks now (leave condition unlocked while running them so it can be signalled)
 
         if (APR_SUCCESS != (status = Unlock()))
         {
@@ -300,17 +549,13 @@ void DataSampler::ThreadMain()
             break;
         }
 
-        PerformComputations();
+        wakeupTime = RunTasks();
 
         if (APR_SUCCESS != (status = Lock()))
         {
             DisplayError(status, "DataSampler::Threadmain unable to lock mutex");
             break;
         }
-
-        // Compute next wakeup period
-
-        wakeupTime += sleepInterval;
     }
 
     DisplayError(0, "DataSampler::ThreadMain is shutting down");
@@ -320,267 +565,891 @@ void DataSampler::ThreadMain()
 
 /*----------------------------------------------------------------------------*/
 /**
-    Helper routine to determine delta updates and accumulate totals.
+    Helper routine to determine the delta (change) of a counter kept by the
+    Apache server since the last time we ran.
 
-    The purpose of this function is to accumulate totals and determine the
-    delta (change) from the last total to the current total kept by the
-    Apache server. This is necessary because the APR only allows for 32-bit
-    atomic operations, allowing the possibility of numeric overflow.
+    Counters are 64-bit, so they don't wrap in practice; no overflow handling
+    is needed (and unsigned arithmetic would handle a single wrap anyway).
 
-    \param      myCurrentTotal          Grand total (64-bit) for the counter (or NULL)
     \param      myPriorTotal            Previous total (last time we ran),
                                         updated to latest total upon exit
-    \param      myLatestTotal           Latest total from Apache module (atomic)
+    \param      myLatestTotal           Latest total from Apache module
 
-    \returns    Difference between myLatestTotal and myPriorTotal, accounting
-                for numeric overflows.
+    \returns    Difference between myLatestTotal and myPriorTotal
 */
 
-static apr_uint32_t DeltaHelper(apr_uint64_t *myCurrentTotal, apr_uint32_t *myPriorTotal, volatile apr_uint32_t *myLatestTotal)
+static apr_uint64_t CounterDelta(mmap_counter64 *myPriorTotal, apr_uint64_t myLatestTotal)
 {
-    apr_uint32_t currentDelta;
-    apr_uint32_t priorTotal = *myPriorTotal;
-    apr_uint32_t latestTotal = apr_atomic_read32(myLatestTotal);
+    apr_uint64_t currentDelta = myLatestTotal - *myPriorTotal;
 
-    // Did we roll over (APR only keeps 32-bit atomics)
-    if (priorTotal > latestTotal)
+    *myPriorTotal = myLatestTotal;
+    return currentDelta;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Sample the CPU time and resident memory of the Apache server and each of
+    its live child processes (as listed by Apache in the region, by scoreboard
+    slot).
+
+    The server's CPU time includes the time of reaped children; when a child
+    exits, its time moves from the children to the server, so the total only
+    ever grows.
+
+    \param      data                    Data collector attached to the region
+
+    \returns    true if the Apache server process could be read
+*/
+
+bool DataSampler::SampleProcessTree(ApacheDataCollector& data)
+{
+    ProcessTree::Usage usage;
+
+    if (! m_processTree.Read(0, data.GetServerPID(), usage))
     {
-        currentDelta = (std::numeric_limits<apr_uint32_t>::max() - priorTotal) + latestTotal + 1;
+        DisplayError(0, "DataSampler::SampleProcessTree unable to read status of Apache server process");
+        return false;
     }
-    else
+
+    apr_uint64_t ticks = usage.ticks + usage.reapedTicks;
+    apr_uint64_t residentPages = usage.residentPages;
+    apr_uint64_t childResidentPages = 0;
+    apr_uint32_t childProcesses = 0;
+
+    m_childTicks = 0;
+    volatile apr_uint32_t *pids = data.GetChildPids();
+    for (apr_size_t i = 0; i < data.GetChildPidCount(); i++)
     {
-        currentDelta = latestTotal - priorTotal;
+        if (m_processTree.Read(i + 1, static_cast<pid_t>(apr_atomic_read32(&pids[i])), usage))
+        {
+            ticks += usage.ticks;
+            m_childTicks += usage.intervalTicks;
+            childResidentPages += usage.residentPages;
+            childProcesses++;
+        }
     }
 
-    // Now update values and return the delta
+    apr_uint64_t pageSize = static_cast<apr_uint64_t>(sysconf(_SC_PAGESIZE));
 
-    *myPriorTotal = *myLatestTotal;
-    if (myCurrentTotal != NULL)
+    data.m_server_data->currentCpuUtilization = ticks;
+    MMAP_ATOMIC_SET64(&data.m_server_data->residentBytes, (residentPages + childResidentPages) * pageSize);
+    MMAP_ATOMIC_SET64(&data.m_server_data->childResidentBytes, childResidentPages * pageSize);
+    apr_atomic_set32(&data.m_server_data->childProcesses, childProcesses);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Compute the per-second and per-minute rates for each virtual host from the
+    change in its counters since the last time we ran.
+
+    \param      stats                   Array of virtual host statistics to compute
+    \param      counters                Array of current counters for each virtual host
+    \param      count                   Number of elements in stats and counters
+    \param      deltaTime               Time since the last computation
+*/
+
+void DataSampler::ComputeVHostStatistics(mmap_vhost_statistics *stats, const mmap_vhost_counters *counters,
+                                         apr_size_t count, apr_interval_time_t deltaTime)
+{
+    // Scheduling oddity - no rates to compute
+    if (deltaTime <= 0)
     {
-        *myCurrentTotal += currentDelta;
+        return;
     }
 
-    return currentDelta;
+    for (apr_size_t i = 0; i < count; i++)
+    {
+        apr_uint64_t deltaRequests, deltaBytes;
+
+        // Determine deltas for each of RequestsTotal and RequestsBytesTotal
+
+        deltaRequests = CounterDelta(&stats[i].priorCounters.requestsTotal, counters[i].requestsTotal);
+        deltaBytes = CounterDelta(&stats[i].priorCounters.requestsBytes, counters[i].requestsBytes);
+
+        // RequestsPerSecond: Delta # of requests / # of seconds since last run
+        apr_atomic_set32(&stats[i].requestsPerSecond, (deltaRequests * APR_USEC_PER_SEC) / deltaTime);
+        // kbPerRequest: Total KB (delta) / # of requests (delta); KB = Total bytes (delta) / 1024
+        apr_atomic_set32(&stats[i].kbPerRequest, ( deltaRequests ? (deltaBytes / 1024) / deltaRequests : 0));
+        // kbPerSecond: Total KB (delta) / # of seconds since last run
+        apr_atomic_set32(&stats[i].kbPerSecond, ((deltaBytes / 1024) * APR_USEC_PER_SEC) / deltaTime);
+
+        // responsesPerMinute[] = (responseDelta / (# of seconds since last run)) * 60. (the idea is to normalize to a per-minute rate)
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            apr_uint64_t delta = CounterDelta(&stats[i].priorCounters.responses[r], counters[i].responses[r]);
+            apr_atomic_set32(&stats[i].responsesPerMinute[r], ((delta * 60 * APR_USEC_PER_SEC) / deltaTime));
+        }
+    }
 }
 
-bool DataSampler::GetApacheTickCount(ApacheDataCollector& data)
+/*----------------------------------------------------------------------------*/
+/**
+    Compute the latency percentiles for a virtual host from its histogram for
+    the interval.  Percentiles are reported as the upper limit of the bucket
+    they fall into (or the maximum, if that is in the same bucket).
+
+    \param      stats                   Virtual host statistics to update
+    \param      latency                 Latency histogram for the interval
+*/
+
+void DataSampler::ComputeLatencyStatistics(mmap_vhost_statistics& stats, const mmap_vhost_latency& latency)
 {
-    LinuxProcStat ps;
-    char procStatName[64];
+    static const apr_uint32_t percentiles[] = { 50, 95, 99 };
+    volatile apr_uint32_t *results[] = { &stats.latencyP50, &stats.latencyP95, &stats.latencyP99 };
 
-    apr_file_t* fp;
-    apr_pool_t *pool = data.GetPool();
-    apr_status_t status;
+    apr_uint64_t count = 0;
+    for (apr_size_t b = 0; b < MMAP_LATENCY_BUCKETS; b++)
+    {
+        count += latency.buckets[b];
+    }
 
-    apr_snprintf(procStatName, sizeof(procStatName), "/proc/%d/stat", data.m_server_data->serverPid);
-    if ( APR_SUCCESS != (status = apr_file_open(&fp, procStatName, APR_FOPEN_READ, 0, pool)) )
+    apr_size_t bucket = 0;
+    apr_uint64_t seen = 0;
+    for (size_t p = 0; p < sizeof(percentiles) / sizeof(percentiles[0]); p++)
     {
-        char *text = apr_psprintf(pool,
-                                  "DataSampler::GetApacheTickCount skipping execution due to file open error on %s",
-                                  procStatName);
-        DisplayError(status, text);
+        // Rank (1-based) of the percentile: ceiling of count * percentile / 100
+        apr_uint64_t rank = (count * percentiles[p] + 99) / 100;
+        apr_uint32_t value = 0;
 
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+        if (count)
+        {
+            while (seen + latency.buckets[bucket] < rank)
+            {
+                seen += latency.buckets[bucket++];
+            }
+
+            value = mmap_latency_bucket_limit(bucket);
+            if (latency.maxLatency && mmap_latency_bucket(latency.maxLatency) == bucket)
+            {
+                value = latency.maxLatency;
+            }
+        }
+
+        apr_atomic_set32(results[p], value);
     }
 
-    // We used to parse by reading bytes, but this can be problematic if
-    // process names contain "(" or ")" (which was found on SuSE 12).
-    //
-    // Read the entire thing into a buffer and use sscanf to parse it.
-    // This allows us to search for "(" (start of process name), and
-    // reverse search for ")" (end of process name), and not care what
-    // is in the middle.
+    apr_atomic_set32(&stats.latencyMax, latency.maxLatency);
+}
 
-    char buffer[1024];
-    apr_size_t bufferSize = sizeof(buffer) - 1;
+static bool MoreRequests(const mmap_topurl_result& a, const mmap_topurl_result& b)
+{
+    return a.requests > b.requests;
+}
 
-    if ( APR_SUCCESS != (status = apr_file_read(fp, buffer, &bufferSize)) )
+static bool MoreBytes(const mmap_topurl_result& a, const mmap_topurl_result& b)
+{
+    return a.bytes > b.bytes;
+}
+
+// Order for results: top URLs by requests, then the remaining top URLs by bytes, then unranked URLs
+static apr_uint64_t ResultOrder(const mmap_topurl_result& result)
+{
+    if (result.rankByRequests)
     {
-        DisplayError(status, "DataSampler::GetApacheTickCount encountered error reading status file");
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+        return result.rankByRequests;
     }
 
-    // Less than 32 bytes read; that's not possible unless something is really wrong
-    if (bufferSize < 32) {
-        char *text = apr_psprintf(pool,
-                                  "DataSampler::GetApacheTickCount Getting very short contents reading %s file. "
-                                  "Expecing minimum of 32 bytes but got %pS bytes.",
-                                  procStatName, &bufferSize);
-        DisplayError(0, text);
+    return result.rankByBytes ? (static_cast<apr_uint64_t>(1) << 32) + result.rankByBytes : static_cast<apr_uint64_t>(1) << 33;
+}
 
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+static bool BetterRank(const mmap_topurl_result& a, const mmap_topurl_result& b)
+{
+    return ResultOrder(a) < ResultOrder(b);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Rank the URLs counted for a virtual host during the interval, and store
+    the top URLs by requests and by bytes in its results.
+
+    \param      urls                    URLs counted during the interval (reordered)
+    \param      count                   Number of top URLs to rank by each measure
+    \param      results                 Results for the virtual host (2 * count elements)
+*/
+
+void DataSampler::RankTopUrls(std::vector<mmap_topurl_result>& urls, apr_size_t count, mmap_topurl_result *results)
+{
+    apr_size_t top = std::min(count, urls.size());
+    apr_size_t used = 0;
+
+    std::partial_sort(urls.begin(), urls.begin() + top, urls.end(), MoreRequests);
+    for (apr_size_t i = 0; i < top; i++)
+    {
+        urls[i].rankByRequests = static_cast<apr_uint32_t>(i + 1);
     }
 
-    // We have some data, so parse it
-    buffer[bufferSize] = '\0';
-    apr_file_close(fp);
+    std::partial_sort(urls.begin(), urls.begin() + top, urls.end(), MoreBytes);
+    for (apr_size_t i = 0; i < top; i++)
+    {
+        urls[i].rankByBytes = static_cast<apr_uint32_t>(i + 1);
+    }
 
-    int nscanned = sscanf(buffer, "%d", &ps.processId);
-    if (nscanned != 1) {
-        char *text = apr_psprintf(pool,
-                                  "DataSampler::GetApacheTickCount Getting wrong number of parameters from %s file. "
-                                  "Expecing 1 but getting %d.",
-                                  procStatName, nscanned);
-        DisplayError(0, text);
+    std::sort(urls.begin(), urls.end(), BetterRank);
+    for (; used < urls.size() && used < 2 * count && (urls[used].rankByRequests || urls[used].rankByBytes); used++)
+    {
+        results[used] = urls[used];
+    }
 
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+    memset(results + used, 0, sizeof(mmap_topurl_result) * (2 * count - used));
+}
+
+void DataSampler::ComputeTopUrls(ApacheDataCollector& data)
+{
+    apr_size_t count = data.GetTopUrlCount();
+    std::vector<mmap_topurl_result> urls;
+
+    if (0 == count)
+    {
+        return;
     }
 
-    // Now go for the process name "(processname)", but search for starting
-    // "(" and last ")" to handle processes that contain "(" or ")" bytes.
-    const char* procStart = strchr(buffer, '(');
-    const char* procEnd = strrchr(buffer, ')');
-    if (NULL == procStart || NULL == procEnd || procStart > procEnd || (procEnd - procStart) > 28)
+    // Top URLs are kept for each virtual host (not for _Total)
+    for (apr_size_t i = 1; i < data.GetVHostCount(); i++)
     {
-        char *text = apr_psprintf(pool,
-                                  "DataSampler::GetApacheTickCount Unexpended error parsing  %s file, file contents: %s",
-                                  procStatName, buffer);
-        DisplayError(0, text);
+        data.TakeTopUrls(i, urls);
+        RankTopUrls(urls, count, data.GetTopUrlResults(i));
+    }
+}
 
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+/*----------------------------------------------------------------------------*/
+/**
+    Estimate the number of unique clients counted in a set of HyperLogLog
+    registers (using linear counting for small cardinalities).
+
+    \param      registers               MMAP_HLL_REGISTERS registers
+
+    \returns    Estimated number of unique clients
+*/
+
+apr_uint32_t DataSampler::EstimateUniqueClients(const unsigned char *registers)
+{
+    const double m = MMAP_HLL_REGISTERS;
+    double sum = 0;
+    apr_size_t zeros = 0;
+
+    for (apr_size_t i = 0; i < MMAP_HLL_REGISTERS; i++)
+    {
+        sum += ldexp(1.0, -registers[i]);
+        zeros += (0 == registers[i]);
     }
 
-    size_t endByte = procEnd - procStart - 1;
-    const char* remainingPtr = procEnd + 2;
-    memcpy(ps.command, procStart + 1, endByte);
-    ps.command[endByte] = '\0';
-
-    nscanned = sscanf(remainingPtr, ps.scanstring,
-                      &ps.state, &ps.parentProcessId, &ps.processGroupId,
-                      &ps.sessionId, &ps.controllingTty, &ps.terminalProcessId, &ps.flags, &ps.minorFaults,
-                      &ps.childMinorFaults, &ps.majorFaults, &ps.childMajorFaults, &ps.userTime, &ps.systemTime,
-                      &ps.childUserTime, &ps.childSystemTime, &ps.priority, &ps.nice, &ps.intervalTimerValue,
-                      &ps.startTime, &ps.virtualMemSizeBytes, &ps.residentSetSize, &ps.residentSetSizeLimit,
-                      &ps.startAddress, &ps.endAddress, &ps.startStackAddress, &ps.kernelStackPointer, 
-                      &ps.kernelInstructionPointer, &ps.signal, &ps.blocked, &ps.sigignore, &ps.sigcatch, 
-                      &ps.waitChannel, &ps.numPagesSwapped, &ps.cumNumPagesSwapped, &ps.exitSignal, 
-                      &ps.processorNum, &ps.realTimePriority, &ps.schedulingPolicy);
-
-    // -2 since we read pid and name separatly
-    if (nscanned != ps.procstat_len-2) {
-        char *text = apr_psprintf(pool,
-                                  "DataSampler::GetApacheTickCount Getting wrong number of parameters from %s file. "
-                                  "Expecting %d, but getting %d.",
-                                  procStatName, ps.procstat_len - 2, nscanned);
+    double estimate = (0.7213 / (1 + 1.079 / m)) * m * m / sum;
+    if (estimate <= 2.5 * m && zeros != 0)
+    {
+        estimate = m * log(m / zeros);
+    }
+
+    return static_cast<apr_uint32_t>(estimate + 0.5);
+}
+
+void DataSampler::ComputeUniqueClients(ApacheDataCollector& data)
+{
+    unsigned char interval[MMAP_HLL_REGISTERS], totalInterval[MMAP_HLL_REGISTERS];
+    mmap_vhost_statistics *stats = data.GetVHostStatistics();
+    apr_time_exp_t now;
+
+    if (! data.HasVHostClients())
+    {
+        return;
+    }
+
+    // Daily registers start over at local midnight
+    apr_time_exp_lt(&now, apr_time_now());
+    if (data.GetClientsDay() != now.tm_year * 1000 + now.tm_yday)
+    {
+        for (apr_size_t i = 0; i < data.GetVHostCount(); i++)
+        {
+            memset(data.GetVHostClients(i)->day, 0, MMAP_HLL_REGISTERS);
+        }
+        data.SetClientsDay(now.tm_year * 1000 + now.tm_yday);
+    }
+
+    // Apache never records _Total; its registers are the union of the other hosts
+    memset(totalInterval, 0, sizeof(totalInterval));
+    for (apr_size_t i = 1; i < data.GetVHostCount(); i++)
+    {
+        unsigned char *day = data.GetVHostClients(i)->day;
+
+        data.TakeVHostClients(i, interval);
+        for (apr_size_t r = 0; r < MMAP_HLL_REGISTERS; r++)
+        {
+            day[r] = std::max(day[r], interval[r]);
+            totalInterval[r] = std::max(totalInterval[r], interval[r]);
+        }
+
+        apr_atomic_set32(&stats[i].uniqueClients, EstimateUniqueClients(interval));
+        apr_atomic_set32(&stats[i].uniqueClientsToday, EstimateUniqueClients(day));
+    }
+
+    unsigned char *totalDay = data.GetVHostClients(0)->day;
+    for (apr_size_t r = 0; r < MMAP_HLL_REGISTERS; r++)
+    {
+        totalDay[r] = std::max(totalDay[r], totalInterval[r]);
+    }
+
+    apr_atomic_set32(&stats[0].uniqueClients, EstimateUniqueClients(totalInterval));
+    apr_atomic_set32(&stats[0].uniqueClientsToday, EstimateUniqueClients(totalDay));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Decode the per-request trace records written by the Apache module (when
+    CimSetLogging is On) and log them.  Formatting happens here, rather than
+    in Apache while serving the request.
+
+    \param      data                    Data collector attached to the region
+*/
+
+void DataSampler::LogTraceRecords(ApacheDataCollector& data)
+{
+    mmap_trace_record records[64];
+    apr_size_t count;
+
+    while (0 != (count = ApacheDataCollector::ReadTraceRecords(data.GetTraceRing(), m_traceCursor,
+                                                               records, sizeof(records) / sizeof(records[0]))))
+    {
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            char dateStr[APR_CTIME_LEN];
+            char text[512];
+
+            const char *serverName = records[i].vhost < data.GetVHostCount()
+                ? data.GetVHostName(records[i].vhost) : "NULL";
+
+            apr_ctime(dateStr, records[i].timestamp);
+            apr_snprintf(text, sizeof(text),
+                         "DataSampler: Access result: [%s] Name=%s, status=%u, index=%u, bytes=%" APR_UINT64_T_FMT
+                         ", duration=%uus, pid=%u%s",
+                         dateStr, serverName, records[i].status, records[i].vhost, records[i].bytes,
+                         records[i].duration, records[i].pid,
+                         (records[i].flags & MMAP_TRACE_ABORTED) ? ", aborted" : "");
+
+            // Asked for (with CimSetLogging), so not rate limited
+            DisplayMessage(ProviderLogger::LevelInfo, text, false);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Free dynamic host slots (CimDynamicHosts) that have seen no requests for
+    a while, so new Host header values can claim them.  Eviction takes two
+    passes: a host is marked first (so Apache stops finding it), and reset on
+    a later pass, once requests that found it before it was marked have been
+    counted.  This runs after the statistics are computed, so the final
+    interval of an evicted host still counts toward _Total.
+
+    \param      data                    Data collector attached to the region
+*/
+
+void DataSampler::EvictIdleDynamicHosts(ApacheDataCollector& data)
+{
+    apr_time_t now = apr_time_now();
+    apr_uint32_t idleSince = static_cast<apr_uint32_t>(apr_time_sec(now) - MMAP_DYNAMIC_HOST_IDLE_SECONDS);
+    std::vector<std::pair<apr_size_t, apr_time_t> > stillMarked;
+    apr_size_t evicted = 0;
+
+    // Reset the hosts marked long enough ago
+    for (size_t i = 0; i < m_evictingHosts.size(); i++)
+    {
+        apr_size_t item = m_evictingHosts[i].first;
+
+        if (now - m_evictingHosts[i].second < s_evictionGrace)
+        {
+            stillMarked.push_back(m_evictingHosts[i]);
+            continue;
+        }
+
+        data.EvictDynamicHost(item);
+
+        // The counters start over, and so does the history (_Total keeps the counters of
+        // evicted hosts, so its prior values and history carry on unchanged)
+        memset(&m_historyCounters[item], 0, sizeof(mmap_vhost_counters));
+        for (int r = 0; r < MMAP_RATE_COUNT; r++)
+        {
+            m_rateHistory.Clear(item * MMAP_RATE_COUNT + r);
+        }
+        evicted++;
+    }
+    m_evictingHosts.swap(stillMarked);
+
+    // Then mark the hosts that have gone idle
+    for (apr_size_t i = 0; i < data.GetDynamicHostCount(); i++)
+    {
+        apr_size_t item = data.GetDynamicHostBase() + i;
+
+        if (data.MarkDynamicHostEvicting(item, idleSince))
+        {
+            m_evictingHosts.push_back(std::make_pair(item, now));
+        }
+    }
+
+    if (evicted)
+    {
+        char text[128];
+        apr_snprintf(text, sizeof(text), "DataSampler: Evicted %" APR_SIZE_T_FMT " idle dynamic hosts", evicted);
         DisplayError(0, text);
+    }
+}
 
-        data.m_server_data->currentCpuUtilization = 0;
-        return false;
+/*----------------------------------------------------------------------------*/
+/**
+    Compute the CPU utilization of Apache over an interval, as a percentage of
+    the capacity of all processors.
+
+    Apache made the computation like this:
+      ap_rprintf(r, "CPULoad: %g\n", (tu + ts + tcu + tcs) / tick / up_time * 100.);
+
+    \param      deltaTicks              CPU time (in clock ticks) used over the interval
+    \param      ticksPerSecond          Clock ticks per second
+    \param      logicalProcs            Number of logical processors
+    \param      elapsed                 Length of the interval
+
+    \returns    Percentage of CPU capacity used (0 to 100)
+*/
+
+apr_uint32_t DataSampler::ComputePercentCPU(apr_uint64_t deltaTicks, long ticksPerSecond, int logicalProcs,
+                                            apr_interval_time_t elapsed)
+{
+    apr_uint64_t capacity = static_cast<apr_uint64_t>(logicalProcs) * ticksPerSecond * elapsed;
+
+    if (0 == capacity)
+    {
+        return 0;
     }
 
-    data.m_server_data->currentCpuUtilization = ps.userTime + ps.systemTime + ps.childUserTime + ps.childSystemTime;
-    return true;
+    apr_uint64_t percentBusy = (deltaTicks * 100 * APR_USEC_PER_SEC + capacity / 2) / capacity;
+    return static_cast<apr_uint32_t>(std::min(percentBusy, static_cast<apr_uint64_t>(100)));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Take a baseline of the counters that rates are computed from, so the
+    first rates after attaching cover only the (short) bootstrap interval.
+    The prior values in the region may be stale: the region may be new, or
+    we may not have sampled it for a while.
+
+    \param      data                    Data collector attached to the region
+    \param      currentTime             Time of the baseline
+*/
+
+void DataSampler::Bootstrap(ApacheDataCollector& data, apr_time_t currentTime)
+{
+    DisplayError(0, "DataSampler::Bootstrap taking baseline sample");
+
+    // Apache rebuilt the region since we last ran; its trace ring starts over
+    if (data.GetGeneration() != m_generation)
+    {
+        m_generation = data.GetGeneration();
+        m_traceCursor = 0;
+    }
+
+    // Child process slots change only with the region
+    m_processTree.Reset(data.GetChildPidCount() + 1);
+
+    // Dynamic hosts left marked for eviction (by an earlier run of the provider) are reset a while from now
+    m_evictingHosts.clear();
+    for (apr_size_t i = 0; i < data.GetDynamicHostCount(); i++)
+    {
+        apr_size_t item = data.GetDynamicHostBase() + i;
+
+        if (data.IsDynamicHostEvicting(item))
+        {
+            m_evictingHosts.push_back(std::make_pair(item, currentTime));
+        }
+    }
+    if (SampleProcessTree(data))
+    {
+        data.m_server_data->priorCpuUtilization = data.m_server_data->currentCpuUtilization;
+    }
+
+    // Storage for sampling is allocated here, and only here (the number of virtual hosts changes only with the region)
+    apr_size_t count = data.GetVHostCount();
+    m_counters.resize(count);
+    m_historyCounters.resize(count);
+    RemapRateHistory(data);
+
+    mmap_vhost_statistics *stats = data.GetVHostStatistics();
+    for (apr_size_t i = 0; i < count; i++)
+    {
+        mmap_vhost_counters& counters = m_historyCounters[i];
+        data.GetVHostCounters(i, counters);
+
+        stats[i].priorCounters.requestsTotal = counters.requestsTotal;
+        stats[i].priorCounters.requestsBytes = counters.requestsBytes;
+        for (int r = 0; r < MMAP_RESPONSE_COUNT; r++)
+        {
+            stats[i].priorCounters.responses[r] = counters.responses[r];
+        }
+    }
+
+    // Rate tasks sample again shortly; everything else runs now
+    for (size_t t = 0; t < m_tasks.size(); t++)
+    {
+        m_tasks[t].lastRun = currentTime;
+        m_tasks[t].nextRun = currentTime + (m_tasks[t].computesRates ? s_bootstrapInterval : 0);
+    }
+
+    m_fBootstrapped = true;
 }
 
-void DataSampler::PerformComputations()
+/*----------------------------------------------------------------------------*/
+/**
+    Size the rate history for the virtual hosts of the region.  When Apache
+    rebuilds the region on restart, hosts that are still configured (matched
+    by instance ID) and the server keep their history; other hosts start
+    empty.  Dynamic hosts always start empty, as their slots are reassigned.
+    Nothing is kept if the server itself was restarted.
+
+    \param      data                    Data collector attached to the region
+*/
+
+void DataSampler::RemapRateHistory(ApacheDataCollector& data)
+{
+    apr_size_t count = data.GetVHostCount();
+    apr_size_t series = count * MMAP_RATE_COUNT + 2;
+    std::vector<std::string> instanceIDs(count);
+
+    for (apr_size_t i = 0; i < count; i++)
+    {
+        if (! data.IsDynamicHost(i))
+        {
+            instanceIDs[i] = data.GetVHostInstanceID(i);
+        }
+    }
+
+    // The server restarted (or this is the first region we sampled): start over
+    if (data.GetServerPID() != m_historyServerPid || m_rateHistory.GetSeriesCount() < 2)
+    {
+        m_rateHistory.Reset(series);
+    }
+    else
+    {
+        // Hosts of the current history, by instance ID
+        std::vector<std::pair<std::string, apr_size_t> > previous;
+        for (apr_size_t i = 0; i < m_historyInstanceIDs.size(); i++)
+        {
+            if (! m_historyInstanceIDs[i].empty())
+            {
+                previous.push_back(std::make_pair(m_historyInstanceIDs[i], i));
+            }
+        }
+        std::sort(previous.begin(), previous.end());
+
+        std::vector<apr_size_t> from(series, RateHistory::NoSeries);
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            std::vector<std::pair<std::string, apr_size_t> >::const_iterator match =
+                std::lower_bound(previous.begin(), previous.end(), std::make_pair(instanceIDs[i], static_cast<apr_size_t>(0)));
+
+            if (! instanceIDs[i].empty() && match != previous.end() && match->first == instanceIDs[i])
+            {
+                for (int r = 0; r < MMAP_RATE_COUNT; r++)
+                {
+                    from[i * MMAP_RATE_COUNT + r] = match->second * MMAP_RATE_COUNT + r;
+                }
+            }
+        }
+
+        // The server's series follow those of the hosts
+        from[series - 2] = m_rateHistory.GetSeriesCount() - 2;
+        from[series - 1] = m_rateHistory.GetSeriesCount() - 1;
+
+        m_rateHistory.Remap(from);
+    }
+
+    m_historyInstanceIDs.swap(instanceIDs);
+    m_historyServerPid = data.GetServerPID();
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Run each task that is due.
+
+    \returns    Time at which the next task is due
+*/
+
+apr_time_t DataSampler::RunTasks()
 {
     apr_time_t currentTime = apr_time_now();
-    apr_interval_time_t deltaTime = currentTime - m_timeLastUpdated;
 
-    // Scheduling oddity - just update time and return
-    if (apr_time_sec(deltaTime) < 1)
+    ApacheDataCollector data;
+    if (APR_SUCCESS != data.Attach("DataSampler::RunTasks"))
     {
-        DisplayError(0, "DataSampler::PerformComputations skipping execution due to thread scheduling issue");
-        m_timeLastUpdated = currentTime;
-        return;
+        // Apache must not be running; look again in a bit, and start over when it is
+        m_fBootstrapped = false;
+        return currentTime + s_attachRetryInterval;
     }
 
-    DisplayError(0, "DataSampler::PerformComputations executing");
+    if (! m_fBootstrapped || data.GetGeneration() != m_generation)
+    {
+        Bootstrap(data, currentTime);
+    }
 
-    ApacheDataCollector data = g_pFactory->DataCollectorFactory();
-    if (APR_SUCCESS != data.Attach("DataSampler::PerformComputations"))
+    apr_time_t wakeupTime = currentTime + s_attachRetryInterval;
+    for (size_t t = 0; t < m_tasks.size(); t++)
     {
-        // Apache must not be running; pick it up next time 'round
-        return;
+        Task& task = m_tasks[t];
+
+        if (task.nextRun <= currentTime)
+        {
+            if (IsLogging(ProviderLogger::LevelDebug))
+            {
+                char text[128];
+                apr_snprintf(text, sizeof(text), "DataSampler::RunTasks executing %s", task.name);
+                DisplayMessage(ProviderLogger::LevelDebug, text);
+            }
+
+            // Rates are computed over the actual interval, which may be longer than scheduled
+            (this->*task.run)(data, currentTime - task.lastRun);
+            task.lastRun = currentTime;
+
+            // If we got scheduled "late", compensate next time around (but never run to catch up)
+            task.nextRun += task.interval;
+            if (task.nextRun <= currentTime)
+            {
+                task.nextRun = currentTime + task.interval;
+            }
+        }
+
+        wakeupTime = std::min(wakeupTime, task.nextRun);
     }
 
-    // Compute the CPU time utilized for Apache server
-    //
-    // Apache made the computation like this:
-    //   ap_rprintf(r, "CPULoad: %g\n", (tu + ts + tcu + tcs) / tick / up_time * 100.);
-    //
-    // mod_cimprov.c stores (tu + ts + tcu + tcs) in apacheCpuUtilization.  We take that,
-    // massage it, and store the percentCPU in the memory map for provider to access.
+    return wakeupTime;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Compute the CPU time and memory used by the Apache server and its child
+    processes, and copy the "volatile" Apache idle/busy counters to values that
+    are updated periodically.
 
-    int ticks;
+    SampleProcessTree() stores the total CPU time (in ticks) in currentCpuUtilization.
+    We take that, massage it, and store the percentCPU in the memory map for provider to access.
 
-    if ( GetApacheTickCount(data) )
+    \param      data                    Data collector attached to the region
+    \param      elapsed                 Time since the task last ran
+*/
+
+void DataSampler::SampleServer(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    if ( SampleProcessTree(data) )
     {
 #ifdef _SC_CLK_TCK
-        ticks = sysconf(_SC_CLK_TCK);
+        long ticks = sysconf(_SC_CLK_TCK);
 #else
-        ticks = HZ;
+        long ticks = HZ;
 #endif
 
-        apr_uint32_t deltaTicks = DeltaHelper(NULL, &data.m_server_data->priorCpuUtilization, &data.m_server_data->currentCpuUtilization);
+        // A child that exits before Apache reaps it drops out of the total for a moment
+        apr_uint64_t current = data.m_server_data->currentCpuUtilization;
+        apr_uint64_t prior = data.m_server_data->priorCpuUtilization;
+        apr_uint64_t deltaTicks = current > prior ? current - prior : 0;
+        data.m_server_data->priorCpuUtilization = current;
         int logicalProcs = sysconf(_SC_NPROCESSORS_ONLN);
-        int percentBusy = ((deltaTicks + (ticks/2)) * 100) / (logicalProcs * ticks * 60);
-        apr_atomic_set32(&data.m_server_data->percentCPU, std::min(percentBusy, 100));
+        apr_atomic_set32(&data.m_server_data->percentCPU, ComputePercentCPU(deltaTicks, ticks, logicalProcs, elapsed));
+
+        // Average of the children, as a percentage of the capacity of all processors (like percentCPU)
+        apr_uint32_t children = apr_atomic_read32(&data.m_server_data->childProcesses);
+        apr_atomic_set32(&data.m_server_data->childPercentCPU,
+                         children ? ComputePercentCPU(m_childTicks, ticks, logicalProcs * children, elapsed) : 0);
     }
     else
     {
         // Whoops, some sort of error ...
         apr_atomic_set32(&data.m_server_data->percentCPU, 0);
+        apr_atomic_set32(&data.m_server_data->childPercentCPU, 0);
+        apr_atomic_set32(&data.m_server_data->childProcesses, 0);
+        MMAP_ATOMIC_SET64(&data.m_server_data->residentBytes, 0);
+        MMAP_ATOMIC_SET64(&data.m_server_data->childResidentBytes, 0);
     }
 
-    // Copy from "volatile" Apache idle/busy counters to values that are updated once/minute
-
     apr_atomic_set32(&data.m_server_data->idleWorkers, apr_atomic_read32(&data.m_server_data->idleApacheWorkers));
     apr_atomic_set32(&data.m_server_data->busyWorkers, apr_atomic_read32(&data.m_server_data->busyApacheWorkers));
+}
 
-    //
-    // Walk the virtual hosts and update the virtual host statistics
-    //
+/*----------------------------------------------------------------------------*/
+/**
+    Walk the virtual hosts and update the virtual host statistics.
 
-    // TODO: Lock the process mutex (thread mutex?  Don't think we need process mutex for virtual hosts)
+    \param      data                    Data collector attached to the region
+    \param      elapsed                 Time since the task last ran
+*/
 
-    mmap_vhost_elements *vhosts = data.GetVHostElements();
+void DataSampler::SampleVHosts(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    // Gather the counters once up front (summing counter slabs, if needed)
     for (apr_size_t i = 0; i < data.GetVHostCount(); i++)
     {
-        apr_uint32_t deltaRequests, deltaBytes, delta400, delta500;
+        data.GetVHostCounters(i, m_counters[i]);
+    }
 
-        // Determine deltas for each of RequestsTotal, RequestsBytesTotal, errorCount400Total, and ErrorCount500Total
+    ComputeVHostStatistics(data.GetVHostStatistics(), &m_counters[0], data.GetVHostCount(), elapsed);
 
-        deltaRequests = DeltaHelper(&vhosts[i].requestTotal64, &vhosts[i].requestsTotalPrior, &vhosts[i].requestsTotal);
-        deltaBytes = DeltaHelper(&vhosts[i].requestsBytesTotal64, &vhosts[i].requestsTotalBytesPrior, &vhosts[i].requestsBytes);
-        delta400 = DeltaHelper(&vhosts[i].errorCount400Total64, &vhosts[i].errorCount400TotalPrior, &vhosts[i].errorCount400);
-        delta500 = DeltaHelper(&vhosts[i].errorCount500Total64, &vhosts[i].errorCount500TotalPrior, &vhosts[i].errorCount500);
+    // Latency histograms; Apache never records _Total, so sum it from the other hosts
+    mmap_vhost_latency latency, totalLatency;
+    memset(&totalLatency, 0, sizeof(totalLatency));
+    for (apr_size_t i = 1; i < data.GetVHostCount(); i++)
+    {
+        data.TakeVHostLatency(i, latency);
+        ComputeLatencyStatistics(data.GetVHostStatistics()[i], latency);
 
-        // RequestsPerSecond: Delta # of requests / # of seconds since last run
-        apr_atomic_set32(&vhosts[i].requestsPerSecond, deltaRequests / apr_time_sec(deltaTime));
-        // kbPerRequest: Total KB (delta) / # of requests (delta); KB = Total bytes (delta) / 1024
-        apr_atomic_set32(&vhosts[i].kbPerRequest, ( deltaRequests ? (deltaBytes / 1024) / deltaRequests : 0));
-        // kbPerSecond: Total KB (delta) / # of seconds since last run
-        apr_atomic_set32(&vhosts[i].kbPerSecond, (deltaBytes / 1024) / apr_time_sec(deltaTime));
+        for (apr_size_t b = 0; b < MMAP_LATENCY_BUCKETS; b++)
+        {
+            totalLatency.buckets[b] += latency.buckets[b];
+        }
+        totalLatency.maxLatency = std::max(totalLatency.maxLatency, latency.maxLatency);
+    }
+    ComputeLatencyStatistics(data.GetVHostStatistics()[0], totalLatency);
 
-        // errorsPerMinute* = (errorDelta / (# of seconds since last run)) * 60. (the idea is to normalize to a per-minute rate)
-        apr_atomic_set32(&vhosts[i].errorsPerMinute400, ((delta400 * 60) / apr_time_sec(deltaTime)));
-        apr_atomic_set32(&vhosts[i].errorsPerMinute500, ((delta500 * 60) / apr_time_sec(deltaTime)));
+    ComputeTopUrls(data);
+    ComputeUniqueClients(data);
+    EvictIdleDynamicHosts(data);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Helper routine to determine the change of a counter since the last rate
+    history sample.  Counters can go back: those of an evicted dynamic host
+    start over (and with them a derived _Total).
+
+    \param      prior                   Counter as of the last sample
+    \param      latest                  Latest counter
+
+    \returns    Difference between latest and prior, or zero if it went back
+*/
+
+static apr_uint64_t HistoryDelta(apr_uint64_t prior, apr_uint64_t latest)
+{
+    return latest >= prior ? latest - prior : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Add a sample of each virtual host's rates (and of the server's CPU and
+    busy workers) to the rate history, and publish the averages and peaks.
+    This doesn't allocate memory (Bootstrap() does).
+
+    \param      data                    Data collector attached to the region
+    \param      elapsed                 Time since the task last ran
+*/
+
+void DataSampler::SampleRateHistory(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    apr_size_t count = data.GetVHostCount();
+    mmap_vhost_statistics *stats = data.GetVHostStatistics();
+
+    if (elapsed <= 0 || m_historyCounters.size() != count)
+    {
+        return;
+    }
+
+    for (apr_size_t i = 0; i < count; i++)
+    {
+        mmap_vhost_counters& prior = m_historyCounters[i];
+        mmap_vhost_counters& counters = m_counters[i];
+        apr_size_t series = i * MMAP_RATE_COUNT;
+
+        data.GetVHostCounters(i, counters);
+
+        apr_uint64_t requests = HistoryDelta(prior.requestsTotal, counters.requestsTotal);
+        apr_uint64_t kb = HistoryDelta(prior.requestsBytes, counters.requestsBytes) / 1024;
+        apr_uint64_t errors4xx = HistoryDelta(prior.responses[MMAP_RESPONSE_4XX], counters.responses[MMAP_RESPONSE_4XX]);
+        apr_uint64_t errors5xx = HistoryDelta(prior.responses[MMAP_RESPONSE_5XX], counters.responses[MMAP_RESPONSE_5XX]);
+
+        m_rateHistory.Add(series + MMAP_RATE_REQUESTS, (requests * APR_USEC_PER_SEC) / elapsed);
+        m_rateHistory.Add(series + MMAP_RATE_KB, (kb * APR_USEC_PER_SEC) / elapsed);
+        m_rateHistory.Add(series + MMAP_RATE_ERRORS_4XX, (errors4xx * 60 * APR_USEC_PER_SEC) / elapsed);
+        m_rateHistory.Add(series + MMAP_RATE_ERRORS_5XX, (errors5xx * 60 * APR_USEC_PER_SEC) / elapsed);
+
+        prior = counters;
     }
 
-    // TODO: Unlock the process mutex
+    apr_size_t serverSeries = count * MMAP_RATE_COUNT;
+    m_rateHistory.Add(serverSeries, apr_atomic_read32(&data.m_server_data->percentCPU));
+    m_rateHistory.Add(serverSeries + 1, apr_atomic_read32(&data.m_server_data->busyWorkers));
 
-    // Check if the shared memory region could possibly be "stale".
-    //
-    // This can occur if Apache croaks (without doing normal cleanup), thus
-    // leaving our shared memory segment around. To guard against this, we
-    // check if the region is valid from time to time and, if not, we mark
-    // it invalid. That keeps anyone from using it until Apache restarts.
-    //
-    // Note that the region is always checked if we failed to attach. This
-    // allows immediate recovery of our provider when Apache is restarted.
+    m_rateHistory.Advance();
 
-    if ( ++m_skipValidationCount >= 5 )
+    for (apr_size_t i = 0; i < count; i++)
     {
-        g_pFactory->GetInit()->ValidateSharedMemory(data);
-        m_skipValidationCount = 0;
+        for (int r = 0; r < MMAP_RATE_COUNT; r++)
+        {
+            m_rateHistory.Compute(i * MMAP_RATE_COUNT + r, stats[i].rateHistory[r]);
+        }
     }
+    m_rateHistory.Compute(serverSeries, data.m_server_data->cpuHistory);
+    m_rateHistory.Compute(serverSeries + 1, data.m_server_data->busyWorkersHistory);
+}
 
-    m_timeLastUpdated = currentTime;
-    return;
+void DataSampler::SampleTraceRecords(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    LogTraceRecords(data);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Check if the shared memory region could possibly be "stale".
+
+    This can occur if Apache croaks (without doing normal cleanup), thus
+    leaving our shared memory segment around. To guard against this, we
+    check if the region is valid from time to time and, if not, we mark
+    it invalid. That keeps anyone from using it until Apache restarts.
+
+    Note that the region is always checked if we failed to attach. This
+    allows immediate recovery of our provider when Apache is restarted.
+
+    \param      data                    Data collector attached to the region
+    \param      elapsed                 Time since the task last ran
+*/
+
+void DataSampler::ValidateRegion(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    g_pFactory->GetInit()->ValidateSharedMemory(data);
+}
+
+void DataSampler::RefreshCertificates(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    for (apr_size_t item = 0; item < data.GetCertificateCount(); item++)
+    {
+        data.RefreshCertificate(item);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Log the memory used by the provider: the pools handed out to data
+    collectors, and the heap as a whole, so growth over time can be tracked.
+
+    \param      data                    Data collector attached to the region
+    \param      elapsed                 Time since the task last ran
+*/
+
+void DataSampler::LogMemoryUsage(ApacheDataCollector& data, apr_interval_time_t elapsed)
+{
+    PoolCache::Usage pools;
+    g_pFactory->GetInit()->GetPools().GetUsage(pools);
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 heap = mallinfo2();
+#elif defined(__GLIBC__)
+    struct mallinfo heap = mallinfo();
+#endif
+
+    char text[256];
+    apr_snprintf(text, sizeof(text),
+                 "DataSampler::LogMemoryUsage: pools: %" APR_SIZE_T_FMT " in use, %" APR_SIZE_T_FMT " cached, "
+                 "%" APR_SIZE_T_FMT " created, %" APR_SIZE_T_FMT " destroyed"
+#if defined(__GLIBC__)
+                 "; heap: %" APR_UINT64_T_FMT " bytes in use, %" APR_UINT64_T_FMT " bytes free, %" APR_UINT64_T_FMT " bytes mapped"
+#endif
+                 , pools.inUse, pools.cached, pools.created, pools.destroyed
+#if defined(__GLIBC__)
+                 , static_cast<apr_uint64_t>(heap.uordblks) + static_cast<apr_uint64_t>(heap.hblkhd),
+                 static_cast<apr_uint64_t>(heap.fordblks),
+                 static_cast<apr_uint64_t>(heap.hblkhd)
+#endif
+                 );
+    DisplayError(0, text);
 }
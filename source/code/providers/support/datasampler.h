@@ -39,8 +39,99 @@
 #include <apr_thread_mutex.h>
 #include <apr_thread_proc.h>
 
+#include "mmap_region.h"
+
+#include <sys/types.h>
+#include <string>
+#include <utility>
+#include <vector>
+
 class ApacheDataCollector;
 
+/*------------------------------------------------------------------------------*/
+/**
+ *   RateHistory
+ *   Fixed-size history of rate samples for a number of series (each rate of
+ *   each virtual host), from which averages and peaks over the windows of
+ *   mmap_rate_history are computed.  Recent samples are kept individually;
+ *   older ones are kept as per-minute averages and peaks.  Storage is only
+ *   allocated by Reset() and Remap(), never while sampling.
+ */
+
+class RateHistory
+{
+public:
+    static const apr_size_t SamplesPerMinute = 6;
+    static const apr_size_t Minutes = 60;
+    static const apr_uint32_t WindowMinutes[MMAP_RATE_WINDOWS];
+    static const apr_size_t NoSeries = ~static_cast<apr_size_t>(0);
+
+    RateHistory() : m_series(0), m_sampleHead(0), m_sampleCount(0), m_minuteHead(0), m_minuteCount(0) {}
+
+    void Reset(apr_size_t series);
+    void Remap(const std::vector<apr_size_t>& from);
+    apr_size_t GetSeriesCount() const { return m_series; }
+    void Clear(apr_size_t series);
+    void Add(apr_size_t series, apr_uint32_t rate) { m_samples[series * SamplesPerMinute + m_sampleHead] = rate; }
+    void Advance();
+    void Compute(apr_size_t series, mmap_rate_history& history) const;
+
+private:
+    struct Minute
+    {
+        apr_uint32_t average;
+        apr_uint32_t peak;
+    };
+
+    apr_size_t m_series;
+    std::vector<apr_uint32_t> m_samples;    // SamplesPerMinute per series
+    std::vector<Minute> m_minutes;          // Minutes per series
+    apr_size_t m_sampleHead;                // Sample being added
+    apr_size_t m_sampleCount;               // Valid samples (at most SamplesPerMinute)
+    apr_size_t m_minuteHead;                // Next minute to fill
+    apr_size_t m_minuteCount;               // Valid minutes (at most Minutes)
+};
+
+/*------------------------------------------------------------------------------*/
+/**
+ *   ProcessTree
+ *   CPU time and resident memory of the Apache server and its child processes,
+ *   read from /proc/<pid>/stat.  Each slot (the server, then each scoreboard
+ *   process slot) keeps its file open from one sample to the next, until the
+ *   process in the slot changes, and files are parsed in place, so sampling
+ *   doesn't allocate memory.
+ */
+
+class ProcessTree
+{
+public:
+    struct Usage
+    {
+        apr_uint64_t ticks;             // User and system time (clock ticks)
+        apr_uint64_t reapedTicks;       // User and system time of reaped children (clock ticks)
+        apr_uint64_t residentPages;     // Resident set size (pages)
+        apr_uint64_t intervalTicks;     // Change in ticks since the slot was last read (all of them for a new process)
+    };
+
+    ProcessTree() {}
+    ~ProcessTree() { Reset(0); }
+
+    void Reset(apr_size_t slots);
+    bool Read(apr_size_t slot, pid_t pid, Usage& usage);
+
+    static bool ParseStat(const char *buffer, apr_size_t length, Usage& usage);
+
+private:
+    struct Slot
+    {
+        pid_t pid;
+        int fd;                         // Open /proc/<pid>/stat (-1 if none)
+        apr_uint64_t ticks;             // Ticks as of the last read
+    };
+
+    std::vector<Slot> m_slots;
+};
+
 /*------------------------------------------------------------------------------*/
 /**
  *   DataSampler
@@ -56,19 +147,81 @@ public:
     apr_status_t Launch();
     apr_status_t WaitForCompletion();
 
+    static void ComputeVHostStatistics(mmap_vhost_statistics *stats, const mmap_vhost_counters *counters,
+                                       apr_size_t count, apr_interval_time_t deltaTime);
+    static void ComputeLatencyStatistics(mmap_vhost_statistics& stats, const mmap_vhost_latency& latency);
+    static void RankTopUrls(std::vector<mmap_topurl_result>& urls, apr_size_t count, mmap_topurl_result *results);
+    static apr_uint32_t EstimateUniqueClients(const unsigned char *registers);
+    static apr_uint32_t ComputePercentCPU(apr_uint64_t deltaTicks, long ticksPerSecond, int logicalProcs,
+                                          apr_interval_time_t elapsed);
+
 private:
+    // Unit tests drive (and time) sampling passes over a test region
+    friend class Apache_DataSampler_Test;
+
     static void* APR_THREAD_FUNC threadmain(apr_thread_t *tid, void *data);
     apr_status_t Lock();
     apr_status_t Unlock();
     void ThreadMain();
-    bool GetApacheTickCount(ApacheDataCollector& data);
-    void PerformComputations();
+    bool SampleProcessTree(ApacheDataCollector& data);
+    apr_time_t RunTasks();
+    void Bootstrap(ApacheDataCollector& data, apr_time_t currentTime);
+    void RemapRateHistory(ApacheDataCollector& data);
+
+    // Periodic tasks
+    void SampleServer(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void SampleVHosts(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void SampleRateHistory(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void SampleTraceRecords(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void ValidateRegion(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void RefreshCertificates(ApacheDataCollector& data, apr_interval_time_t elapsed);
+    void LogMemoryUsage(ApacheDataCollector& data, apr_interval_time_t elapsed);
+
+    void ComputeTopUrls(ApacheDataCollector& data);
+    void ComputeUniqueClients(ApacheDataCollector& data);
+    void LogTraceRecords(ApacheDataCollector& data);
+    void EvictIdleDynamicHosts(ApacheDataCollector& data);
 
     apr_thread_t *m_tid;
-    apr_time_t m_timeLastUpdated;
 
-    // Support for shared memory validation
-    int m_skipValidationCount;
+    // A task run periodically by the sampler thread
+    struct Task
+    {
+        const char *name;
+        apr_interval_time_t interval;
+        bool computesRates;             // Needs a baseline sample after attaching
+        void (DataSampler::*run)(ApacheDataCollector& data, apr_interval_time_t elapsed);
+        apr_time_t lastRun;
+        apr_time_t nextRun;
+    };
+
+    static const apr_interval_time_t s_bootstrapInterval;
+    static const apr_interval_time_t s_attachRetryInterval;
+    static const apr_interval_time_t s_evictionGrace;
+
+    std::vector<Task> m_tasks;
+    bool m_fBootstrapped;
+
+    // Next trace record to decode from the Apache module
+    apr_uint64_t m_traceCursor;
+
+    // Generation of the region we last sampled (Apache rebuilds it on reload)
+    apr_uint32_t m_generation;
+
+    // Rate history (with the counters as of the last sample), and counters gathered for sampling.
+    // The history of each host is kept across region rebuilds by instance ID.
+    RateHistory m_rateHistory;
+    std::vector<std::string> m_historyInstanceIDs;
+    pid_t m_historyServerPid;
+    std::vector<mmap_vhost_counters> m_historyCounters;
+    std::vector<mmap_vhost_counters> m_counters;
+
+    // Dynamic hosts marked for eviction, with when they were marked (they're reset a while later)
+    std::vector<std::pair<apr_size_t, apr_time_t> > m_evictingHosts;
+
+    // Apache server and child processes, and CPU time of the children over the last sample
+    ProcessTree m_processTree;
+    apr_uint64_t m_childTicks;
 
     // Support for condition (to control thread shutdown)
     apr_thread_mutex_t *m_mutex;
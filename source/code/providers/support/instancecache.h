@@ -0,0 +1,148 @@
+/*
+ *--------------------------------- START OF LICENSE ----------------------------
+ *
+ * Apache Cimprov ver. 1.0
+ *
+ * Copyright (c) Microsoft Corporation
+ *
+ * All rights reserved. 
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may not use
+ * this file except in compliance with the license. You may obtain a copy of the
+ * License at http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+ * MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ * See the Apache Version 2.0 License for specific language governing permissions
+ * and limitations under the License.
+ *
+ *---------------------------------- END OF LICENSE -----------------------------
+ */
+/**
+      \file        instancecache.h
+
+      \brief       Cache of provider instances built from Apache configuration data
+
+      \date        10-16-26
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef INSTANCECACHE_APACHE_H
+#define INSTANCECACHE_APACHE_H
+
+// Apache Portable Runtime definitions
+#include <apr.h>
+#include <apr_errno.h>
+#include <apr_pools.h>
+#include <apr_thread_mutex.h>
+
+#include <vector>
+
+/*------------------------------------------------------------------------------*/
+/**
+ *   InstanceCache
+ *   Keeps the instances a provider builds from configuration data, by item
+ *   (virtual host), so later enumerations needn't build them again.  The
+ *   configuration only changes when Apache builds a new region, so instances
+ *   are kept for one region generation (and separately for keys-only
+ *   enumerations); generation zero (no region) is never cached.  A region's
+ *   configuration data is never rewritten once it's published, so instances
+ *   built from it are good for its generation even if it's retired meanwhile.
+ */
+
+template <class T>
+class InstanceCache
+{
+public:
+    InstanceCache() : m_mutex(NULL)
+    {
+        m_generation[0] = m_generation[1] = 0;
+    }
+
+    // Without Initialize() (or after Shutdown()), nothing is cached
+    apr_status_t Initialize(apr_pool_t* pool)
+    {
+        if (NULL != m_mutex)
+        {
+            return APR_SUCCESS;
+        }
+        return apr_thread_mutex_create(&m_mutex, APR_THREAD_MUTEX_UNNESTED, pool);
+    }
+
+    // Drop the instances (the mutex goes with the pool it was created from)
+    void Shutdown()
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            m_generation[k] = 0;
+            m_entries[k].clear();
+        }
+        m_mutex = NULL;
+    }
+
+    bool Lookup(apr_uint32_t generation, bool keysOnly, apr_size_t item, T& instance)
+    {
+        int k = keysOnly ? 1 : 0;
+        bool found = false;
+
+        if (0 == generation || NULL == m_mutex || APR_SUCCESS != apr_thread_mutex_lock(m_mutex))
+        {
+            return false;
+        }
+
+        if (generation == m_generation[k] && item < m_entries[k].size() && m_entries[k][item].valid)
+        {
+            instance = m_entries[k][item].instance;
+            found = true;
+        }
+
+        apr_thread_mutex_unlock(m_mutex);
+        return found;
+    }
+
+    void Store(apr_uint32_t generation, bool keysOnly, apr_size_t item, const T& instance)
+    {
+        int k = keysOnly ? 1 : 0;
+
+        if (0 == generation || NULL == m_mutex || APR_SUCCESS != apr_thread_mutex_lock(m_mutex))
+        {
+            return;
+        }
+
+        // Instances from an older generation are of no further use
+        if (generation != m_generation[k])
+        {
+            m_entries[k].clear();
+            m_generation[k] = generation;
+        }
+
+        if (item >= m_entries[k].size())
+        {
+            m_entries[k].resize(item + 1);
+        }
+        m_entries[k][item].instance = instance;
+        m_entries[k][item].valid = true;
+
+        apr_thread_mutex_unlock(m_mutex);
+    }
+
+private:
+    struct Entry
+    {
+        Entry() : valid(false) {}
+
+        bool valid;
+        T instance;
+    };
+
+    apr_thread_mutex_t *m_mutex;
+    apr_uint32_t m_generation[2];       // By keysOnly
+    std::vector<Entry> m_entries[2];
+};
+
+#endif /* INSTANCECACHE_APACHE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,440 @@
+/*
+ *--------------------------------- START OF LICENSE ----------------------------
+ *
+ * Apache Cimprov ver. 1.0
+ *
+ * Copyright (c) Microsoft Corporation
+ *
+ * All rights reserved. 
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may not use
+ * this file except in compliance with the license. You may obtain a copy of the
+ * License at http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+ * MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ * See the Apache Version 2.0 License for specific language governing permissions
+ * and limitations under the License.
+ *
+ *---------------------------------- END OF LICENSE -----------------------------
+ */
+/**
+      \file        logger.cpp
+
+      \brief       Leveled, rate-limited, asynchronous logging for the provider
+
+      \date        10-16-26
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <apr.h>
+#include <apr_atomic.h>
+#include <apr_errno.h>
+#include <apr_strings.h>
+#include <apr_thread_proc.h>
+#include <apr_time.h>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "logger.h"
+
+const apr_uint32_t ProviderLogger::QueueSize;
+const apr_size_t ProviderLogger::MessageLength;
+const apr_uint32_t ProviderLogger::SiteCount;
+const apr_uint32_t ProviderLogger::SiteBurst;
+const apr_uint32_t ProviderLogger::SiteInterval;
+
+const apr_interval_time_t ProviderLogger::s_drainInterval = apr_time_from_msec(250);
+const apr_interval_time_t ProviderLogger::s_levelFileInterval = apr_time_from_sec(5);
+
+static const char *s_levelNames[] = { "error", "warning", "info", "debug" };
+
+ProviderLogger::ProviderLogger()
+    : m_level(DefaultLevel), m_enqueue(0), m_dequeue(0),
+      m_thread(NULL), m_fRunning(0), m_logging(0), m_levelFileTime(0)
+{
+    for (apr_uint32_t i = 0; i < QueueSize; i++)
+    {
+        m_queue[i].sequence = i;
+    }
+    memset(m_sites, 0, sizeof(m_sites));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Start writing messages from a thread of our own.
+
+    \param      pool                    Pool for the thread (must outlive Stop())
+
+    \returns    APR_SUCCESS, or the error creating the thread
+*/
+
+apr_status_t ProviderLogger::Start(apr_pool_t* pool)
+{
+    apr_threadattr_t *attr;
+    apr_status_t status;
+
+    if (NULL != m_thread)
+    {
+        return APR_SUCCESS;
+    }
+
+    CheckLevelFile();
+
+    if (APR_SUCCESS != (status = apr_threadattr_create(&attr, pool)))
+    {
+        return status;
+    }
+
+    apr_atomic_set32(&m_fRunning, 1);
+    if (APR_SUCCESS != (status = apr_thread_create(&m_thread, attr, ProviderLogger::threadmain, this, pool)))
+    {
+        apr_atomic_set32(&m_fRunning, 0);
+        m_thread = NULL;
+        return status;
+    }
+
+    return APR_SUCCESS;
+}
+
+// Stop the logging thread, writing anything still queued (later messages are written directly)
+void ProviderLogger::Stop()
+{
+    if (NULL != m_thread)
+    {
+        apr_status_t tstatus;
+
+        apr_atomic_xchg32(&m_fRunning, 0);
+        apr_thread_join(&tstatus, m_thread);
+        m_thread = NULL;
+
+        // Callers that saw the thread running may still be queuing their messages;
+        // once they're done, nothing more is queued
+        while (0 != apr_atomic_read32(&m_logging))
+        {
+            apr_thread_yield();
+        }
+
+        Drain();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Parse a level name ("error", "warning", "info" or "debug", in any case).
+
+    \param      text                    Level name (leading and trailing white space is ignored)
+    \param      level                   Receives the level
+
+    \returns    true if the name was recognized
+*/
+
+bool ProviderLogger::ParseLevel(const char* text, Level& level)
+{
+    while (isspace(static_cast<unsigned char>(*text)))
+    {
+        text++;
+    }
+
+    apr_size_t length = strlen(text);
+    while (length > 0 && isspace(static_cast<unsigned char>(text[length - 1])))
+    {
+        length--;
+    }
+
+    for (int l = LevelError; l <= LevelDebug; l++)
+    {
+        if (strlen(s_levelNames[l]) == length && 0 == strncasecmp(text, s_levelNames[l], length))
+        {
+            level = static_cast<Level>(l);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Log a message, if its level is enabled and its site isn't over its rate.
+
+    \param      level                   Level of the message
+    \param      status                  Error status (zero for status messages)
+    \param      text                    Message text (copied; truncated to MessageLength)
+    \param      site                    Identifies the message site for rate limiting (NULL if not limited)
+*/
+
+void ProviderLogger::Log(Level level, apr_status_t status, const char* text, const void* site)
+{
+    apr_uint32_t suppressed = 0;
+
+    if (! IsEnabled(level) || (NULL != site && ! Admit(site, suppressed)))
+    {
+        return;
+    }
+
+    if (NULL == text)
+    {
+        text = "Unexpected error occurred";
+    }
+
+    // Once started, only write here if the logging thread can't keep up.  Callers
+    // are counted before they look at m_fRunning (and Stop() clears it before it
+    // looks at the count), so Stop() can't drain the queue before a message that
+    // was queued on the strength of the thread running.
+    apr_atomic_inc32(&m_logging);
+    bool fQueued = apr_atomic_read32(&m_fRunning) && Enqueue(status, text, suppressed);
+    apr_atomic_dec32(&m_logging);
+
+    if (! fQueued)
+    {
+        WriteMessage(status, apr_time_now(), text, suppressed);
+        Flush();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Count a message against its site's rate.  Sites are kept in a small open
+    addressed table, claimed by the first message from each site; messages
+    from sites that don't fit aren't limited.  Counting is approximate when
+    messages from one site race at the start of an interval.
+
+    \param      site                    Identifies the message site
+    \param      suppressed              Receives the number of messages suppressed before this one
+
+    \returns    true if the message should be logged
+*/
+
+bool ProviderLogger::Admit(const void* site, apr_uint32_t& suppressed)
+{
+    apr_uint32_t start = static_cast<apr_uint32_t>((reinterpret_cast<unsigned long>(site) >> 2) * 2654435761u) % SiteCount;
+    Site *entry = NULL;
+
+    for (apr_uint32_t probe = 0; probe < SiteCount && NULL == entry; probe++)
+    {
+        Site *candidate = &m_sites[(start + probe) % SiteCount];
+        const void *key = candidate->key;
+
+        if (key == site
+            || (NULL == key && __sync_bool_compare_and_swap(&candidate->key, key, site))
+            || candidate->key == site)
+        {
+            entry = candidate;
+        }
+    }
+
+    if (NULL == entry)
+    {
+        return true;
+    }
+
+    apr_uint32_t now = static_cast<apr_uint32_t>(apr_time_sec(apr_time_now()));
+    apr_uint32_t window = apr_atomic_read32(&entry->window);
+    if (now - window >= SiteInterval && window == apr_atomic_cas32(&entry->window, now, window))
+    {
+        suppressed = apr_atomic_xchg32(&entry->suppressed, 0);
+        apr_atomic_set32(&entry->count, 0);
+    }
+
+    if (apr_atomic_inc32(&entry->count) < SiteBurst)
+    {
+        return true;
+    }
+
+    apr_atomic_inc32(&entry->suppressed);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Queue a message for the logging thread.  Each record's sequence says whose
+    turn it is: a writer claims position p when the record's sequence is p,
+    and hands it to the reader by setting it to p + 1; the reader hands it
+    back for position p + QueueSize.
+
+    \returns    false if the queue is full
+*/
+
+bool ProviderLogger::Enqueue(apr_status_t status, const char* text, apr_uint32_t suppressed)
+{
+    apr_uint32_t position = apr_atomic_read32(&m_enqueue);
+    Record *record;
+
+    for (;;)
+    {
+        record = &m_queue[position & (QueueSize - 1)];
+        apr_int32_t ready = static_cast<apr_int32_t>(apr_atomic_read32(&record->sequence) - position);
+
+        if (0 == ready)
+        {
+            apr_uint32_t seen = apr_atomic_cas32(&m_enqueue, position + 1, position);
+            if (seen == position)
+            {
+                break;
+            }
+            position = seen;
+        }
+        else if (ready < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = apr_atomic_read32(&m_enqueue);
+        }
+    }
+
+    record->status = status;
+    record->time = apr_time_now();
+    record->suppressed = suppressed;
+    apr_cpystrn(record->text, text, sizeof(record->text));
+
+    __sync_synchronize();
+    apr_atomic_set32(&record->sequence, position + 1);
+    return true;
+}
+
+// Write the queued messages (logging thread, or Stop() once it has finished)
+apr_size_t ProviderLogger::Drain()
+{
+    apr_size_t count = 0;
+
+    for (;;)
+    {
+        Record *record = &m_queue[m_dequeue & (QueueSize - 1)];
+        if (apr_atomic_read32(&record->sequence) != m_dequeue + 1)
+        {
+            break;
+        }
+
+        __sync_synchronize();
+        WriteMessage(record->status, record->time, record->text, record->suppressed);
+
+        __sync_synchronize();
+        apr_atomic_set32(&record->sequence, m_dequeue + QueueSize);
+        m_dequeue++;
+        count++;
+    }
+
+    if (count)
+    {
+        Flush();
+    }
+
+    return count;
+}
+
+void ProviderLogger::WriteMessage(apr_status_t status, apr_time_t time, const char* text, apr_uint32_t suppressed)
+{
+    char dateStr[APR_CTIME_LEN];
+    char line[MessageLength + 256];
+    apr_size_t length;
+
+    apr_ctime(dateStr, time);
+
+    /* APR_OS_START_USERERR used for OMI errors; anything below is APR error */
+    /* TODO: OMI 1.0.8 allows you to convert OMI errors; we should use that
+     * once we bind to OMI 1.0.8.  For now, APR just gives the numeric error */
+
+    if (0 == status)
+    {
+        length = apr_snprintf(line, sizeof(line), "[%s] %s", dateStr, text);
+    }
+    else
+    {
+        char buffer[256];
+        char *errString = apr_strerror(status, buffer, sizeof(buffer));
+        length = apr_snprintf(line, sizeof(line), "[%s] %s, status=%d (%s)",
+                              dateStr, text, status, (errString != NULL ? errString : "Unknown error text"));
+    }
+
+    if (suppressed)
+    {
+        apr_snprintf(line + length, sizeof(line) - length, " (%u similar messages suppressed)", suppressed);
+    }
+
+    Write(line);
+}
+
+void ProviderLogger::Write(const char* line)
+{
+    fprintf(stderr, "%s\n", line);
+}
+
+void ProviderLogger::Flush()
+{
+    fflush(stderr);
+}
+
+// Pick up the level from PROVIDER_LOGLEVEL_FILE when it changes (or go back to the default without it)
+void ProviderLogger::CheckLevelFile()
+{
+    struct stat st;
+
+    if (0 != stat(PROVIDER_LOGLEVEL_FILE, &st))
+    {
+        if (0 != m_levelFileTime)
+        {
+            m_levelFileTime = 0;
+            SetLevel(DefaultLevel);
+        }
+        return;
+    }
+
+    if (st.st_mtime == m_levelFileTime)
+    {
+        return;
+    }
+    m_levelFileTime = st.st_mtime;
+
+    FILE *file = fopen(PROVIDER_LOGLEVEL_FILE, "r");
+    if (NULL == file)
+    {
+        return;
+    }
+
+    char text[32];
+    Level level;
+    if (NULL != fgets(text, sizeof(text), file) && ParseLevel(text, level))
+    {
+        SetLevel(level);
+    }
+    fclose(file);
+}
+
+void* APR_THREAD_FUNC ProviderLogger::threadmain(apr_thread_t *tid, void *data)
+{
+    // Dispatch to class threadmain method
+    ProviderLogger *logger = reinterpret_cast<ProviderLogger *> (data);
+    logger->ThreadMain();
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+void ProviderLogger::ThreadMain()
+{
+    apr_time_t levelFileTime = apr_time_now() + s_levelFileInterval;
+
+    while (apr_atomic_read32(&m_fRunning))
+    {
+        Drain();
+
+        if (apr_time_now() >= levelFileTime)
+        {
+            CheckLevelFile();
+            levelFileTime = apr_time_now() + s_levelFileInterval;
+        }
+
+        apr_sleep(s_drainInterval);
+    }
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
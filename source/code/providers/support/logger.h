@@ -0,0 +1,143 @@
+/*
+ *--------------------------------- START OF LICENSE ----------------------------
+ *
+ * Apache Cimprov ver. 1.0
+ *
+ * Copyright (c) Microsoft Corporation
+ *
+ * All rights reserved. 
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may not use
+ * this file except in compliance with the license. You may obtain a copy of the
+ * License at http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+ * MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ * See the Apache Version 2.0 License for specific language governing permissions
+ * and limitations under the License.
+ *
+ *---------------------------------- END OF LICENSE -----------------------------
+ */
+/**
+      \file        logger.h
+
+      \brief       Leveled, rate-limited, asynchronous logging for the provider
+
+      \date        10-16-26
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef LOGGER_APACHE_H
+#define LOGGER_APACHE_H
+
+// Apache Portable Runtime definitions
+#include <apr.h>
+#include <apr_atomic.h>
+#include <apr_errno.h>
+#include <apr_pools.h>
+#include <apr_thread_proc.h>
+#include <apr_time.h>
+
+#include <time.h>
+
+// Verbosity of a running provider: the file holds "error", "warning", "info" or
+// "debug" (it's checked every few seconds; without it, the level is LevelInfo)
+#define PROVIDER_LOGLEVEL_FILE  "/etc/opt/microsoft/apache-cimprov/conf/loglevel"
+
+/*------------------------------------------------------------------------------*/
+/**
+ *   ProviderLogger
+ *   Writes provider messages to stderr (the agent's log) from a thread of its
+ *   own, so callers only format the message and queue it.  The queue is a
+ *   lock-free ring; if it's ever full, the caller writes the message itself
+ *   rather than lose it.  Messages below the current level are discarded,
+ *   and each message site (identified by the caller) may log at most
+ *   SiteBurst messages every SiteInterval seconds; the number suppressed is
+ *   reported with the site's next message.  Until Start() (and after Stop()),
+ *   messages are written directly.
+ */
+
+class ProviderLogger
+{
+public:
+    enum Level
+    {
+        LevelError = 0,
+        LevelWarning,
+        LevelInfo,
+        LevelDebug
+    };
+
+    static const Level DefaultLevel = LevelInfo;
+    static const apr_uint32_t QueueSize = 256;          // Messages waiting to be written (power of two)
+    static const apr_size_t MessageLength = 512;        // Longer messages are truncated
+    static const apr_uint32_t SiteCount = 128;          // Message sites rate limited (others aren't)
+    static const apr_uint32_t SiteBurst = 10;           // Messages from each site per interval
+    static const apr_uint32_t SiteInterval = 60;        // Rate limiting interval (seconds)
+
+    ProviderLogger();
+    virtual ~ProviderLogger() { Stop(); }
+
+    apr_status_t Start(apr_pool_t* pool);
+    void Stop();
+
+    Level GetLevel() { return static_cast<Level>(apr_atomic_read32(&m_level)); }
+    void SetLevel(Level level) { apr_atomic_set32(&m_level, level); }
+    bool IsEnabled(Level level) { return level <= GetLevel(); }
+    static bool ParseLevel(const char* text, Level& level);
+
+    void Log(Level level, apr_status_t status, const char* text, const void* site);
+
+protected:
+    // Output of formatted messages (called by one thread at a time, except when the queue is full)
+    virtual void Write(const char* line);
+    virtual void Flush();
+
+private:
+    struct Record
+    {
+        volatile apr_uint32_t sequence; // Position the record is ready for (to write, or to read once written)
+        apr_status_t status;
+        apr_time_t time;
+        apr_uint32_t suppressed;        // Messages from the same site suppressed before this one
+        char text[MessageLength];
+    };
+
+    struct Site
+    {
+        const void * volatile key;      // Caller (NULL while the slot is unused)
+        volatile apr_uint32_t window;   // Start of the current interval (seconds)
+        volatile apr_uint32_t count;    // Messages in the current interval
+        volatile apr_uint32_t suppressed; // Messages suppressed in the current interval
+    };
+
+    bool Admit(const void* site, apr_uint32_t& suppressed);
+    bool Enqueue(apr_status_t status, const char* text, apr_uint32_t suppressed);
+    void WriteMessage(apr_status_t status, apr_time_t time, const char* text, apr_uint32_t suppressed);
+    apr_size_t Drain();
+    void CheckLevelFile();
+
+    static void* APR_THREAD_FUNC threadmain(apr_thread_t *tid, void *data);
+    void ThreadMain();
+
+    static const apr_interval_time_t s_drainInterval;      // How often the logging thread writes queued messages
+    static const apr_interval_time_t s_levelFileInterval;  // How often it checks PROVIDER_LOGLEVEL_FILE
+
+    volatile apr_uint32_t m_level;
+    Record m_queue[QueueSize];
+    volatile apr_uint32_t m_enqueue;    // Next position to write (any thread)
+    apr_uint32_t m_dequeue;             // Next position to read (logging thread)
+    Site m_sites[SiteCount];
+
+    apr_thread_t *m_thread;
+    volatile apr_uint32_t m_fRunning;
+    volatile apr_uint32_t m_logging;    // Callers that may queue a message (Stop() waits for them)
+    time_t m_levelFileTime;             // Modification time of PROVIDER_LOGLEVEL_FILE (zero if none)
+};
+
+#endif /* LOGGER_APACHE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,195 @@
+/*
+ *--------------------------------- START OF LICENSE ----------------------------
+ *
+ * Apache Cimprov ver. 1.0
+ *
+ * Copyright (c) Microsoft Corporation
+ *
+ * All rights reserved. 
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may not use
+ * this file except in compliance with the license. You may obtain a copy of the
+ * License at http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+ * MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ * See the Apache Version 2.0 License for specific language governing permissions
+ * and limitations under the License.
+ *
+ *---------------------------------- END OF LICENSE -----------------------------
+ */
+/**
+      \file        poolcache.cpp
+
+      \brief       Class to recycle Apache APR memory pools used by the provider
+
+      \date        10-16-26
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <apr.h>
+#include <apr_allocator.h>
+#include <apr_pools.h>
+#include <apr_thread_mutex.h>
+
+#include "poolcache.h"
+
+const apr_size_t PoolCache::MaxCachedPools;
+const apr_size_t PoolCache::MaxFreeBytes;
+
+void PoolCache::ResetUsage()
+{
+    m_usage.inUse = 0;
+    m_usage.cached = 0;
+    m_usage.created = 0;
+    m_usage.destroyed = 0;
+}
+
+apr_status_t PoolCache::Initialize(apr_pool_t* parent)
+{
+    apr_allocator_t *allocator;
+    apr_status_t status;
+
+    if (NULL != m_root)
+    {
+        return APR_SUCCESS;
+    }
+
+    if (APR_SUCCESS != (status = apr_allocator_create(&allocator)))
+    {
+        return status;
+    }
+
+    if (APR_SUCCESS != (status = apr_pool_create_ex(&m_root, parent, NULL, allocator)))
+    {
+        apr_allocator_destroy(allocator);
+        m_root = NULL;
+        return status;
+    }
+
+    // The root pool owns the allocator (destroying the root destroys it), and the pools are
+    // created and cleared on several threads, so the allocator needs a mutex of its own
+    apr_allocator_owner_set(allocator, m_root);
+    apr_allocator_max_free_set(allocator, MaxFreeBytes);
+
+    apr_thread_mutex_t *allocatorMutex;
+    if (APR_SUCCESS != (status = apr_thread_mutex_create(&allocatorMutex, APR_THREAD_MUTEX_DEFAULT, m_root))
+        || APR_SUCCESS != (status = apr_thread_mutex_create(&m_mutex, APR_THREAD_MUTEX_UNNESTED, m_root)))
+    {
+        apr_pool_destroy(m_root);
+        m_root = NULL;
+        m_mutex = NULL;
+        return status;
+    }
+    apr_allocator_mutex_set(allocator, allocatorMutex);
+
+    m_cachedCount = 0;
+    ResetUsage();
+    return APR_SUCCESS;
+}
+
+// Destroy the cache (and every pool it handed out)
+void PoolCache::Shutdown()
+{
+    if (NULL != m_root)
+    {
+        apr_pool_destroy(m_root);
+        m_root = NULL;
+        m_mutex = NULL;
+        m_cachedCount = 0;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Get a pool, reusing one that was returned if there is one.
+
+    \returns    Empty pool (to be returned with Put()), or NULL on failure
+*/
+
+apr_pool_t* PoolCache::Get()
+{
+    apr_pool_t *pool = NULL;
+
+    if (NULL == m_root || APR_SUCCESS != apr_thread_mutex_lock(m_mutex))
+    {
+        return NULL;
+    }
+
+    if (m_cachedCount > 0)
+    {
+        pool = m_cached[--m_cachedCount];
+    }
+    else if (APR_SUCCESS == apr_pool_create(&pool, m_root))
+    {
+        m_usage.created++;
+    }
+    else
+    {
+        pool = NULL;
+    }
+
+    if (NULL != pool)
+    {
+        m_usage.inUse++;
+    }
+
+    apr_thread_mutex_unlock(m_mutex);
+    return pool;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+    Return a pool (from Get()).  It's cleared, and kept for reuse if there's
+    room in the cache; otherwise it's destroyed.
+
+    \param      pool                    Pool to return (may be NULL)
+*/
+
+void PoolCache::Put(apr_pool_t* pool)
+{
+    if (NULL == pool || NULL == m_root)
+    {
+        return;
+    }
+
+    apr_pool_clear(pool);
+
+    if (APR_SUCCESS != apr_thread_mutex_lock(m_mutex))
+    {
+        return;
+    }
+
+    m_usage.inUse--;
+    if (m_cachedCount < MaxCachedPools)
+    {
+        m_cached[m_cachedCount++] = pool;
+    }
+    else
+    {
+        apr_pool_destroy(pool);
+        m_usage.destroyed++;
+    }
+
+    apr_thread_mutex_unlock(m_mutex);
+}
+
+void PoolCache::GetUsage(Usage& usage)
+{
+    if (NULL == m_root || APR_SUCCESS != apr_thread_mutex_lock(m_mutex))
+    {
+        ResetUsage();
+        usage = m_usage;
+        return;
+    }
+
+    m_usage.cached = m_cachedCount;
+    usage = m_usage;
+
+    apr_thread_mutex_unlock(m_mutex);
+}
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
@@ -0,0 +1,89 @@
+/*
+ *--------------------------------- START OF LICENSE ----------------------------
+ *
+ * Apache Cimprov ver. 1.0
+ *
+ * Copyright (c) Microsoft Corporation
+ *
+ * All rights reserved. 
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may not use
+ * this file except in compliance with the license. You may obtain a copy of the
+ * License at http://www.apache.org/licenses/LICENSE-2.0 
+ *
+ * THIS CODE IS PROVIDED ON AN *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+ * ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+ * WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+ * MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ * See the Apache Version 2.0 License for specific language governing permissions
+ * and limitations under the License.
+ *
+ *---------------------------------- END OF LICENSE -----------------------------
+ */
+/**
+      \file        poolcache.h
+
+      \brief       Class to recycle Apache APR memory pools used by the provider
+
+      \date        10-16-26
+*/
+/*----------------------------------------------------------------------------*/
+
+#ifndef POOLCACHE_APACHE_H
+#define POOLCACHE_APACHE_H
+
+// Apache Portable Runtime definitions
+#include <apr.h>
+#include <apr_allocator.h>
+#include <apr_pools.h>
+#include <apr_thread_mutex.h>
+
+/*------------------------------------------------------------------------------*/
+/**
+ *   PoolCache
+ *   Hands out memory pools (to data collectors) and takes them back for reuse.
+ *   Pools are cleared when they're returned; at most MaxCachedPools are kept,
+ *   and the rest are destroyed.  All pools share an allocator that keeps at
+ *   most MaxFreeBytes of freed memory, returning the rest to the heap, so the
+ *   memory held by the provider doesn't grow with the number of enumerations.
+ */
+
+class PoolCache
+{
+public:
+    static const apr_size_t MaxCachedPools = 8;
+    static const apr_size_t MaxFreeBytes = 1024 * 1024;
+
+    struct Usage
+    {
+        apr_size_t inUse;               // Pools handed out and not yet returned
+        apr_size_t cached;              // Pools kept for reuse
+        apr_size_t created;             // Pools created (since initialization)
+        apr_size_t destroyed;           // Pools destroyed because the cache was full
+    };
+
+    PoolCache() : m_root(NULL), m_mutex(NULL), m_cachedCount(0) { ResetUsage(); }
+    ~PoolCache() { Shutdown(); }
+
+    apr_status_t Initialize(apr_pool_t* parent);
+    void Shutdown();
+
+    apr_pool_t* Get();
+    void Put(apr_pool_t* pool);
+
+    void GetUsage(Usage& usage);
+
+private:
+    void ResetUsage();
+
+    apr_pool_t *m_root;                 // Parent of the pools (owns their allocator)
+    apr_thread_mutex_t *m_mutex;
+    apr_pool_t *m_cached[MaxCachedPools];
+    apr_size_t m_cachedCount;
+    Usage m_usage;
+};
+
+#endif /* POOLCACHE_APACHE_H */
+
+/*----------------------------E-N-D---O-F---F-I-L-E---------------------------*/
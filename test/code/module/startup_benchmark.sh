@@ -0,0 +1,172 @@
+#! /bin/bash
+#
+#--------------------------------- START OF LICENSE ----------------------------
+#
+# Apache Cimprov ver. 1.0
+#
+# Copyright (c) Microsoft Corporation
+#
+# All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the License); you may not use
+# this file except in compliance with the license. You may obtain a copy of the
+# License at http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR CONDITIONS OF
+# ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT LIMITATION ANY IMPLIED
+# WARRANTIES OR CONDITIONS OF TITLE, FITNESS FOR A PARTICULAR PURPOSE,
+# MERCHANTABLITY OR NON-INFRINGEMENT.
+#
+# See the Apache Version 2.0 License for specific language governing permissions
+# and limitations under the License.
+#
+#---------------------------------- END OF LICENSE -----------------------------
+
+#
+# Times Apache start and graceful restart over synthetic configurations with
+# many virtual hosts (1000, 10000 and 50000 unless host counts are given), with
+# and without mod_cimprov, then checks how the module matches certificate files.
+#
+# Usage: startup_benchmark.sh <httpd binary> <mod_cimprov.so> [host count ...]
+#
+# HTTPD_BASE_CONF names a file of directives to include first (LoadModule lines
+# for the MPM and whatever else the httpd build needs); PORT is the port to
+# listen on (default 18080).  The module keeps its shared memory and locks in
+# /var/opt/microsoft/apache-cimprov/run, which must exist and be writable.
+#
+
+SCRIPT=`basename $0`
+
+if [ $# -lt 2 ]; then
+    echo "Usage: ${SCRIPT} <httpd binary> <mod_cimprov.so> [host count ...]" 1>&2
+    exit 1
+fi
+
+HTTPD=$1
+MODULE=$2
+shift 2
+COUNTS=${*:-"1000 10000 50000"}
+PORT=${PORT:-18080}
+WORKDIR=`mktemp -d /tmp/cimprov_startup.XXXXXX` || exit 1
+CONF=${WORKDIR}/httpd.conf
+ERROR_LOG=${WORKDIR}/error_log
+TIMEOUT_SECONDS=600
+
+trap "${HTTPD} -f ${CONF} -k stop > /dev/null 2>&1; rm -rf ${WORKDIR}" EXIT
+
+# Configuration common to every run; loads the module if $1 is nonempty
+WriteConfigHeader()
+{
+    echo "ServerRoot ${WORKDIR}"
+    echo "ServerName localhost"
+    echo "Listen 127.0.0.1:${PORT}"
+    echo "PidFile ${WORKDIR}/httpd.pid"
+    echo "ErrorLog ${ERROR_LOG}"
+    echo "LogLevel notice"
+    [ -n "${HTTPD_BASE_CONF}" ] && echo "Include ${HTTPD_BASE_CONF}"
+    [ -n "$1" ] && echo "LoadModule cimprov_module ${MODULE}"
+    echo "DocumentRoot ${WORKDIR}"
+}
+
+# Configuration with $1 name-based virtual hosts (each with its own certificate file)
+WriteConfig()
+{
+    WriteConfigHeader $2 > ${CONF}
+    awk -v count=$1 -v port=${PORT} -v dir=${WORKDIR} 'BEGIN {
+        for (i = 1; i <= count; i++) {
+            printf "<VirtualHost 127.0.0.1:%d>\n", port
+            printf "    ServerName host%d.example.com\n", i
+            printf "    ServerAlias www.host%d.example.com\n", i
+            printf "    DocumentRoot %s\n", dir
+            printf "    <IfModule mod_cimprov.c>\n"
+            printf "        SSLCertificateFile %s/host%d.pem\n", dir, i
+            printf "    </IfModule>\n"
+            printf "</VirtualHost>\n"
+        }
+    }' >> ${CONF}
+}
+
+# Milliseconds until Apache has (re)started $1 times, as logged
+WaitForStart()
+{
+    local start=$2
+    local now
+
+    while [ `cat ${ERROR_LOG} 2> /dev/null | grep -c "resuming normal operations"` -lt $1 ]; do
+        now=`date +%s%N`
+        if [ $(( (now - start) / 1000000000 )) -ge ${TIMEOUT_SECONDS} ]; then
+            echo "${SCRIPT}: Apache didn't start; see ${ERROR_LOG}:" 1>&2
+            tail ${ERROR_LOG} 1>&2
+            exit 1
+        fi
+        sleep 0.01
+    done
+    now=`date +%s%N`
+    echo $(( (now - start) / 1000000 ))
+}
+
+# Start Apache, restart it gracefully, then stop it; prints the start and restart times
+TimeStartAndRestart()
+{
+    local start startTime restartTime
+
+    rm -f ${ERROR_LOG}
+    start=`date +%s%N`
+    ${HTTPD} -f ${CONF} -k start || exit 1
+    startTime=`WaitForStart 1 ${start}` || exit 1
+
+    start=`date +%s%N`
+    ${HTTPD} -f ${CONF} -k graceful || exit 1
+    restartTime=`WaitForStart 2 ${start}` || exit 1
+
+    ${HTTPD} -f ${CONF} -k stop
+    while [ -e ${WORKDIR}/httpd.pid ]; do
+        sleep 0.1
+    done
+
+    echo "${startTime} ${restartTime}"
+}
+
+echo "Virtual hosts    Start (ms)    With mod_cimprov    Graceful restart (ms)    With mod_cimprov"
+for count in ${COUNTS}; do
+    WriteConfig ${count} ""
+    baseTimes=`TimeStartAndRestart` || exit 1
+
+    WriteConfig ${count} module
+    moduleTimes=`TimeStartAndRestart` || exit 1
+
+    set -- ${baseTimes} ${moduleTimes}
+    printf "%13d    %10d    %16d    %21d    %16d\n" ${count} $1 $3 $2 $4
+done
+
+#
+# Certificate files are matched by exact name: names that differ only by white
+# space (which apr_strnatcmp, used before, ignores) are different files, and a
+# file named twice is one certificate
+#
+
+WriteConfigHeader module > ${CONF}
+cat >> ${CONF} <<EOF
+CimSetLogging On
+<VirtualHost 127.0.0.1:${PORT}>
+    ServerName one.example.com
+    SSLCertificateFile "${WORKDIR}/my cert.pem"
+</VirtualHost>
+<VirtualHost 127.0.0.1:${PORT}>
+    ServerName two.example.com
+    SSLCertificateFile ${WORKDIR}/mycert.pem
+</VirtualHost>
+<VirtualHost 127.0.0.1:${PORT}>
+    ServerName three.example.com
+    SSLCertificateFile ${WORKDIR}/mycert.pem
+</VirtualHost>
+EOF
+
+TimeStartAndRestart > /dev/null || exit 1
+if ! grep -q "cimprov: Count of certificates: 2$" ${ERROR_LOG}; then
+    echo "${SCRIPT}: certificate files weren't matched by exact name:" 1>&2
+    grep "cimprov: Count of certificates" ${ERROR_LOG} 1>&2
+    exit 1
+fi
+echo "Certificate files are matched by exact name"
+exit 0
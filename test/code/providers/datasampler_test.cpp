@@ -0,0 +1,824 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation.  All rights reserved.
+
+    Created date    2026-10-16 09:00:00
+
+    DataSampler unit tests.
+
+    Tests the virtual host computations against counters kept by the module.
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include <apr_thread_proc.h>
+
+#include "apachebinding.h"
+#include "datasampler.h"
+#include "testableapache.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Simulate an Apache worker thread sending large responses
+static const int s_threadCount = 8;
+static const int s_requestsPerThread = 1024;
+static const apr_uint64_t s_bytesPerRequest = 1024 * 1024;
+
+static void* APR_THREAD_FUNC CountRequests(apr_thread_t *tid, void *data)
+{
+    mmap_vhost_counters *counters = static_cast<mmap_vhost_counters *>(data);
+
+    for (int i = 0; i < s_requestsPerThread; i++)
+    {
+        MMAP_ATOMIC_INC64(&counters->requestsTotal);
+        MMAP_ATOMIC_ADD64(&counters->requestsBytes, s_bytesPerRequest);
+    }
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+// Simulate Apache worker threads requesting one of two URLs that share a heavy-hitter slot
+static const apr_uint64_t s_bytesPerUrl = 100;
+
+struct UrlRequests
+{
+    mmap_topurl_slot *slot;
+    const char *url;
+};
+
+static void* APR_THREAD_FUNC CountUrls(apr_thread_t *tid, void *data)
+{
+    UrlRequests *requests = static_cast<UrlRequests *>(data);
+
+    for (int i = 0; i < s_requestsPerThread; i++)
+    {
+        mmap_topurl_count(requests->slot, 1, requests->url, s_bytesPerUrl);
+    }
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+// Build a region like the one Apache builds for a configuration with many virtual
+// hosts (element 0 is _Total), counted in several slabs.  The last dynamic + 1
+// elements are dynamic host slots and the overflow element.
+static mmap_server_data *GenerateLargeRegion(apr_pool_t *pool, apr_size_t count, apr_size_t shards, apr_size_t dynamic = 0)
+{
+    apr_size_t counterShardSize = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_counters) * count);
+    apr_size_t latencyShardSize = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_latency) * count);
+    apr_size_t counterShardOffset = MMAP_CACHE_LINE_ALIGN(sizeof(mmap_server_data));
+    apr_size_t evictedCountersOffset = counterShardOffset + shards * counterShardSize;
+    apr_size_t latencyShardOffset = evictedCountersOffset + MMAP_CACHE_LINE_ALIGN(sizeof(mmap_vhost_counters));
+    apr_size_t traceRingOffset = latencyShardOffset + shards * latencyShardSize;
+    apr_size_t clientsOffset = traceRingOffset + MMAP_CACHE_LINE_ALIGN(sizeof(mmap_trace_ring));
+    apr_size_t dynamicHostOffset = clientsOffset + sizeof(mmap_vhost_clients) * count;
+    apr_size_t size = dynamicHostOffset + (sizeof(apr_uint64_t) + sizeof(mmap_dynamic_host)) * dynamic;
+
+    char *base = static_cast<char *>(apr_pcalloc(pool, size + MMAP_CACHE_LINE_SIZE));
+    mmap_server_data *server = reinterpret_cast<mmap_server_data *>(MMAP_CACHE_LINE_ALIGN(reinterpret_cast<apr_size_t>(base)));
+
+    server->header.magic = MMAP_REGION_MAGIC;
+    server->header.version = MMAP_REGION_VERSION;
+    server->header.regionSize = size;
+    server->header.generation = 1;
+    server->serverPid = getpid();
+    server->counterShardCount = shards;
+    server->counterShardOffset = counterShardOffset;
+    server->counterShardSize = counterShardSize;
+    server->evictedCountersOffset = evictedCountersOffset;
+    server->latencyShardOffset = latencyShardOffset;
+    server->latencyShardSize = latencyShardSize;
+    server->traceRingOffset = traceRingOffset;
+    server->clientsCount = count;
+    server->clientsOffset = clientsOffset;
+    server->dynamicHostCount = dynamic;
+    server->dynamicHostBase = dynamic ? count - dynamic - 1 : count;
+    server->dynamicHostOffset = dynamicHostOffset;
+
+    return server;
+}
+
+// Requests (and clients) of each virtual host over one 10 second sample of the region above
+static void GenerateTraffic(mmap_server_data *server, apr_size_t count, apr_uint32_t sample)
+{
+    for (apr_size_t i = 1; i < count; i++)
+    {
+        apr_size_t shard = i % server->counterShardCount;
+        mmap_vhost_counters& counters = MMAP_COUNTER_SLAB(server, shard)[i];
+        mmap_vhost_latency& latency = MMAP_LATENCY_SLAB(server, shard)[i];
+        apr_uint64_t requests = 10 * (1 + i % 50);
+
+        MMAP_ATOMIC_ADD64(&counters.requestsTotal, requests);
+        MMAP_ATOMIC_ADD64(&counters.requestsBytes, requests * 4096);
+        MMAP_ATOMIC_ADD64(&counters.responses[MMAP_RESPONSE_2XX], requests - 1);
+        MMAP_ATOMIC_ADD64(&counters.responses[MMAP_RESPONSE_404], 1);
+        MMAP_ATOMIC_ADD64(&counters.responses[MMAP_RESPONSE_4XX], 1);
+        latency.buckets[mmap_latency_bucket(1000 + (i % 7) * 1000)] += static_cast<apr_uint32_t>(requests);
+        latency.maxLatency = 20000;
+
+        char address[32];
+        sprintf(address, "10.%u.%u.%u", static_cast<unsigned>(sample), static_cast<unsigned>((i >> 8) & 0xff),
+                static_cast<unsigned>(i & 0xff));
+        mmap_hll_add(MMAP_VHOST_CLIENTS(server)[i].interval, address);
+    }
+}
+
+// Hand the region above (with virtual host data to match) to the test factory's collectors
+static mmap_vhost_data *SetLargeMemoryMap(apr_pool_t *pool, mmap_server_data *server, apr_size_t count)
+{
+    mmap_vhost_data *vhosts = static_cast<mmap_vhost_data *>(
+        apr_pcalloc(pool, sizeof(mmap_vhost_data) + count * (sizeof(mmap_vhost_elements) + sizeof(mmap_vhost_statistics))));
+    mmap_certificate_data *certificates = static_cast<mmap_certificate_data *>(apr_pcalloc(pool, sizeof(mmap_certificate_data)));
+    mmap_string_table *strings = static_cast<mmap_string_table *>(apr_pcalloc(pool, sizeof(mmap_string_table) + 1));
+    vhosts->count = count;
+    strings->total_length = 1;
+    static_cast<TestableApacheFactory *>(g_pFactory)->SetMemoryMap(server, vhosts, certificates, strings);
+
+    return vhosts;
+}
+
+class Apache_DataSampler_Test : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( Apache_DataSampler_Test );
+
+    CPPUNIT_TEST( TestRatesWithCountersPast32Bits );
+    CPPUNIT_TEST( TestConcurrentCountersPast32Bits );
+    CPPUNIT_TEST( TestResponseRates );
+    CPPUNIT_TEST( TestPercentCPUOverElapsedTime );
+    CPPUNIT_TEST( TestRateHistoryWindows );
+    CPPUNIT_TEST( TestProcessTreeStat );
+    CPPUNIT_TEST( TestLatencyBuckets );
+    CPPUNIT_TEST( TestLatencyPercentiles );
+    CPPUNIT_TEST( TestTraceRing );
+    CPPUNIT_TEST( TestTopUrlCounting );
+    CPPUNIT_TEST( TestConcurrentTopUrlCounting );
+    CPPUNIT_TEST( TestTopUrlRanking );
+    CPPUNIT_TEST( TestUniqueClientEstimate );
+    CPPUNIT_TEST( TestRegionSequenceLock );
+    CPPUNIT_TEST( TestDynamicHostTable );
+    CPPUNIT_TEST( TestEvictionKeepsDerivedTotal );
+    CPPUNIT_TEST( TestSnapshotReusesBuffer );
+    CPPUNIT_TEST( TestSamplingPassOverManyVHosts );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestSamplingPassOverManyVHosts, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+private:
+    mmap_vhost_statistics m_stats[3];
+    mmap_vhost_counters m_counters[3];
+
+public:
+    void setUp(void)
+    {
+        g_pFactory = new TestableApacheFactory();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("Apache_DataSampler_Test"));
+
+        memset(m_stats, 0, sizeof(m_stats));
+        memset(m_counters, 0, sizeof(m_counters));
+    }
+
+    void tearDown(void)
+    {
+        g_pFactory->GetInit()->Unload("Apache_DataSampler_Test");
+
+        delete g_pFactory;
+        g_pFactory = NULL;
+    }
+
+    void TestRatesWithCountersPast32Bits()
+    {
+        // Drive byte counter past 2^32 several times within a single sample
+        const apr_uint64_t bytes = (static_cast<apr_uint64_t>(5) << 32) + (3 * 1024);
+
+        MMAP_ATOMIC_ADD64(&m_counters[2].requestsTotal, 1000);
+        MMAP_ATOMIC_ADD64(&m_counters[2].requestsBytes, bytes);
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_5XX], 120);
+
+        DataSampler::ComputeVHostStatistics(m_stats, m_counters, 3, apr_time_from_sec(60));
+
+        CPPUNIT_ASSERT_EQUAL(bytes, static_cast<apr_uint64_t>(MMAP_ATOMIC_READ64(&m_counters[2].requestsBytes)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(16), m_stats[2].requestsPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>((bytes / 1024) / 1000), m_stats[2].kbPerRequest);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>((bytes / 1024) / 60), m_stats[2].kbPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(120), m_stats[2].responsesPerMinute[MMAP_RESPONSE_5XX]);
+
+        // Next sample only sees the change since the prior sample
+        MMAP_ATOMIC_ADD64(&m_counters[2].requestsBytes, 60 * 1024);
+
+        DataSampler::ComputeVHostStatistics(m_stats, m_counters, 3, apr_time_from_sec(60));
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), m_stats[2].requestsPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1), m_stats[2].kbPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), m_stats[2].responsesPerMinute[MMAP_RESPONSE_5XX]);
+    }
+
+    void TestConcurrentCountersPast32Bits()
+    {
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+        apr_thread_t *threads[s_threadCount];
+        apr_status_t status;
+
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS,
+                                 apr_thread_create(&threads[i], NULL, CountRequests, &m_counters[2], pool.Get()));
+        }
+
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, threads[i]));
+        }
+
+        // No counts may be lost, even though the byte count passes 2^32 (8 GB total)
+        const apr_uint64_t requests = static_cast<apr_uint64_t>(s_threadCount) * s_requestsPerThread;
+        const apr_uint64_t bytes = requests * s_bytesPerRequest;
+
+        CPPUNIT_ASSERT_EQUAL(requests, static_cast<apr_uint64_t>(MMAP_ATOMIC_READ64(&m_counters[2].requestsTotal)));
+        CPPUNIT_ASSERT_EQUAL(bytes, static_cast<apr_uint64_t>(MMAP_ATOMIC_READ64(&m_counters[2].requestsBytes)));
+
+        DataSampler::ComputeVHostStatistics(m_stats, m_counters, 3, apr_time_from_sec(60));
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(requests / 60), m_stats[2].requestsPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1024), m_stats[2].kbPerRequest);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>((bytes / 1024) / 60), m_stats[2].kbPerSecond);
+    }
+
+    void TestResponseRates()
+    {
+        // Backend meltdown: 502s and 504s, counted both individually and as 5xx
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_2XX], 600);
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_5XX], 300);
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_502], 120);
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_504], 180);
+        MMAP_ATOMIC_ADD64(&m_counters[2].responses[MMAP_RESPONSE_ABORTED], 30);
+
+        DataSampler::ComputeVHostStatistics(m_stats, m_counters, 3, apr_time_from_sec(120));
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(300), m_stats[2].responsesPerMinute[MMAP_RESPONSE_2XX]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(150), m_stats[2].responsesPerMinute[MMAP_RESPONSE_5XX]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(60), m_stats[2].responsesPerMinute[MMAP_RESPONSE_502]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), m_stats[2].responsesPerMinute[MMAP_RESPONSE_504]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), m_stats[2].responsesPerMinute[MMAP_RESPONSE_503]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(15), m_stats[2].responsesPerMinute[MMAP_RESPONSE_ABORTED]);
+    }
+
+    void TestPercentCPUOverElapsedTime()
+    {
+        // Two of four processors busy for the whole interval, whatever its length
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(50), DataSampler::ComputePercentCPU(2 * 100 * 60, 100, 4, apr_time_from_sec(60)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(50), DataSampler::ComputePercentCPU(2 * 100 * 10, 100, 4, apr_time_from_sec(10)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(50), DataSampler::ComputePercentCPU(2 * 100 * 5 / 2, 100, 4, apr_time_from_msec(2500)));
+
+        // Clamped (ticks are sampled at slightly different times than the clock), and safe with no elapsed time
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(100), DataSampler::ComputePercentCPU(500 * 10, 100, 4, apr_time_from_sec(10)));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), DataSampler::ComputePercentCPU(100, 100, 4, 0));
+    }
+
+    void TestProcessTreeStat()
+    {
+        // The command may contain spaces and parentheses; fields are counted from the last ')'
+        static const char stat[] =
+            "1234 (httpd (worker) x) S 1 1234 1234 0 -1 4194624 5000 100 0 0 "
+            "700 300 25 15 20 0 1 0 8000 250000000 3072 18446744073709551615 1 1 0 0 0 0 0 4096 0 0 0 0 17 1 0 0 0 0 0\n";
+        ProcessTree::Usage usage;
+
+        CPPUNIT_ASSERT(ProcessTree::ParseStat(stat, sizeof(stat) - 1, usage));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(1000), usage.ticks);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(40), usage.reapedTicks);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(3072), usage.residentPages);
+
+        // Truncated contents (or no command at all) aren't parsed
+        CPPUNIT_ASSERT(! ProcessTree::ParseStat(stat, 80, usage));
+        CPPUNIT_ASSERT(! ProcessTree::ParseStat("1234 httpd S 1", 14, usage));
+
+        // Our own process can be read (repeatedly, from the same file); an empty slot can't
+        ProcessTree tree;
+        tree.Reset(2);
+        CPPUNIT_ASSERT(tree.Read(0, getpid(), usage));
+        CPPUNIT_ASSERT(usage.residentPages > 0);
+        CPPUNIT_ASSERT_EQUAL(usage.ticks, usage.intervalTicks);
+        CPPUNIT_ASSERT(tree.Read(0, getpid(), usage));
+        CPPUNIT_ASSERT(usage.intervalTicks <= usage.ticks);
+        CPPUNIT_ASSERT(! tree.Read(1, 0, usage));
+    }
+
+    void TestRateHistoryWindows()
+    {
+        RateHistory history;
+        mmap_rate_history windows;
+        history.Reset(2);
+
+        // A spike within the first minute; until a minute has passed, all windows report the samples so far
+        static const apr_uint32_t firstMinute[] = { 10, 20, 90, 30, 20, 10 };
+        apr_uint32_t peak = 0;
+        for (apr_size_t i = 0; i < RateHistory::SamplesPerMinute; i++)
+        {
+            history.Add(0, firstMinute[i]);
+            history.Add(1, 7);
+            history.Advance();
+
+            peak = std::max(peak, firstMinute[i]);
+            history.Compute(0, windows);
+            CPPUNIT_ASSERT_EQUAL(peak, windows.peak[3]);
+        }
+
+        history.Compute(0, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(30), windows.average[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), windows.peak[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(30), windows.average[1]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), windows.peak[3]);
+
+        // A quiet minute: the spike leaves the 1 minute window, but not the longer ones
+        for (apr_size_t i = 0; i < RateHistory::SamplesPerMinute; i++)
+        {
+            history.Add(0, 0);
+            history.Add(1, 7);
+            history.Advance();
+        }
+
+        history.Compute(0, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), windows.average[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), windows.peak[0]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(15), windows.average[1]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), windows.peak[1]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), windows.peak[3]);
+
+        // Series are independent, and can be cleared (an evicted dynamic host)
+        history.Compute(1, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(7), windows.average[3]);
+        history.Clear(1);
+        history.Compute(1, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), windows.peak[3]);
+
+        // Series keep their history when moved (Apache rebuilt the region with a host added before this one)
+        std::vector<apr_size_t> from;
+        from.push_back(RateHistory::NoSeries);
+        from.push_back(0);
+        history.Remap(from);
+        history.Compute(1, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(15), windows.average[1]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(90), windows.peak[3]);
+        history.Compute(0, windows);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), windows.peak[3]);
+    }
+
+    void TestLatencyBuckets()
+    {
+        // Every latency must fall within the limits of its bucket, and buckets must be in order
+        apr_size_t prior = 0;
+        for (apr_uint64_t usec = 0; usec <= 0xFFFFFFFF; usec += (usec >> 6) + 1)
+        {
+            apr_size_t bucket = mmap_latency_bucket(static_cast<apr_uint32_t>(usec));
+
+            CPPUNIT_ASSERT(bucket < MMAP_LATENCY_BUCKETS);
+            CPPUNIT_ASSERT(bucket >= prior);
+            CPPUNIT_ASSERT(mmap_latency_bucket_limit(bucket) >= usec);
+            CPPUNIT_ASSERT(bucket == 0 || mmap_latency_bucket_limit(bucket - 1) < usec);
+            prior = bucket;
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(MMAP_LATENCY_BUCKETS - 1), mmap_latency_bucket(0xFFFFFFFF));
+    }
+
+    void TestLatencyPercentiles()
+    {
+        mmap_vhost_latency latency;
+        memset(&latency, 0, sizeof(latency));
+
+        // No requests: everything is zero
+        DataSampler::ComputeLatencyStatistics(m_stats[2], latency);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), m_stats[2].latencyP50);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), m_stats[2].latencyMax);
+
+        // 90 fast requests (1ms), 9 slower (50ms), one very slow (2s)
+        latency.buckets[mmap_latency_bucket(1000)] = 90;
+        latency.buckets[mmap_latency_bucket(50000)] = 9;
+        latency.buckets[mmap_latency_bucket(2000000)] = 1;
+        latency.maxLatency = 2000000;
+
+        DataSampler::ComputeLatencyStatistics(m_stats[2], latency);
+
+        CPPUNIT_ASSERT_EQUAL(mmap_latency_bucket_limit(mmap_latency_bucket(1000)), m_stats[2].latencyP50);
+        CPPUNIT_ASSERT_EQUAL(mmap_latency_bucket_limit(mmap_latency_bucket(50000)), m_stats[2].latencyP95);
+        CPPUNIT_ASSERT_EQUAL(mmap_latency_bucket_limit(mmap_latency_bucket(50000)), m_stats[2].latencyP99);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(2000000), m_stats[2].latencyMax);
+
+        // Reported percentiles are within the resolution of the histogram
+        CPPUNIT_ASSERT(m_stats[2].latencyP50 >= 1000 && m_stats[2].latencyP50 <= 1000 + 1000 / MMAP_LATENCY_SUB_BUCKETS);
+    }
+
+    void TestTraceRing()
+    {
+        static const apr_uint32_t capacity = 8;
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+        mmap_trace_ring *ring = static_cast<mmap_trace_ring *>(
+            apr_pcalloc(pool.Get(), sizeof(mmap_trace_ring) + sizeof(mmap_trace_record) * capacity + MMAP_CACHE_LINE_SIZE));
+        ring = reinterpret_cast<mmap_trace_ring *>(MMAP_CACHE_LINE_ALIGN(reinterpret_cast<apr_size_t>(ring)));
+        ring->capacity = capacity;
+
+        mmap_trace_record records[2 * capacity];
+        apr_uint64_t cursor = 0, sequence;
+
+        // Write more records than the ring holds; the oldest are lost
+        for (int i = 0; i < 12; i++)
+        {
+            mmap_trace_record *record = mmap_trace_claim(ring, &sequence);
+            record->status = static_cast<apr_uint16_t>(200 + i);
+            mmap_trace_commit(record, sequence);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(capacity),
+                             ApacheDataCollector::ReadTraceRecords(ring, cursor, records, 2 * capacity));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(12), cursor);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint16_t>(204), records[0].status);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint16_t>(211), records[capacity - 1].status);
+
+        // A record still being written stops the reader until it is committed
+        mmap_trace_record *pending = mmap_trace_claim(ring, &sequence);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(0),
+                             ApacheDataCollector::ReadTraceRecords(ring, cursor, records, 2 * capacity));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(12), cursor);
+
+        pending->status = 404;
+        mmap_trace_commit(pending, sequence);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(1),
+                             ApacheDataCollector::ReadTraceRecords(ring, cursor, records, 2 * capacity));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint16_t>(404), records[0].status);
+
+        // Sequence numbers carry on past 32 bits; a record is never mistaken for one being written
+        ring->head = cursor = 0xFFFFFFFE;
+        for (int i = 0; i < 3; i++)
+        {
+            mmap_trace_record *record = mmap_trace_claim(ring, &sequence);
+            record->status = static_cast<apr_uint16_t>(500 + i);
+            mmap_trace_commit(record, sequence);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(3),
+                             ApacheDataCollector::ReadTraceRecords(ring, cursor, records, 2 * capacity));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(0x100000001ULL), cursor);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint16_t>(502), records[2].status);
+    }
+
+    void TestTopUrlCounting()
+    {
+        // One slot, so the URLs collide
+        mmap_topurl_slot slot;
+        memset(&slot, 0, sizeof(slot));
+        apr_size_t length;
+        apr_uint64_t a = static_cast<apr_uint64_t>(mmap_topurl_hash("/a", &length)) << 32;
+        apr_uint64_t b = static_cast<apr_uint64_t>(mmap_topurl_hash("/b", &length)) << 32;
+
+        // A free slot is taken over, then counted
+        mmap_topurl_count(&slot, 1, "/a", 100);
+        mmap_topurl_count(&slot, 1, "/a", 200);
+        CPPUNIT_ASSERT_EQUAL(a | 2, static_cast<apr_uint64_t>(slot.key));
+        CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(a >> 32) | 300, static_cast<apr_uint64_t>(slot.bytes));
+        CPPUNIT_ASSERT_EQUAL(std::string("/a"), std::string(slot.url));
+
+        // Another URL wears the count down, then takes the slot over with its bytes started over
+        mmap_topurl_count(&slot, 1, "/b", 1000);
+        mmap_topurl_count(&slot, 1, "/b", 1000);
+        CPPUNIT_ASSERT_EQUAL(a, static_cast<apr_uint64_t>(slot.key));
+        mmap_topurl_count(&slot, 1, "/b", 50);
+        CPPUNIT_ASSERT_EQUAL(b | 1, static_cast<apr_uint64_t>(slot.key));
+        CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(b >> 32) | 50, static_cast<apr_uint64_t>(slot.bytes));
+        CPPUNIT_ASSERT_EQUAL(std::string("/b"), std::string(slot.url));
+
+        // The count saturates rather than carry into the fingerprint (bytes are still counted)
+        slot.key = b | MMAP_TOPURL_MAX_COUNT;
+        mmap_topurl_count(&slot, 1, "/b", 50);
+        CPPUNIT_ASSERT_EQUAL(b | MMAP_TOPURL_MAX_COUNT, static_cast<apr_uint64_t>(slot.key));
+        CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(b >> 32) | 100, static_cast<apr_uint64_t>(slot.bytes));
+
+        // So do the bytes
+        slot.bytes = MMAP_TOPURL_BYTES_TAG(b >> 32) | (MMAP_TOPURL_BYTES_MASK - 10);
+        mmap_topurl_count(&slot, 1, "/b", 50);
+        CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(b >> 32) | MMAP_TOPURL_BYTES_MASK, static_cast<apr_uint64_t>(slot.bytes));
+    }
+
+    void TestConcurrentTopUrlCounting()
+    {
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+        apr_thread_t *threads[s_threadCount];
+        UrlRequests requests[s_threadCount];
+        apr_status_t status;
+        mmap_topurl_slot slot;
+        apr_size_t length;
+
+        // All threads requesting one URL: no request (or byte) is lost
+        memset(&slot, 0, sizeof(slot));
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            requests[i].slot = &slot;
+            requests[i].url = "/a";
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_create(&threads[i], NULL, CountUrls, &requests[i], pool.Get()));
+        }
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, threads[i]));
+        }
+
+        apr_uint32_t a = mmap_topurl_hash("/a", &length);
+        const apr_uint64_t total = static_cast<apr_uint64_t>(s_threadCount) * s_requestsPerThread;
+        CPPUNIT_ASSERT_EQUAL((static_cast<apr_uint64_t>(a) << 32) | total, static_cast<apr_uint64_t>(slot.key));
+        CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(a) | (total * s_bytesPerUrl), static_cast<apr_uint64_t>(slot.bytes));
+
+        // Half the threads on each of two URLs: the slot ends up held by one of them, with its bytes
+        memset(&slot, 0, sizeof(slot));
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            requests[i].url = (i % 2) ? "/b" : "/a";
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_create(&threads[i], NULL, CountUrls, &requests[i], pool.Get()));
+        }
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, threads[i]));
+        }
+
+        apr_uint32_t holder = static_cast<apr_uint32_t>(slot.key >> 32);
+        CPPUNIT_ASSERT(holder == a || holder == mmap_topurl_hash("/b", &length));
+        CPPUNIT_ASSERT((slot.key & MMAP_TOPURL_MAX_COUNT) <= total / 2);
+        if (slot.key & MMAP_TOPURL_MAX_COUNT)
+        {
+            CPPUNIT_ASSERT_EQUAL(MMAP_TOPURL_BYTES_TAG(holder), slot.bytes & ~MMAP_TOPURL_BYTES_MASK);
+        }
+    }
+
+    void TestTopUrlRanking()
+    {
+        static const char *urls[] = { "/a", "/b", "/c", "/d" };
+        static const apr_uint64_t requests[] = { 10, 500, 40, 3 };
+        static const apr_uint64_t bytes[] = { 1000, 5000, 400, 90000 };
+
+        std::vector<mmap_topurl_result> counted(4);
+        for (int i = 0; i < 4; i++)
+        {
+            memset(&counted[i], 0, sizeof(mmap_topurl_result));
+            strcpy(counted[i].url, urls[i]);
+            counted[i].requests = requests[i];
+            counted[i].bytes = bytes[i];
+        }
+
+        // Top 2 by requests (/b, /c), then any others in top 2 by bytes (/d)
+        mmap_topurl_result results[4];
+        DataSampler::RankTopUrls(counted, 2, results);
+
+        CPPUNIT_ASSERT_EQUAL(std::string("/b"), std::string(results[0].url));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1), results[0].rankByRequests);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(2), results[0].rankByBytes);
+        CPPUNIT_ASSERT_EQUAL(std::string("/c"), std::string(results[1].url));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(2), results[1].rankByRequests);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), results[1].rankByBytes);
+        CPPUNIT_ASSERT_EQUAL(std::string("/d"), std::string(results[2].url));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), results[2].rankByRequests);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1), results[2].rankByBytes);
+        CPPUNIT_ASSERT_EQUAL('\0', results[3].url[0]);
+    }
+
+    void TestUniqueClientEstimate()
+    {
+        unsigned char registers[MMAP_HLL_REGISTERS];
+        memset(registers, 0, sizeof(registers));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), DataSampler::EstimateUniqueClients(registers));
+
+        // Repeat visits don't count; the estimate should be within ~3 standard errors
+        static const apr_uint32_t checkpoints[] = { 100, 1000, 20000 };
+        apr_uint32_t added = 0;
+        for (int c = 0; c < 3; c++)
+        {
+            for (; added < checkpoints[c]; added++)
+            {
+                char address[32];
+                sprintf(address, "10.%u.%u.%u", (added >> 16) & 0xff, (added >> 8) & 0xff, added & 0xff);
+                mmap_hll_add(registers, address);
+                mmap_hll_add(registers, address);
+            }
+
+            double estimate = DataSampler::EstimateUniqueClients(registers);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(checkpoints[c], estimate, checkpoints[c] * 0.10);
+        }
+    }
+
+    void TestRegionSequenceLock()
+    {
+        mmap_region_header header;
+        memset(&header, 0, sizeof(header));
+
+        // Not yet published (no magic number)
+        apr_uint32_t sequence = mmap_region_read_begin(&header);
+        CPPUNIT_ASSERT(mmap_region_read_retry(&header, sequence));
+
+        header.magic = MMAP_REGION_MAGIC;
+        sequence = mmap_region_read_begin(&header);
+        CPPUNIT_ASSERT(!mmap_region_read_retry(&header, sequence));
+
+        // A read that overlaps a rewrite (or starts during one) must retry
+        mmap_region_write_begin(&header);
+        CPPUNIT_ASSERT(mmap_region_read_retry(&header, sequence));
+        sequence = mmap_region_read_begin(&header);
+        mmap_region_write_end(&header);
+        CPPUNIT_ASSERT(mmap_region_read_retry(&header, sequence));
+
+        sequence = mmap_region_read_begin(&header);
+        CPPUNIT_ASSERT(!mmap_region_read_retry(&header, sequence));
+    }
+
+    void TestDynamicHostTable()
+    {
+        static const apr_size_t count = 4;
+        volatile apr_uint64_t keys[count];
+        mmap_dynamic_host hosts[count];
+        memset(const_cast<apr_uint64_t *>(keys), 0, sizeof(keys));
+        memset(hosts, 0, sizeof(hosts));
+
+        // Each name claims its own slot, and finds it again
+        static const char *names[] = { "a.example.com", "b.example.com", "c.example.com", "d.example.com" };
+        apr_size_t slots[count];
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            slots[i] = mmap_dynamic_host_find(keys, hosts, count, names[i], 100);
+            CPPUNIT_ASSERT(slots[i] < count);
+            CPPUNIT_ASSERT_EQUAL(std::string(names[i]), std::string(hosts[slots[i]].name));
+            CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1), hosts[slots[i]].ready);
+        }
+        CPPUNIT_ASSERT_EQUAL(slots[1], mmap_dynamic_host_find(keys, hosts, count, names[1], 200));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(200), hosts[slots[1]].lastSeen);
+
+        // No room for more names until a slot is freed (long names are truncated)
+        std::string longName(2 * MMAP_DYNAMIC_HOST_LENGTH, 'x');
+        CPPUNIT_ASSERT_EQUAL(count, mmap_dynamic_host_find(keys, hosts, count, longName.c_str(), 200));
+
+        hosts[slots[2]].ready = 0;
+        keys[slots[2]] = 0;
+        CPPUNIT_ASSERT_EQUAL(slots[2], mmap_dynamic_host_find(keys, hosts, count, longName.c_str(), 200));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(MMAP_DYNAMIC_HOST_LENGTH - 1), strlen(hosts[slots[2]].name));
+    }
+
+    void TestEvictionKeepsDerivedTotal()
+    {
+        // _Total, a configured host, two dynamic host slots and the overflow element, in 2 slabs
+        static const apr_size_t count = 5;
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+
+        mmap_server_data *server = GenerateLargeRegion(pool.Get(), count, 2, 2);
+        SetLargeMemoryMap(pool.Get(), server, count);
+        ApacheDataCollector data;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Attach("TestEvictionKeepsDerivedTotal"));
+
+        mmap_dynamic_host *host = data.GetDynamicHost(2);
+        MMAP_DYNAMIC_HOST_KEYS(server)[0] = mmap_dynamic_host_key("idle.example.com");
+        strcpy(host->name, "idle.example.com");
+        host->lastSeen = 100;
+        host->ready = 1;
+        GenerateTraffic(server, count, 0);
+
+        // Marked first: Apache no longer finds the name (or claims the slot)
+        CPPUNIT_ASSERT(! data.MarkDynamicHostEvicting(2, 100));
+        CPPUNIT_ASSERT(data.MarkDynamicHostEvicting(2, 200));
+        CPPUNIT_ASSERT(data.IsDynamicHostEvicting(2));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(0), static_cast<apr_uint32_t>(host->ready));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(1),
+                             mmap_dynamic_host_find(MMAP_DYNAMIC_HOST_KEYS(server), MMAP_DYNAMIC_HOSTS(server), 2,
+                                                    "idle.example.com", 300));
+        MMAP_DYNAMIC_HOST_KEYS(server)[1] = 0;
+
+        // A request that found the host before it was marked still counts
+        mmap_count_request(&MMAP_COUNTER_SLAB(server, 1)[2], 4096, 200, -1, 0);
+
+        mmap_vhost_counters before, after, evicted;
+        data.GetVHostCounters(0, before);
+        data.EvictDynamicHost(2);
+        data.GetVHostCounters(0, after);
+        data.GetVHostCounters(2, evicted);
+
+        // The host starts over, but _Total keeps its requests
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(0), static_cast<apr_uint64_t>(evicted.requestsTotal));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(0), static_cast<apr_uint64_t>(MMAP_DYNAMIC_HOST_KEYS(server)[0]));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(before.requestsTotal), static_cast<apr_uint64_t>(after.requestsTotal));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(before.requestsBytes), static_cast<apr_uint64_t>(after.requestsBytes));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(before.responses[MMAP_RESPONSE_404]),
+                             static_cast<apr_uint64_t>(after.responses[MMAP_RESPONSE_404]));
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint64_t>(before.requestsTotal), data.Snapshot().vhosts[0].requestsTotal);
+    }
+
+    void TestSnapshotReusesBuffer()
+    {
+        // _Total and 100 virtual hosts, counted in 4 slabs (so _Total is derived)
+        static const apr_size_t count = 101;
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+
+        mmap_server_data *server = GenerateLargeRegion(pool.Get(), count, 4);
+        SetLargeMemoryMap(pool.Get(), server, count);
+
+        apr_uint64_t requests = 0;
+        for (apr_size_t i = 1; i < count; i++)
+        {
+            requests += 10 * (1 + i % 50);
+        }
+
+        const ApacheVHostSnapshot *first;
+        {
+            ApacheDataCollector data;
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Attach("TestSnapshotReusesBuffer"));
+
+            // Each snapshot overwrites the collector's buffer, and _Total agrees with the hosts
+            for (apr_uint32_t sample = 1; sample <= 2; sample++)
+            {
+                GenerateTraffic(server, count, sample);
+                const ApacheSnapshot& snapshot = data.Snapshot();
+                if (1 == sample)
+                {
+                    first = snapshot.vhosts;
+                }
+                CPPUNIT_ASSERT(first == snapshot.vhosts);
+                CPPUNIT_ASSERT_EQUAL(count, snapshot.vhostCount);
+
+                apr_uint64_t hostRequests = 0, hostBytes = 0, host404 = 0;
+                for (apr_size_t i = 1; i < count; i++)
+                {
+                    hostRequests += snapshot.vhosts[i].requestsTotal;
+                    hostBytes += snapshot.vhosts[i].requestsBytes;
+                    host404 += snapshot.vhosts[i].responses[MMAP_RESPONSE_404];
+                }
+                CPPUNIT_ASSERT_EQUAL(sample * requests, snapshot.vhosts[0].requestsTotal);
+                CPPUNIT_ASSERT_EQUAL(hostRequests, snapshot.vhosts[0].requestsTotal);
+                CPPUNIT_ASSERT_EQUAL(hostBytes, snapshot.vhosts[0].requestsBytes);
+                CPPUNIT_ASSERT_EQUAL(host404, snapshot.vhosts[0].responses[MMAP_RESPONSE_404]);
+            }
+        }
+
+        // The buffer goes back to the provider, and the next collector gets it again
+        ApacheDataCollector data;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Attach("TestSnapshotReusesBuffer"));
+        CPPUNIT_ASSERT(first == data.Snapshot().vhosts);
+    }
+
+    void TestSamplingPassOverManyVHosts()
+    {
+        // Mass hosting: _Total and 10000 virtual hosts, counted in 4 slabs (so _Total is derived)
+        static const apr_size_t count = 10001;
+        static const apr_size_t shards = 4;
+        static const apr_interval_time_t interval = apr_time_from_sec(10);
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+
+        mmap_server_data *server = GenerateLargeRegion(pool.Get(), count, shards);
+        mmap_vhost_data *vhosts = SetLargeMemoryMap(pool.Get(), server, count);
+
+        ApacheDataCollector data;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Attach("TestSamplingPassOverManyVHosts"));
+
+        DataSampler sampler;
+        sampler.Bootstrap(data, apr_time_now());
+
+        // A minute of samples, timing the work the sampler does for each (the rate history
+        // folds the samples into a minute on the last one)
+        apr_interval_time_t slowest = 0, total = 0;
+        for (apr_uint32_t sample = 0; sample < RateHistory::SamplesPerMinute; sample++)
+        {
+            GenerateTraffic(server, count, sample);
+
+            apr_time_t start = apr_time_now();
+            sampler.SampleRateHistory(data, interval);
+            sampler.SampleVHosts(data, interval);
+            apr_interval_time_t elapsed = apr_time_now() - start;
+
+            slowest = std::max(slowest, elapsed);
+            total += elapsed;
+        }
+
+        std::cout << ": " << apr_time_as_msec(total / RateHistory::SamplesPerMinute) << "ms average, "
+                  << apr_time_as_msec(slowest) << "ms slowest";
+
+        // The results are right for the hosts, and for _Total
+        mmap_vhost_statistics *stats = MMAP_VHOST_STATISTICS(vhosts);
+        apr_uint32_t totalPerSecond = 0;
+        for (apr_size_t i = 1; i < count; i++)
+        {
+            totalPerSecond += 1 + i % 50;
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1 + 1234 % 50), stats[1234].requestsPerSecond);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(6), stats[1234].responsesPerMinute[MMAP_RESPONSE_404]);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1 + 1234 % 50), stats[1234].rateHistory[MMAP_RATE_REQUESTS].average[1]);
+        CPPUNIT_ASSERT_EQUAL(totalPerSecond, stats[0].requestsPerSecond);
+        CPPUNIT_ASSERT_EQUAL(totalPerSecond, stats[0].rateHistory[MMAP_RATE_REQUESTS].peak[3]);
+        CPPUNIT_ASSERT(stats[1234].latencyP50 >= 1000 && stats[1234].latencyMax == 20000);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(1), stats[1234].uniqueClients);
+
+        // Sampling runs every 10 seconds; a pass must take a small fraction of that
+        CPPUNIT_ASSERT(slowest < apr_time_from_sec(2));
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Apache_DataSampler_Test );
@@ -0,0 +1,151 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation.  All rights reserved.
+
+    Created date    2026-10-16 09:00:00
+
+    ProviderLogger unit tests.
+
+    Tests level filtering, per-site rate limits and the logging thread.
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "apachebinding.h"
+#include "logger.h"
+#include "testableapache.h"
+
+#include <string>
+#include <vector>
+
+class TestableLoggerCountingLines : public ProviderLogger
+{
+public:
+    std::vector<std::string> m_lines;
+
+protected:
+    virtual void Write(const char* line) { m_lines.push_back(line); }
+    virtual void Flush() {}
+};
+
+// Counts messages written, by the logging thread or by callers
+class TestableLoggerCountingMessages : public ProviderLogger
+{
+public:
+    TestableLoggerCountingMessages() : m_count(0) {}
+
+    volatile apr_uint32_t m_count;
+
+protected:
+    virtual void Write(const char*) { apr_atomic_inc32(&m_count); }
+    virtual void Flush() {}
+};
+
+// Threads logging while the logger stops
+static const int s_threadCount = 4;
+static const apr_uint32_t s_messagesPerThread = 20000;
+
+static void* APR_THREAD_FUNC LogMessages(apr_thread_t *tid, void *data)
+{
+    ProviderLogger *logger = static_cast<ProviderLogger *>(data);
+
+    for (apr_uint32_t i = 0; i < s_messagesPerThread; i++)
+    {
+        logger->Log(ProviderLogger::LevelInfo, 0, "message", NULL);
+    }
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+class Apache_ProviderLogger_Test : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( Apache_ProviderLogger_Test );
+
+    CPPUNIT_TEST( TestLoggerLevelsAndRateLimits );
+    CPPUNIT_TEST( TestStopWritesEveryMessage );
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void)
+    {
+        g_pFactory = new TestableApacheFactory();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("Apache_ProviderLogger_Test"));
+    }
+
+    void tearDown(void)
+    {
+        g_pFactory->GetInit()->Unload("Apache_ProviderLogger_Test");
+
+        delete g_pFactory;
+        g_pFactory = NULL;
+    }
+
+    void TestLoggerLevelsAndRateLimits()
+    {
+        TestableLoggerCountingLines logger;
+        int siteA, siteB;
+
+        // Each site may log SiteBurst messages per interval; other sites aren't affected
+        for (apr_uint32_t i = 0; i < 2 * ProviderLogger::SiteBurst; i++)
+        {
+            logger.Log(ProviderLogger::LevelInfo, 0, "site A", &siteA);
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(ProviderLogger::SiteBurst), logger.m_lines.size());
+
+        logger.Log(ProviderLogger::LevelError, APR_ENOENT, "site B", &siteB);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(ProviderLogger::SiteBurst + 1), logger.m_lines.size());
+        CPPUNIT_ASSERT(std::string::npos != logger.m_lines.back().find("site B, status="));
+
+        // Messages below the level are dropped, until the level changes
+        logger.Log(ProviderLogger::LevelDebug, 0, "debug", NULL);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(ProviderLogger::SiteBurst + 1), logger.m_lines.size());
+
+        ProviderLogger::Level level;
+        CPPUNIT_ASSERT(ProviderLogger::ParseLevel(" Debug\n", level));
+        CPPUNIT_ASSERT(! ProviderLogger::ParseLevel("verbose", level));
+        logger.SetLevel(level);
+        logger.Log(ProviderLogger::LevelDebug, 0, "debug", NULL);
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(ProviderLogger::SiteBurst + 2), logger.m_lines.size());
+
+        // Once started, messages are written by the logging thread (and all are written by Stop())
+        logger.m_lines.clear();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, logger.Start(g_pFactory->GetInit()->GetPool()));
+        for (apr_uint32_t i = 0; i < ProviderLogger::QueueSize / 2; i++)
+        {
+            logger.Log(ProviderLogger::LevelInfo, 0, "queued", NULL);
+        }
+        logger.Stop();
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(ProviderLogger::QueueSize / 2), logger.m_lines.size());
+    }
+
+    void TestStopWritesEveryMessage()
+    {
+        TestableLoggerCountingMessages logger;
+        apr_pool_t *pool = g_pFactory->GetInit()->GetPool();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, logger.Start(pool));
+
+        // Stop while threads are logging: each message is queued (and written by the
+        // logging thread or by Stop()), or written by its caller, but never lost
+        apr_thread_t *threads[s_threadCount];
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_create(&threads[i], NULL, LogMessages, &logger, pool));
+        }
+        apr_sleep(apr_time_from_msec(5));
+        logger.Stop();
+
+        for (int i = 0; i < s_threadCount; i++)
+        {
+            apr_status_t status;
+            CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, threads[i]));
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_uint32_t>(s_threadCount) * s_messagesPerThread,
+                             apr_atomic_read32(&logger.m_count));
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Apache_ProviderLogger_Test );
@@ -0,0 +1,155 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation.  All rights reserved.
+
+    Created date    2026-10-16 09:00:00
+
+    PoolCache unit tests.
+
+    Tests that pools handed to data collectors are recycled, and that the cache is bounded;
+    measures the heap that repeated enumerations leave behind.
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include "apachebinding.h"
+#include "poolcache.h"
+#include "testableapache.h"
+
+#include <iostream>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Enumerations measured, and bytes each allocates from its collector's pool
+static const apr_size_t s_enumerationCount = 5000;
+static const apr_size_t s_enumerationBytes = 64 * 1024;
+
+// Bytes of heap in use (allocated blocks, including mapped ones)
+static apr_uint64_t HeapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 heap = mallinfo2();
+    return static_cast<apr_uint64_t>(heap.uordblks) + static_cast<apr_uint64_t>(heap.hblkhd);
+#elif defined(__GLIBC__)
+    struct mallinfo heap = mallinfo();
+    return static_cast<apr_uint64_t>(heap.uordblks) + static_cast<apr_uint64_t>(heap.hblkhd);
+#else
+    return 0;
+#endif
+}
+
+class Apache_PoolCache_Test : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( Apache_PoolCache_Test );
+
+    CPPUNIT_TEST( TestPoolCacheIsBounded );
+    CPPUNIT_TEST( TestEnumerationMemory );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestEnumerationMemory, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void)
+    {
+        g_pFactory = new TestableApacheFactory();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("Apache_PoolCache_Test"));
+    }
+
+    void tearDown(void)
+    {
+        g_pFactory->GetInit()->Unload("Apache_PoolCache_Test");
+
+        delete g_pFactory;
+        g_pFactory = NULL;
+    }
+
+    void TestPoolCacheIsBounded()
+    {
+        PoolCache& pools = g_pFactory->GetInit()->GetPools();
+        PoolCache::Usage before, usage;
+        pools.GetUsage(before);
+
+        // Returned pools are reused, up to the size of the cache; the rest are destroyed
+        const apr_size_t count = PoolCache::MaxCachedPools + 3;
+        apr_pool_t* held[count];
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            held[i] = pools.Get();
+            CPPUNIT_ASSERT(NULL != held[i]);
+        }
+        pools.GetUsage(usage);
+        CPPUNIT_ASSERT_EQUAL(before.inUse + count, usage.inUse);
+        CPPUNIT_ASSERT_EQUAL(static_cast<apr_size_t>(0), usage.cached);
+
+        for (apr_size_t i = 0; i < count; i++)
+        {
+            pools.Put(held[i]);
+        }
+        pools.GetUsage(usage);
+        CPPUNIT_ASSERT_EQUAL(before.inUse, usage.inUse);
+        CPPUNIT_ASSERT_EQUAL(PoolCache::MaxCachedPools, usage.cached);
+
+        // Collectors take their pools from the cache (and give them back)
+        {
+            ApacheDataCollector data;
+            pools.GetUsage(usage);
+            CPPUNIT_ASSERT_EQUAL(PoolCache::MaxCachedPools - 1, usage.cached);
+        }
+        pools.GetUsage(usage);
+        CPPUNIT_ASSERT_EQUAL(PoolCache::MaxCachedPools, usage.cached);
+        CPPUNIT_ASSERT_EQUAL(before.inUse, usage.inUse);
+    }
+
+    void TestEnumerationMemory()
+    {
+        // Now: each enumeration's collector takes a pool from the cache and gives it back
+        // (the first enumerations create the pool, so they aren't counted)
+        for (apr_size_t i = 0; i < 10; i++)
+        {
+            ApacheDataCollector data;
+            CPPUNIT_ASSERT(NULL != apr_palloc(data.GetPool(), s_enumerationBytes));
+        }
+        apr_uint64_t start = HeapInUse();
+        for (apr_size_t i = 0; i < s_enumerationCount; i++)
+        {
+            ApacheDataCollector data;
+            CPPUNIT_ASSERT(NULL != apr_palloc(data.GetPool(), s_enumerationBytes));
+        }
+        apr_uint64_t now = HeapInUse() - start;
+
+        // Before: each enumeration created a child of the provider's pool, and only
+        // cleared it (here the parent is a temporary pool, so the test gives it back)
+        apr_uint64_t before;
+        {
+            TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+            start = HeapInUse();
+            for (apr_size_t i = 0; i < s_enumerationCount; i++)
+            {
+                apr_pool_t *child;
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_pool_create(&child, pool.Get()));
+                CPPUNIT_ASSERT(NULL != apr_palloc(child, s_enumerationBytes));
+                apr_pool_clear(child);
+            }
+            before = HeapInUse() - start;
+        }
+
+        std::cout << std::endl << "    heap left by " << s_enumerationCount << " enumerations, child pool each (before): "
+                  << before << " bytes";
+        std::cout << std::endl << "    heap left by " << s_enumerationCount << " enumerations, pool cache (now): "
+                  << now << " bytes";
+        std::cout << std::endl << "   ";
+
+#if defined(__GLIBC__)
+        // Pooled enumerations leave no more than the allocator keeps free; cleared
+        // child pools each kept their first block
+        CPPUNIT_ASSERT(now <= PoolCache::MaxFreeBytes);
+        CPPUNIT_ASSERT(before > now);
+#endif
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Apache_PoolCache_Test );
@@ -0,0 +1,313 @@
+/*--------------------------------------------------------------------------------
+    Copyright (c) Microsoft Corporation.  All rights reserved.
+
+    Created date    2026-10-16 09:00:00
+
+    Request path benchmarks.
+
+    Times the work the module does for each request (in the log_transaction
+    hook) at 10k virtual hosts, as it is now and as it was before, and prints
+    the cost of each in ns/request.  The module itself only builds against
+    httpd, so these drive the same lookups and region writes (the counting is
+    shared with the module through mmap_region.h) from the test runner.
+
+*/
+/*----------------------------------------------------------------------------*/
+
+#include <scxcorelib/scxcmn.h>
+#include <testutils/scxunit.h>
+
+#include <apr_atomic.h>
+#include <apr_hash.h>
+#include <apr_strings.h>
+#include <apr_thread_proc.h>
+
+#include "apachebinding.h"
+#include "testableapache.h"
+
+#include <string.h>
+#include <iostream>
+#include <vector>
+
+// Virtual hosts configured, and requests timed for each measurement
+static const apr_size_t s_vhostCount = 10000;
+static const apr_size_t s_requestCount = 1000000;
+
+// Virtual host of each request: a fixed pseudo-random sequence (so runs compare)
+static void GenerateRequestHosts(std::vector<apr_size_t>& hosts)
+{
+    apr_uint32_t seed = 12345;
+
+    hosts.resize(65536);
+    for (apr_size_t i = 0; i < hosts.size(); i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        hosts[i] = 2 + (seed >> 8) % (s_vhostCount - 2);
+    }
+}
+
+static void PrintCost(const char *what, apr_interval_time_t elapsed)
+{
+    std::cout << std::endl << "    " << what << ": "
+              << (elapsed * 1000 / static_cast<apr_interval_time_t>(s_requestCount)) << " ns/request";
+}
+
+// Request threads counting at once (children sharing one counter slab, the default)
+static const int s_threadCount = 4;
+
+// A virtual host as the region kept it before the hot/cold split: host data, the
+// counters Apache writes and the statistics the provider writes, interleaved (with
+// today's counters, so both layouts count the same way)
+struct InterleavedVHost
+{
+    apr_size_t offsets[9];
+    mmap_vhost_counters counters;
+    mmap_vhost_counters priorCounters;
+    volatile apr_uint32_t requestsPerSecond;
+    volatile apr_uint32_t kbPerRequest;
+    volatile apr_uint32_t kbPerSecond;
+    volatile apr_uint32_t responsesPerMinute[MMAP_RESPONSE_COUNT];
+};
+
+// The hosts of one measurement, in one layout or the other
+struct RequestPathRegion
+{
+    const std::vector<apr_size_t> *hosts;
+    InterleavedVHost *interleaved;      // Before the split (NULL to measure the layout now)
+    mmap_vhost_counters *slab;          // Now: a dense counter slab ...
+    mmap_vhost_statistics *statistics;  // ... apart from the provider's statistics
+    volatile apr_uint32_t stop;         // Set to end the sampler thread
+};
+
+struct RequestThread
+{
+    RequestPathRegion *region;
+    apr_size_t first;                   // Where in the host sequence this thread starts
+};
+
+// Count requests as handle_VHostStatistics does: the host, then _Total
+static void* APR_THREAD_FUNC CountRequests(apr_thread_t *tid, void *data)
+{
+    RequestThread *thread = static_cast<RequestThread *>(data);
+    RequestPathRegion *region = thread->region;
+    const std::vector<apr_size_t>& hosts = *region->hosts;
+
+    for (apr_size_t i = 0; i < s_requestCount; i++)
+    {
+        apr_size_t element = hosts[(thread->first + i) % hosts.size()];
+        mmap_vhost_counters *host = region->interleaved ? &region->interleaved[element].counters : &region->slab[element];
+        mmap_vhost_counters *total = region->interleaved ? &region->interleaved[0].counters : &region->slab[0];
+
+        mmap_count_request(host, 4096, 200, -1, 0);
+        mmap_count_request(total, 4096, 200, -1, 0);
+    }
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+// Write the statistics of a host from its counters, as the sampler does
+template <class Statistics>
+static void SampleHost(const mmap_vhost_counters& counters, Statistics& statistics)
+{
+    apr_uint64_t requests = MMAP_ATOMIC_READ64(&counters.requestsTotal);
+    apr_uint64_t bytes = MMAP_ATOMIC_READ64(&counters.requestsBytes);
+
+    statistics.requestsPerSecond = static_cast<apr_uint32_t>((requests - statistics.priorCounters.requestsTotal) / 10);
+    statistics.kbPerSecond = static_cast<apr_uint32_t>((bytes - statistics.priorCounters.requestsBytes) / 10240);
+    statistics.priorCounters.requestsTotal = requests;
+    statistics.priorCounters.requestsBytes = bytes;
+}
+
+// Pass over the hosts without pause until stopped: the worst case of the sampler's
+// writes meeting request counting (the sampler itself passes every 10 seconds)
+static void* APR_THREAD_FUNC SampleHosts(apr_thread_t *tid, void *data)
+{
+    RequestPathRegion *region = static_cast<RequestPathRegion *>(data);
+
+    while (!apr_atomic_read32(&region->stop))
+    {
+        for (apr_size_t i = 0; i < s_vhostCount; i++)
+        {
+            if (region->interleaved)
+            {
+                SampleHost(region->interleaved[i].counters, region->interleaved[i]);
+            }
+            else
+            {
+                SampleHost(region->slab[i], region->statistics[i]);
+            }
+        }
+    }
+
+    apr_thread_exit(tid, APR_SUCCESS);
+    return NULL;
+}
+
+// Time s_threadCount threads counting s_requestCount requests each (with the sampler
+// running alongside, if asked)
+static apr_interval_time_t TimeRequests(apr_pool_t *pool, RequestPathRegion& region, bool sampling)
+{
+    apr_thread_t *threads[s_threadCount];
+    RequestThread work[s_threadCount];
+    apr_thread_t *sampler = NULL;
+    apr_status_t status;
+
+    apr_atomic_set32(&region.stop, 0);
+    if (sampling)
+    {
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_create(&sampler, NULL, SampleHosts, &region, pool));
+    }
+
+    apr_time_t start = apr_time_now();
+    for (int i = 0; i < s_threadCount; i++)
+    {
+        work[i].region = &region;
+        work[i].first = i * region.hosts->size() / s_threadCount;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_create(&threads[i], NULL, CountRequests, &work[i], pool));
+    }
+    for (int i = 0; i < s_threadCount; i++)
+    {
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, threads[i]));
+    }
+    apr_interval_time_t elapsed = apr_time_now() - start;
+
+    apr_atomic_set32(&region.stop, 1);
+    if (sampling)
+    {
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_thread_join(&status, sampler));
+    }
+
+    return elapsed;
+}
+
+// Cache line aligned memory (as the counter slabs are in the region)
+static void *AllocateAligned(apr_pool_t *pool, apr_size_t size)
+{
+    char *base = static_cast<char *>(apr_pcalloc(pool, size + MMAP_CACHE_LINE_SIZE));
+    return reinterpret_cast<void *>(MMAP_CACHE_LINE_ALIGN(reinterpret_cast<apr_size_t>(base)));
+}
+
+class Apache_RequestPath_Test : public CPPUNIT_NS::TestFixture
+{
+    CPPUNIT_TEST_SUITE( Apache_RequestPath_Test );
+
+    CPPUNIT_TEST( TestVHostLookupCost );
+    CPPUNIT_TEST( TestRequestCountingCost );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestVHostLookupCost, SLOW);
+    SCXUNIT_TEST_ATTRIBUTE(TestRequestCountingCost, SLOW);
+
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void)
+    {
+        g_pFactory = new TestableApacheFactory();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("Apache_RequestPath_Test"));
+    }
+
+    void tearDown(void)
+    {
+        g_pFactory->GetInit()->Unload("Apache_RequestPath_Test");
+
+        delete g_pFactory;
+        g_pFactory = NULL;
+    }
+
+    void TestVHostLookupCost()
+    {
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+        std::vector<apr_size_t> hosts;
+        GenerateRequestHosts(hosts);
+
+        // Stand-ins for the server_rec of each virtual host, keyed both ways: by the
+        // formatted address (as before) and by the address itself (as now)
+        std::vector<apr_uint64_t> servers(s_vhostCount);
+        apr_hash_t *byString = apr_hash_make(pool.Get());
+        apr_hash_t *byPointer = apr_hash_make(pool.Get());
+        for (apr_size_t i = 2; i < s_vhostCount; i++)
+        {
+            void **key = static_cast<void **>(apr_palloc(pool.Get(), sizeof(void *)));
+            *key = &servers[i];
+            apr_hash_set(byString, apr_psprintf(pool.Get(), "%pp", *key), APR_HASH_KEY_STRING, reinterpret_cast<void *>(i));
+            apr_hash_set(byPointer, key, sizeof(*key), reinterpret_cast<void *>(i));
+        }
+
+        // Before: format the address into the request pool, then hash the string
+        // (the request pool is cleared with each connection; here every 100 requests)
+        apr_pool_t *requestPool;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, apr_pool_create(&requestPool, pool.Get()));
+        apr_size_t found = 0;
+        apr_time_t start = apr_time_now();
+        for (apr_size_t i = 0; i < s_requestCount; i++)
+        {
+            void *server = &servers[hosts[i % hosts.size()]];
+            found += reinterpret_cast<apr_size_t>(apr_hash_get(byString, apr_psprintf(requestPool, "%pp", server), APR_HASH_KEY_STRING));
+            if (0 == i % 100)
+            {
+                apr_pool_clear(requestPool);
+            }
+        }
+        apr_interval_time_t before = apr_time_now() - start;
+
+        // Now: hash the address of the server record
+        apr_size_t foundNow = 0;
+        start = apr_time_now();
+        for (apr_size_t i = 0; i < s_requestCount; i++)
+        {
+            void *server = &servers[hosts[i % hosts.size()]];
+            foundNow += reinterpret_cast<apr_size_t>(apr_hash_get(byPointer, &server, sizeof(server)));
+        }
+        apr_interval_time_t now = apr_time_now() - start;
+
+        PrintCost("vhost lookup by formatted address (before)", before);
+        PrintCost("vhost lookup by server_rec pointer (now)", now);
+        std::cout << std::endl << "   ";
+
+        // Both find every host
+        CPPUNIT_ASSERT_EQUAL(found, foundNow);
+        CPPUNIT_ASSERT(found >= 2 * s_requestCount);
+    }
+
+    void TestRequestCountingCost()
+    {
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+        std::vector<apr_size_t> hosts;
+        GenerateRequestHosts(hosts);
+
+        RequestPathRegion before;
+        memset(&before, 0, sizeof(before));
+        before.hosts = &hosts;
+        before.interleaved = static_cast<InterleavedVHost *>(AllocateAligned(pool.Get(), sizeof(InterleavedVHost) * s_vhostCount));
+
+        RequestPathRegion now;
+        memset(&now, 0, sizeof(now));
+        now.hosts = &hosts;
+        now.slab = static_cast<mmap_vhost_counters *>(AllocateAligned(pool.Get(), sizeof(mmap_vhost_counters) * s_vhostCount));
+        now.statistics = static_cast<mmap_vhost_statistics *>(AllocateAligned(pool.Get(), sizeof(mmap_vhost_statistics) * s_vhostCount));
+
+        // Each layout on its own, then with the sampler writing statistics alongside
+        PrintCost("counting, host data interleaved (before)", TimeRequests(pool.Get(), before, false));
+        PrintCost("counting, counter slab (now)", TimeRequests(pool.Get(), now, false));
+        PrintCost("counting with sampler, host data interleaved (before)", TimeRequests(pool.Get(), before, true));
+        PrintCost("counting with sampler, counter slab (now)", TimeRequests(pool.Get(), now, true));
+        std::cout << std::endl << "   ";
+
+        // Both layouts counted every request, in the hosts and in _Total
+        apr_uint64_t requests = 2 * s_threadCount * s_requestCount;
+        apr_uint64_t beforeHosts = 0, nowHosts = 0;
+        for (apr_size_t i = 2; i < s_vhostCount; i++)
+        {
+            beforeHosts += before.interleaved[i].counters.requestsTotal;
+            nowHosts += now.slab[i].requestsTotal;
+        }
+        CPPUNIT_ASSERT_EQUAL(requests, static_cast<apr_uint64_t>(before.interleaved[0].counters.requestsTotal));
+        CPPUNIT_ASSERT_EQUAL(requests, static_cast<apr_uint64_t>(now.slab[0].requestsTotal));
+        CPPUNIT_ASSERT_EQUAL(requests, beforeHosts);
+        CPPUNIT_ASSERT_EQUAL(requests, nowHosts);
+        CPPUNIT_ASSERT_EQUAL(requests, static_cast<apr_uint64_t>(now.slab[0].responses[MMAP_RESPONSE_2XX]));
+    }
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION( Apache_RequestPath_Test );
@@ -35,11 +35,22 @@ class TestableDataCollectorDepsFailsLoadMemoryMap : public TestableApacheDataCol
 class TestableFactoryWithLoadMemoryMapFailure : public TestableApacheFactory
 {
 public:
-    virtual ApacheDataCollector DataCollectorFactory()
+    virtual ApacheDataCollectorDependencies* DataCollectorDependenciesFactory()
+    { return new TestableDataCollectorDepsFailsLoadMemoryMap(); }
+};
+
+class TestableFactoryCountingAttachments : public TestableApacheFactory
+{
+public:
+    TestableFactoryCountingAttachments() : m_attachCount(0) {}
+
+    virtual ApacheDataCollectorDependencies* DataCollectorDependenciesFactory()
     {
-        TestableDataCollectorDepsFailsLoadMemoryMap* pDeps = new TestableDataCollectorDepsFailsLoadMemoryMap();
-        return ApacheDataCollector( pDeps );
+        m_attachCount++;
+        return TestableApacheFactory::DataCollectorDependenciesFactory();
     }
+
+    int m_attachCount;
 };
 
 
@@ -52,11 +63,8 @@ class TestableInitDepsFailsCroakedApache : public TestableApacheInitDependencies
 class TestableFactoryWithCroakedApache : public TestableApacheFactory
 {
 public:
-    virtual ApacheDataCollector DataCollectorFactory()
-    {
-        TestableDataCollectorDepsFailsLoadMemoryMap* pDeps = new TestableDataCollectorDepsFailsLoadMemoryMap();
-        return ApacheDataCollector( pDeps );
-    }
+    virtual ApacheDataCollectorDependencies* DataCollectorDependenciesFactory()
+    { return new TestableDataCollectorDepsFailsLoadMemoryMap(); }
 
     virtual ApacheInitialization* InitializationFactory()
     { return new ApacheInitialization( new TestableInitDepsFailsCroakedApache() ); }
@@ -74,8 +82,13 @@ class Apache_HTTPDServer_Test : public CPPUNIT_NS::TestFixture
     // Now test the actual production code
     CPPUNIT_TEST( TestGetConfigFile );
     CPPUNIT_TEST( TestAttachFailsIfLoadMemoryMapFails );
+    CPPUNIT_TEST( TestCollectorsShareAttachment );
     CPPUNIT_TEST( TestEnumerateInstancesKeysOnly );
+    CPPUNIT_TEST( TestEnumerateInstancesCachedByGeneration );
+    CPPUNIT_TEST( TestEnumerationCostCachedAndUncached );
     CPPUNIT_TEST( TestEnumerateInstancesWithDeadApacheServer );
+
+    SCXUNIT_TEST_ATTRIBUTE(TestEnumerationCostCachedAndUncached, SLOW);
 /*
     CPPUNIT_TEST( TestEnumerateInstances );
     CPPUNIT_TEST( TestVerifyKeyCompletePartial );
@@ -190,16 +203,64 @@ public:
 
     void TestAttachFailsIfLoadMemoryMapFails()
     {
-        TestableFactoryWithLoadMemoryMapFailure* pFactory = new TestableFactoryWithLoadMemoryMapFailure();
+        // Collectors attach through the global factory; squirrel away the existing one, restore later
+        ApacheFactory* saved_g_pFactory = g_pFactory;
+        g_pFactory = new TestableFactoryWithLoadMemoryMapFailure();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("TestAttachFailsIfLoadMemoryMapFails"));
 
         // Watch scoping; ApacheDataCollector must destruct prior to deleting the factory
         {
-            ApacheDataCollector data = pFactory->DataCollectorFactory();
+            ApacheDataCollector data;
             apr_status_t status = data.Attach("TestAttachFailsIfLoadMemoryMapFails");
             CPPUNIT_ASSERT_EQUAL(APR_ENOENT, status);
         }
 
-        delete pFactory;
+        g_pFactory->GetInit()->Unload("TestAttachFailsIfLoadMemoryMapFails");
+        delete g_pFactory;
+        g_pFactory = saved_g_pFactory;
+    }
+
+    void TestCollectorsShareAttachment()
+    {
+        ApacheFactory* saved_g_pFactory = g_pFactory;
+        TestableFactoryCountingAttachments* pFactory = new TestableFactoryCountingAttachments();
+        g_pFactory = pFactory;
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("TestCollectorsShareAttachment"));
+
+        {
+            TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+            TestStringTable strTab;
+            TestServerData serverTab(strTab);
+            GenerateSampleServerData(serverTab);
+            GenerateMemoryMap(pool, serverTab, strTab);
+
+            // Collectors (one after another, or at once) share one mapping of the region
+            {
+                ApacheDataCollector first;
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, first.Attach("TestCollectorsShareAttachment"));
+            }
+            {
+                ApacheDataCollector first;
+                ApacheDataCollector second;
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, first.Attach("TestCollectorsShareAttachment"));
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, second.Attach("TestCollectorsShareAttachment"));
+                CPPUNIT_ASSERT_EQUAL(std::string(first.GetServerRoot()), std::string(second.GetServerRoot()));
+            }
+            CPPUNIT_ASSERT_EQUAL(1, pFactory->m_attachCount);
+
+            // Once Apache retires the region, it's mapped again
+            {
+                ApacheDataCollector data;
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Attach("TestCollectorsShareAttachment"));
+                mmap_region_write_begin(&serverTab.GetGeneratedServerData()->header);
+                CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, data.Reattach("TestCollectorsShareAttachment"));
+            }
+            CPPUNIT_ASSERT_EQUAL(2, pFactory->m_attachCount);
+        }
+
+        g_pFactory->GetInit()->Unload("TestCollectorsShareAttachment");
+        delete g_pFactory;
+        g_pFactory = saved_g_pFactory;
     }
 
     void TestEnumerateInstancesKeysOnly()
@@ -231,12 +292,91 @@ public:
                              context[0].GetKey(L"CollectionID", CALL_LOCATION(errMsg)));
     }
 
+    void TestEnumerateInstancesCachedByGeneration()
+    {
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+
+        TestStringTable strTab;
+        TestServerData serverTab(strTab);
+        GenerateSampleServerData(serverTab);
+        GenerateMemoryMap(pool, serverTab, strTab);
+
+        mmap_server_data* server = serverTab.GetGeneratedServerData();
+        server->header.generation = 7;
+
+        std::wstring errMsg;
+        {
+            TestableContext context;
+            StandardTestEnumerateKeysOnly<mi::Apache_HTTPDServer_Class_Provider>(
+                m_keyNames, context, CALL_LOCATION(errMsg));
+            CPPUNIT_ASSERT_EQUAL(std::wstring(L"/etc/httpd/conf/httpd.conf-fake"),
+                                 context[0].GetKey(L"ProductName", CALL_LOCATION(errMsg)));
+        }
+
+        // Apache never changes a region's configuration without a new generation,
+        // so (to show the instance is cached) a change within one isn't seen
+        server->configFileOffset = server->serverRootOffset;
+        {
+            TestableContext context;
+            StandardTestEnumerateKeysOnly<mi::Apache_HTTPDServer_Class_Provider>(
+                m_keyNames, context, CALL_LOCATION(errMsg));
+            CPPUNIT_ASSERT_EQUAL(std::wstring(L"/etc/httpd/conf/httpd.conf-fake"),
+                                 context[0].GetKey(L"ProductName", CALL_LOCATION(errMsg)));
+        }
+
+        server->header.generation = 8;
+        {
+            TestableContext context;
+            StandardTestEnumerateKeysOnly<mi::Apache_HTTPDServer_Class_Provider>(
+                m_keyNames, context, CALL_LOCATION(errMsg));
+            CPPUNIT_ASSERT_EQUAL(std::wstring(L"/etc/httpd-fake"),
+                                 context[0].GetKey(L"ProductName", CALL_LOCATION(errMsg)));
+        }
+    }
+
+    void TestEnumerationCostCachedAndUncached()
+    {
+        static const int enumerations = 1000;
+        TemporaryPool pool(g_pFactory->GetInit()->GetPool());
+
+        TestStringTable strTab;
+        TestServerData serverTab(strTab);
+        GenerateSampleServerData(serverTab);
+        GenerateMemoryMap(pool, serverTab, strTab);
+
+        // Generation zero is never cached, so each enumeration builds the instance again;
+        // with a real generation, only the first does
+        mmap_server_data* server = serverTab.GetGeneratedServerData();
+        apr_interval_time_t elapsed[2];
+        for (int cached = 0; cached < 2; cached++)
+        {
+            server->header.generation = cached ? 7 : 0;
+
+            std::wstring errMsg;
+            apr_time_t start = apr_time_now();
+            for (int i = 0; i < enumerations; i++)
+            {
+                TestableContext context;
+                StandardTestEnumerateKeysOnly<mi::Apache_HTTPDServer_Class_Provider>(
+                    m_keyNames, context, CALL_LOCATION(errMsg));
+                CPPUNIT_ASSERT_EQUAL(std::wstring(L"/etc/httpd/conf/httpd.conf-fake"),
+                                     context[0].GetKey(L"ProductName", CALL_LOCATION(errMsg)));
+            }
+            elapsed[cached] = apr_time_now() - start;
+        }
+
+        std::cout << std::endl << "    Server enumeration, uncached: " << elapsed[0] / enumerations << " us";
+        std::cout << std::endl << "    Server enumeration, cached by generation: " << elapsed[1] / enumerations << " us";
+        std::cout << std::endl << "   ";
+    }
+
     void TestEnumerateInstancesWithDeadApacheServer()
     {
         // We have our own factory for this ...
         // Squirrel away the existing global pointer, restore later
         ApacheFactory* saved_g_pFactory = g_pFactory;
         g_pFactory = new TestableFactoryWithCroakedApache();
+        CPPUNIT_ASSERT_EQUAL(APR_SUCCESS, g_pFactory->GetInit()->Load("TestEnumerateInstancesWithDeadApacheServer"));
 
         // Watch scoping; ApacheDataCollector must destruct prior to deleting the factory
         {
@@ -262,6 +402,7 @@ public:
                                  context[0].GetKey(L"CollectionID", CALL_LOCATION(errMsg)));
         }
 
+        g_pFactory->GetInit()->Unload("TestEnumerateInstancesWithDeadApacheServer");
         delete g_pFactory;
         g_pFactory = saved_g_pFactory;
     }
@@ -87,6 +87,9 @@ mmap_server_data* TestServerData::GenerateServerMap(apr_pool_t* p)
     memcpy( table, &m_server, sizeof(mmap_server_data) );
     memcpy( &table->modules, &m_modules[0], moduleSize );
     table->moduleCount = m_modules.size();
+    table->header.magic = MMAP_REGION_MAGIC;
+    table->header.version = MMAP_REGION_VERSION;
+    table->header.regionSize = tableSize;
 
     m_generatedServerData = table;
 
@@ -60,6 +60,7 @@ public:
     apr_size_t GetModule(apr_size_t entry);
 
     mmap_server_data* GenerateServerMap(apr_pool_t* p);
+    mmap_server_data* GetGeneratedServerData() { return m_generatedServerData; }
 
 private:
     void SetStringHelper(const char *str, apr_size_t& offset);
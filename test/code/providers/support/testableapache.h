@@ -63,6 +63,7 @@ public:
         return APR_SUCCESS;
     }
     virtual apr_status_t UnloadMemoryMap() { return APR_SUCCESS; }
+    virtual bool IsRegionCurrent(apr_uint32_t generation, bool checkFile) { return true; }
 
     void SetMemoryMap(mmap_server_data* svr, mmap_string_table* str)
     {
@@ -70,6 +71,14 @@ public:
         m_string_data = str;
     }
 
+    void SetMemoryMap(mmap_server_data* svr, mmap_vhost_data* vhost, mmap_certificate_data* cert, mmap_string_table* str)
+    {
+        m_server_data = svr;
+        m_vhost_data = vhost;
+        m_certificate_data = cert;
+        m_string_data = str;
+    }
+
 private:
     mmap_server_data *m_server_data;
     mmap_vhost_data *m_vhost_data;
@@ -84,11 +93,11 @@ public:
     : m_server_data(NULL), m_vhost_data(NULL), m_certificate_data(NULL), m_string_data(NULL)
     { }
 
-    virtual ApacheDataCollector DataCollectorFactory()
+    virtual ApacheDataCollectorDependencies* DataCollectorDependenciesFactory()
     {
         TestableApacheDataCollectorDependencies* pDeps = new TestableApacheDataCollectorDependencies();
-        pDeps->SetMemoryMap(m_server_data, m_string_data);
-        return ApacheDataCollector( pDeps );
+        pDeps->SetMemoryMap(m_server_data, m_vhost_data, m_certificate_data, m_string_data);
+        return pDeps;
     }
 
     virtual ApacheInitialization* InitializationFactory()
@@ -100,6 +109,14 @@ public:
         m_string_data = str;
     }
 
+    void SetMemoryMap(mmap_server_data* svr, mmap_vhost_data* vhost, mmap_certificate_data* cert, mmap_string_table* str)
+    {
+        m_server_data = svr;
+        m_vhost_data = vhost;
+        m_certificate_data = cert;
+        m_string_data = str;
+    }
+
 private:
     mmap_server_data *m_server_data;
     mmap_vhost_data *m_vhost_data;